@@ -539,6 +539,10 @@ SOURCE=.\src\base\cmd\cmdAuto.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\cmd\cmdCache.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\cmd\cmdFlag.c
 # End Source File
 # Begin Source File
@@ -2151,6 +2155,10 @@ SOURCE=.\src\sat\bmc\bmcMulti.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bmc\bmcSolver.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bmc\bmcUnroll.c
 # End Source File
 # End Group
@@ -4999,6 +5007,14 @@ SOURCE=.\src\misc\util\utilSignal.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilSimd.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilSimd.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSort.c
 # End Source File
 # Begin Source File
@@ -6483,6 +6499,10 @@ SOURCE=.\src\proof\cec\cecProve.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\cec\cecProveMulti.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\cec\cecSat.c
 # End Source File
 # Begin Source File
@@ -6847,6 +6867,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
@@ -42,8 +42,18 @@
 
 ABC_NAMESPACE_HEADER_START
 
-#define GIA_NONE 0x1FFFFFFF
-#define GIA_VOID 0x0FFFFFFF
+// compiling with ABC_USE_GIA_WIDE selects the wide object layout, which
+// lifts the limit on the number of objects from 2^29 to 2^30-1 (the largest
+// number of objects whose literals still fit into a signed integer)
+#ifdef ABC_USE_GIA_WIDE
+#define GIA_NONE    0x7FFFFFFF
+#define GIA_VOID    0x3FFFFFFF
+#define GIA_OBJ_MAX 0x3FFFFFFF
+#else
+#define GIA_NONE    0x1FFFFFFF
+#define GIA_VOID    0x0FFFFFFF
+#define GIA_OBJ_MAX (1 << 29)
+#endif
 
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
@@ -57,7 +67,11 @@ typedef struct Gia_Dat_t_            Gia_Dat_t;
 typedef struct Gia_Rpr_t_ Gia_Rpr_t;
 struct Gia_Rpr_t_
 {
+#ifdef ABC_USE_GIA_WIDE
+    unsigned       iRepr   : 30;  // representative node
+#else
     unsigned       iRepr   : 28;  // representative node
+#endif
     unsigned       fProved :  1;  // marks the proved equivalence
     unsigned       fFailed :  1;  // marks the failed equivalence
     unsigned       fColorA :  1;  // marks cone of A
@@ -74,6 +88,24 @@ struct Gia_Plc_t_
 };
 
 typedef struct Gia_Obj_t_ Gia_Obj_t;
+#ifdef ABC_USE_GIA_WIDE
+struct Gia_Obj_t_
+{
+    unsigned       iDiff0 :  31;  // the diff of the first fanin
+    unsigned       fCompl0:   1;  // the complemented attribute
+
+    unsigned       iDiff1 :  31;  // the diff of the second fanin
+    unsigned       fCompl1:   1;  // the complemented attribute
+
+    unsigned       fMark0 :   1;  // first user-controlled mark
+    unsigned       fTerm  :   1;  // terminal node (CI/CO)
+    unsigned       fMark1 :   1;  // second user-controlled mark
+    unsigned       fPhase :   1;  // value under 000 pattern
+    unsigned       fUnused: 28;   // reserved (keeps the object 16-byte aligned)
+
+    unsigned       Value;         // application-specific value
+};
+#else
 struct Gia_Obj_t_
 {
     unsigned       iDiff0 :  29;  // the diff of the first fanin
@@ -88,6 +120,7 @@ struct Gia_Obj_t_
 
     unsigned       Value;         // application-specific value
 };
+#endif
 // Value is currently used to store several types of information
 // - pointer to the next node in the hash table during structural hashing
 // - pointer to the node copy during duplication 
@@ -676,13 +709,23 @@ static inline word *       Gia_ObjSimObj( Gia_Man_t * p, Gia_Obj_t * pObj )    {
 
 // AIG construction
 extern void Gia_ObjAddFanout( Gia_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pFanout );
+static inline int Gia_ManObjAllocNext( int nObjsAlloc )
+{
+#ifdef ABC_USE_GIA_WIDE
+    // beyond 2^26 objects, grow by 25% instead of doubling to limit the peak memory during realloc
+    word nObjNew = nObjsAlloc < (1 << 26) ? 2 * (word)nObjsAlloc : (word)nObjsAlloc + nObjsAlloc / 4;
+    return (int)Abc_MinWord( nObjNew, GIA_OBJ_MAX );
+#else
+    return Abc_MinInt( 2 * nObjsAlloc, GIA_OBJ_MAX );
+#endif
+}
 static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )  
 { 
     if ( p->nObjs == p->nObjsAlloc )
     {
-        int nObjNew = Abc_MinInt( 2 * p->nObjsAlloc, (1 << 29) );
-        if ( p->nObjs == (1 << 29) )
-            printf( "Hard limit on the number of nodes (2^29) is reached. Quitting...\n" ), exit(1);
+        int nObjNew = Gia_ManObjAllocNext( p->nObjsAlloc );
+        if ( p->nObjs == GIA_OBJ_MAX )
+            printf( "Hard limit on the number of nodes (%d) is reached. Quitting...\n", GIA_OBJ_MAX ), exit(1);
         assert( p->nObjs < nObjNew );
         if ( p->fVerbose )
             printf("Extending GIA object storage: %d -> %d.\n", p->nObjsAlloc, nObjNew );
@@ -1272,9 +1315,10 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 ////////////////////////////////////////////////////////////////////////
 
 /*=== giaAiger.c ===========================================================*/
-extern int                 Gia_FileSize( char * pFileName );
-extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern word                Gia_FileSize( char * pFileName );
+extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, word nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadVerbose( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int fVerbose );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
 extern void                Gia_AigerWriteS( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
@@ -1506,6 +1550,7 @@ extern int                 Gia_ManHashMux( Gia_Man_t * p, int iCtrl, int iData1,
 extern int                 Gia_ManHashMaj( Gia_Man_t * p, int iData0, int iData1, int iData2 );
 extern int                 Gia_ManHashAndTry( Gia_Man_t * p, int iLit0, int iLit1 );
 extern Gia_Man_t *         Gia_ManRehash( Gia_Man_t * p, int fAddStrash );
+extern Gia_Man_t *         Gia_ManRehashMt( Gia_Man_t * p, int nProcs, int fVerbose );
 extern void                Gia_ManHashProfile( Gia_Man_t * p );
 extern int                 Gia_ManHashLookupInt( Gia_Man_t * p, int iLit0, int iLit1 );
 extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 );
@@ -1644,6 +1689,7 @@ extern int                 Gia_ManIncrSimCheckEqual( Gia_Man_t * p, int iLit0, i
 /*=== giaSimBase.c ============================================================*/
 extern Vec_Wrd_t *         Gia_ManSimPatSim( Gia_Man_t * p );
 extern Vec_Wrd_t *         Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts );
+extern void                Gia_ManSimBench( Gia_Man_t * p, int nWords, int nRounds, int fVerbose );
 extern void                Gia_ManSim2ArrayOne( Vec_Wrd_t * vSimsPi, Vec_Int_t * vRes );
 extern Vec_Wec_t *         Gia_ManSim2Array( Vec_Ptr_t * vSims );
 extern Vec_Wrd_t *         Gia_ManArray2SimOne( Vec_Int_t * vRes );
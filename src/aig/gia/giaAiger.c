@@ -19,10 +19,30 @@
 
 ***********************************************************************/
 
+#include <stdarg.h>
 #include "gia.h"
 #include "misc/tim/tim.h"
+#include "misc/zlib/zlib.h"
 #include "base/main/main.h"
 
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define GIA_AIGER_USE_MMAP
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
@@ -31,6 +51,32 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define GIA_AIGER_OUT_SIZE  (1 << 20)  // the size of the output buffer
+#define GIA_AIGER_SEG_SIZE  (1 << 16)  // the number of AND nodes in one segment
+#define GIA_AIGER_THR_MAX   64         // the max number of encoding threads
+
+// buffered output stream (compressed if the file name ends in ".gz")
+typedef struct Gia_AigerOut_t_ Gia_AigerOut_t;
+struct Gia_AigerOut_t_
+{
+    FILE *           pFile;      // uncompressed output
+    gzFile           pGzFile;    // compressed output
+    char *           pBuffer;    // fixed-size buffer
+    int              nSize;      // the number of bytes in the buffer
+    word             nBytes;     // the number of bytes written
+};
+
+// a segment of AND nodes encoded by one thread
+typedef struct Gia_AigerSeg_t_ Gia_AigerSeg_t;
+struct Gia_AigerSeg_t_
+{
+    Gia_Man_t *      p;          // the AIG
+    int              iStart;     // the first object
+    int              iStop;      // the last object + 1
+    int              nBytes;     // the number of encoded bytes
+    unsigned char *  pBuffer;    // the encoded segment
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -61,20 +107,26 @@ char * Gia_FileNameGeneric( char * FileName )
         *pDot = 0;
     return pRes;
 }
-int Gia_FileSize( char * pFileName )
+word Gia_FileSize( char * pFileName )
 {
     FILE * pFile;
-    int nFileSize;
-    pFile = fopen( pFileName, "r" );
+    ABC_INT64_T nFileSize;
+    pFile = fopen( pFileName, "rb" );
     if ( pFile == NULL )
     {
         printf( "Gia_FileSize(): The file is unavailable (absent or open).\n" );
         return 0;
     }
-    fseek( pFile, 0, SEEK_END );  
-    nFileSize = ftell( pFile ); 
+    // the 64-bit offsets are used for the files larger than 2 GB
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    _fseeki64( pFile, 0, SEEK_END );  
+    nFileSize = _ftelli64( pFile ); 
+#else
+    fseeko( pFile, 0, SEEK_END );  
+    nFileSize = ftello( pFile ); 
+#endif
     fclose( pFile );
-    return nFileSize;
+    return nFileSize < 0 ? 0 : (word)nFileSize;
 }
 void Gia_FileWriteBufferSize( FILE * pFile, int nSize )
 {
@@ -83,6 +135,186 @@ void Gia_FileWriteBufferSize( FILE * pFile, int nSize )
     fwrite( Buffer, 1, 4, pFile );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Buffered output stream.]
+
+  Description [Uses a fixed-size buffer, which is flushed into the file 
+  or into the gzip stream when full.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_FileNameIsGz( char * pFileName )
+{
+    int nLength = strlen(pFileName);
+    return nLength > 3 && !strcmp( pFileName + nLength - 3, ".gz" );
+}
+Gia_AigerOut_t * Gia_AigerOutStart( char * pFileName )
+{
+    Gia_AigerOut_t * p = ABC_CALLOC( Gia_AigerOut_t, 1 );
+    if ( Gia_FileNameIsGz(pFileName) )
+        p->pGzFile = gzopen( pFileName, "wb1" ); // fast compression suits checkpointing
+    else
+        p->pFile = fopen( pFileName, "wb" );
+    if ( p->pFile == NULL && p->pGzFile == NULL )
+    {
+        ABC_FREE( p );
+        return NULL;
+    }
+    p->pBuffer = ABC_ALLOC( char, GIA_AIGER_OUT_SIZE );
+    return p;
+}
+static void Gia_AigerOutFlush( Gia_AigerOut_t * p )
+{
+    if ( p->nSize == 0 )
+        return;
+    if ( p->pGzFile )
+        gzwrite( p->pGzFile, p->pBuffer, (unsigned)p->nSize );
+    else
+        fwrite( p->pBuffer, 1, p->nSize, p->pFile );
+    p->nSize = 0;
+}
+void Gia_AigerOutWrite( Gia_AigerOut_t * p, void * pData, int nBytes )
+{
+    p->nBytes += nBytes;
+    if ( p->nSize + nBytes > GIA_AIGER_OUT_SIZE )
+        Gia_AigerOutFlush( p );
+    if ( nBytes >= GIA_AIGER_OUT_SIZE )
+    {
+        if ( p->pGzFile )
+            gzwrite( p->pGzFile, pData, (unsigned)nBytes );
+        else
+            fwrite( pData, 1, nBytes, p->pFile );
+        return;
+    }
+    memcpy( p->pBuffer + p->nSize, pData, nBytes );
+    p->nSize += nBytes;
+}
+void Gia_AigerOutPrintf( Gia_AigerOut_t * p, const char * pFormat, ... )
+{
+    char Buffer[1000], * pBuffer = Buffer;
+    int nBytes;
+    va_list args;
+    va_start( args, pFormat );
+    nBytes = vsnprintf( Buffer, 1000, pFormat, args );
+    va_end( args );
+    if ( nBytes >= 1000 )
+    {
+        pBuffer = ABC_ALLOC( char, nBytes + 1 );
+        va_start( args, pFormat );
+        vsnprintf( pBuffer, nBytes + 1, pFormat, args );
+        va_end( args );
+    }
+    Gia_AigerOutWrite( p, pBuffer, nBytes );
+    if ( pBuffer != Buffer )
+        ABC_FREE( pBuffer );
+}
+void Gia_AigerOutWriteBufferSize( Gia_AigerOut_t * p, int nSize )
+{
+    unsigned char Buffer[5];
+    Gia_AigerWriteInt( Buffer, nSize );
+    Gia_AigerOutWrite( p, Buffer, 4 );
+}
+word Gia_AigerOutStop( Gia_AigerOut_t * p )
+{
+    word nBytes = p->nBytes;
+    Gia_AigerOutFlush( p );
+    if ( p->pGzFile )
+        gzclose( p->pGzFile );
+    else
+        fclose( p->pFile );
+    ABC_FREE( p->pBuffer );
+    ABC_FREE( p );
+    return nBytes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Encodes a segment of AND nodes.]
+
+  Description [The binary encoding of each node depends only on its 
+  own literal and the literals of its fanins, so segments of AND nodes 
+  can be encoded independently and concatenated in order. The buffer 
+  should have room for 10 bytes per node.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_AigerWriteAndSegment( Gia_Man_t * p, int iStart, int iStop, unsigned char * pBuffer )
+{
+    Gia_Obj_t * pObj;
+    unsigned uLit0, uLit1, uLit;
+    int i, Pos = 0;
+    for ( i = iStart; i < iStop; i++ )
+    {
+        pObj = Gia_ManObj( p, i );
+        if ( !Gia_ObjIsAnd(pObj) )
+            continue;
+        uLit  = Abc_Var2Lit( i, 0 );
+        uLit0 = Gia_ObjFaninLit0( pObj, i );
+        uLit1 = Gia_ObjFaninLit1( pObj, i );
+        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
+        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
+        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
+    }
+    return Pos;
+}
+void * Gia_AigerWriteAndSegmentThread( void * pArg )
+{
+    Gia_AigerSeg_t * pSeg = (Gia_AigerSeg_t *)pArg;
+    pSeg->nBytes = Gia_AigerWriteAndSegment( pSeg->p, pSeg->iStart, pSeg->iStop, pSeg->pBuffer );
+    return NULL;
+}
+void Gia_AigerWriteAnds( Gia_AigerOut_t * pOut, Gia_Man_t * p, int nProcs )
+{
+    Gia_AigerSeg_t Segs[GIA_AIGER_THR_MAX];
+    int i, k, nSegs, iFirst = 1 + Gia_ManCiNum(p), iLast = Gia_ManObjNum(p) - Gia_ManCoNum(p);
+    nProcs = Abc_MinInt( Abc_MaxInt(nProcs, 1), GIA_AIGER_THR_MAX );
+#ifndef ABC_USE_PTHREADS
+    nProcs = 1;
+#endif
+    for ( k = 0; k < nProcs; k++ )
+    {
+        Segs[k].p       = p;
+        Segs[k].pBuffer = ABC_ALLOC( unsigned char, 10 * GIA_AIGER_SEG_SIZE );
+    }
+    for ( i = iFirst; i < iLast; i += nSegs * GIA_AIGER_SEG_SIZE )
+    {
+        nSegs = Abc_MinInt( nProcs, (iLast - i + GIA_AIGER_SEG_SIZE - 1) / GIA_AIGER_SEG_SIZE );
+        for ( k = 0; k < nSegs; k++ )
+        {
+            Segs[k].iStart = i + k * GIA_AIGER_SEG_SIZE;
+            Segs[k].iStop  = Abc_MinInt( Segs[k].iStart + GIA_AIGER_SEG_SIZE, iLast );
+        }
+#ifdef ABC_USE_PTHREADS
+        if ( nSegs > 1 )
+        {
+            pthread_t WorkerThread[GIA_AIGER_THR_MAX];
+            int status;
+            for ( k = 1; k < nSegs; k++ )
+            {
+                status = pthread_create( WorkerThread + k, NULL, Gia_AigerWriteAndSegmentThread, (void *)(Segs + k) );  
+                assert( status == 0 );
+            }
+            Gia_AigerWriteAndSegmentThread( (void *)Segs );
+            for ( k = 1; k < nSegs; k++ )
+                pthread_join( WorkerThread[k], NULL );
+        }
+        else
+#endif
+            Gia_AigerWriteAndSegmentThread( (void *)Segs );
+        for ( k = 0; k < nSegs; k++ )
+            Gia_AigerOutWrite( pOut, Segs[k].pBuffer, Segs[k].nBytes );
+    }
+    for ( k = 0; k < nProcs; k++ )
+        ABC_FREE( Segs[k].pBuffer );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Create the array of literals to be written.]
@@ -173,7 +405,7 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, word nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Ptr_t * vNamesIn = NULL, * vNamesOut = NULL, * vNamesRegIn = NULL, * vNamesRegOut = NULL, * vNamesNode = NULL;
@@ -244,6 +476,15 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         fprintf( stdout, "Reading AIGER files with liveness properties is currently not supported.\n" );
         return NULL;
     }
+    if ( (word)nTotal + nLatches + nOutputs + 1 > (word)GIA_OBJ_MAX )
+    {
+#ifdef ABC_USE_GIA_WIDE
+        fprintf( stdout, "The number of objects (%.0f) exceeds the limit (%d).\n", (double)nTotal + nLatches + nOutputs + 1, GIA_OBJ_MAX );
+#else
+        fprintf( stdout, "The number of objects (%.0f) exceeds the limit (%d). Recompile with ABC_USE_GIA_WIDE=1.\n", (double)nTotal + nLatches + nOutputs + 1, GIA_OBJ_MAX );
+#endif
+        return NULL;
+    }
 
     if ( nConstr )
     {
@@ -1005,7 +1246,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 
 /**Function*************************************************************
 
-  Synopsis    [Reads the AIG in the binary AIGER format.]
+  Synopsis    [Reads the contents of a gzip-compressed file.]
 
   Description []
   
@@ -1014,24 +1255,140 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+char * Gia_FileReadGz( char * pFileName, word * pnFileSize )
+{
+    size_t nCap = (1 << 20), nSize = 0;
+    int nRead;
+    char * pContents;
+    gzFile pFile = gzopen( pFileName, "rb" );
+    *pnFileSize = 0;
+    if ( pFile == NULL )
+        return NULL;
+    pContents = ABC_ALLOC( char, nCap + 1 );
+    // gzread() takes an unsigned length and returns an int, so read in chunks of at most 1 GB
+    while ( (nRead = gzread( pFile, pContents + nSize, (unsigned)Abc_MinWord(nCap - nSize, (word)1 << 30) )) > 0 )
+    {
+        nSize += (size_t)nRead;
+        if ( nSize < nCap )
+            continue;
+        nCap *= 2;
+        pContents = ABC_REALLOC( char, pContents, nCap + 1 );
+    }
+    gzclose( pFile );
+    if ( nRead < 0 )
+    {
+        printf( "Gia_FileReadGz(): Decompressing file \"%s\" has failed.\n", pFileName );
+        ABC_FREE( pContents );
+        return NULL;
+    }
+    pContents[nSize] = 0;
+    *pnFileSize = (word)nSize;
+    return pContents;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [Returns a private copy-on-write mapping of the file, which 
+  is followed by at least one zero byte, so that the parser never runs past 
+  the mapped range. Only the pages modified by the parser (such as the lines
+  of the symbol table) are copied; the binary AND section is decoded in place.
+  Falls back to reading the file into a heap buffer if mapping fails, in which 
+  case the returned map size is 0.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_FileMap( char * pFileName, word * pnFileSize, size_t * pnMapSize )
 {
     FILE * pFile;
+    char * pContents;
+    int RetValue;
+    *pnMapSize = 0;
+    if ( Gia_FileNameIsGz(pFileName) )
+        return Gia_FileReadGz( pFileName, pnFileSize );
+    *pnFileSize = Gia_FileSize( pFileName );
+#ifdef GIA_AIGER_USE_MMAP
+    {
+        int fd = open( pFileName, O_RDONLY );
+        if ( fd >= 0 && *pnFileSize > 0 )
+        {
+            size_t nPage = (size_t)sysconf( _SC_PAGESIZE );
+            size_t nMapSize = ((size_t)*pnFileSize / nPage + 1) * nPage;
+            // reserve zero-filled memory and place the file over its beginning
+            void * pBase = mmap( NULL, nMapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+            if ( pBase != MAP_FAILED )
+            {
+                if ( mmap( pBase, (size_t)*pnFileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0 ) != MAP_FAILED )
+                {
+#ifdef MADV_SEQUENTIAL
+                    madvise( pBase, (size_t)*pnFileSize, MADV_SEQUENTIAL );
+#endif
+                    close( fd );
+                    *pnMapSize = nMapSize;
+                    return (char *)pBase;
+                }
+                munmap( pBase, nMapSize );
+            }
+        }
+        if ( fd >= 0 )
+            close( fd );
+    }
+#endif
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    pContents = ABC_CALLOC( char, (size_t)*pnFileSize + 1 );
+    RetValue = fread( pContents, (size_t)*pnFileSize, 1, pFile );
+    fclose( pFile );
+    return pContents;
+}
+void Gia_FileUnmap( char * pContents, size_t nMapSize )
+{
+#ifdef GIA_AIGER_USE_MMAP
+    if ( nMapSize )
+    {
+        munmap( pContents, nMapSize );
+        return;
+    }
+#endif
+    ABC_FREE( pContents );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format.]
+
+  Description [The file is mapped into memory rather than copied into 
+  a buffer. If fVerbose is set, prints the load throughput.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_AigerReadVerbose( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int fVerbose )
+{
     Gia_Man_t * pNew;
     char * pName, * pContents;
-    int nFileSize;
-    int RetValue;
+    word nFileSize;
+    size_t nMapSize;
+    abctime clk = Abc_Clock();
 
-    // read the file into the buffer
+    // map the file into memory
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
+    pContents = Gia_FileMap( pFileName, &nFileSize, &nMapSize );
+    if ( pContents == NULL )
+    {
+        printf( "Cannot open input file \"%s\".\n", pFileName );
+        return NULL;
+    }
 
     pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    Gia_FileUnmap( pContents, nMapSize );
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
@@ -1042,8 +1399,19 @@ Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, in
         assert( pNew->pSpec == NULL );
         pNew->pSpec = Abc_UtilStrsav( pFileName );
     }
+    if ( fVerbose && pNew )
+    {
+        double Time = Abc_MaxDouble( 1.0*(Abc_Clock() - clk)/CLOCKS_PER_SEC, 1e-6 );
+        printf( "Loaded %.2f MB (%s) with %d objects in %.2f sec: %.2f MB/sec, %.2f Mobj/sec.\n", 
+            1.0*nFileSize/(1<<20), nMapSize ? "mapped" : "buffered", Gia_ManObjNum(pNew), 
+            Time, 1.0*nFileSize/(1<<20)/Time, 1.0*Gia_ManObjNum(pNew)/1000000/Time );
+    }
     return pNew;
 }
+Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadVerbose( pFileName, fGiaSimple, fSkipStrash, fCheck, 0 );
+}
 
 
 
@@ -1210,23 +1578,25 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
 
   Synopsis    [Writes the AIG in the binary AIGER format.]
 
-  Description []
+  Description [The AND nodes are encoded in segments by nProcs threads 
+  and streamed into the file through a fixed-size buffer. The output is 
+  compressed if the file name ends in ".gz".]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment )
+void Gia_AigerWriteP( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment, int nProcs, int fVerbose )
 {
-    int fVerbose = XAIG_VERBOSE;
-    FILE * pFile;
+    int fVerboseExt = XAIG_VERBOSE;
+    abctime clk = Abc_Clock();
+    Gia_AigerOut_t * pFile;
+    word nBytes;
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
     Vec_Str_t * vStrExt;
-    int i, nBufferSize, Pos;
-    unsigned char * pBuffer;
-    unsigned uLit0, uLit1, uLit;
+    int i;
     assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
 
     if ( Gia_ManCoNum(pInit) == 0 )
@@ -1236,7 +1606,7 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     }
 
     // start the output stream
-    pFile = fopen( pFileName, "wb" );
+    pFile = Gia_AigerOutStart( pFileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Gia_AigerWrite(): Cannot open the output file \"%s\".\n", pFileName );
@@ -1257,7 +1627,7 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         p = pInit;
 
     // write the header "M I L O A" where M = I + L + A
-    fprintf( pFile, "aig%s %u %u %u %u %u", 
+    Gia_AigerOutPrintf( pFile, "aig%s %u %u %u %u %u", 
         fCompact? "2" : "",
         Gia_ManCiNum(p) + Gia_ManAndNum(p), 
         Gia_ManPiNum(p),
@@ -1266,55 +1636,31 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         Gia_ManAndNum(p) );
     // write the extended header "B C J F"
     if ( Gia_ManConstrNum(p) )
-        fprintf( pFile, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
-    fprintf( pFile, "\n" ); 
+        Gia_AigerOutPrintf( pFile, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
+    Gia_AigerOutPrintf( pFile, "\n" ); 
 
     Gia_ManInvertConstraints( p );
     if ( !fCompact ) 
     {
         // write latch drivers
         Gia_ManForEachRi( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
         // write PO drivers
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
     }
     else
     {
         Vec_Int_t * vLits = Gia_AigerCollectLiterals( p );
         Vec_Str_t * vBinary = Gia_AigerWriteLiterals( vLits );
-        fwrite( Vec_StrArray(vBinary), 1, Vec_StrSize(vBinary), pFile );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vBinary), Vec_StrSize(vBinary) );
         Vec_StrFree( vBinary );
         Vec_IntFree( vLits );
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
-    Gia_ManForEachAnd( p, pObj, i )
-    {
-        uLit  = Abc_Var2Lit( i, 0 );
-        uLit0 = Gia_ObjFaninLit0( pObj, i );
-        uLit1 = Gia_ObjFaninLit1( pObj, i );
-        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
-        {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
-        }
-    }
-    assert( Pos < nBufferSize );
-
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
+    // write the nodes in segments
+    Gia_AigerWriteAnds( pFile, p, nProcs );
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1323,13 +1669,13 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         assert( Vec_PtrSize(p->vNamesOut) == Gia_ManCoNum(p) );
         // write PIs
         Gia_ManForEachPi( p, pObj, i )
-            fprintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
+            Gia_AigerOutPrintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
         // write latches
         Gia_ManForEachRo( p, pObj, i )
-            fprintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
+            Gia_AigerOutPrintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
         // write POs
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
+            Gia_AigerOutPrintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
     }
     if ( p->vNamesNode && Vec_PtrSize(p->vNamesNode) != Gia_ManObjNum(p) )
         Abc_Print( 0, "The size of the node name array does not match the number of objects. Names are not written.\n" );
@@ -1337,38 +1683,38 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     {
         Gia_ManForEachAnd( p, pObj, i )
             if ( Vec_PtrEntry(p->vNamesNode, i) )
-                fprintf( pFile, "n%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesNode, i) );
+                Gia_AigerOutPrintf( pFile, "n%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesNode, i) );
     }
 
     // write the comment
     if ( fWriteNewLine ) 
-        fprintf( pFile, "c\n" );
+        Gia_AigerOutPrintf( pFile, "c\n" );
     else
-        fprintf( pFile, "c" );
+        Gia_AigerOutPrintf( pFile, "c" );
 
     // write additional AIG
     if ( p->pAigExtra )
     {
-        fprintf( pFile, "a" );
+        Gia_AigerOutPrintf( pFile, "a" );
         vStrExt = Gia_AigerWriteIntoMemoryStr( p->pAigExtra );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
-        if ( fVerbose ) printf( "Finished writing extension \"a\".\n" );
+        if ( fVerboseExt ) printf( "Finished writing extension \"a\".\n" );
     }
     // write constraints
     if ( p->nConstrs )
     {
-        fprintf( pFile, "c" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nConstrs );
+        Gia_AigerOutPrintf( pFile, "c" );
+        Gia_AigerOutWriteBufferSize( pFile, 4 );
+        Gia_AigerOutWriteBufferSize( pFile, p->nConstrs );
     }
     // write timing information
     if ( p->nAnd2Delay )
     {
-        fprintf( pFile, "d" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nAnd2Delay );
+        Gia_AigerOutPrintf( pFile, "d" );
+        Gia_AigerOutWriteBufferSize( pFile, 4 );
+        Gia_AigerOutWriteBufferSize( pFile, p->nAnd2Delay );
     }
     if ( p->pManTime )
     {
@@ -1376,79 +1722,79 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         pTimes = Tim_ManGetArrTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "i" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerOutPrintf( pFile, "i" );
+            Gia_AigerOutWriteBufferSize( pFile, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerOutWrite( pFile, pTimes, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
-            if ( fVerbose ) printf( "Finished writing extension \"i\".\n" );
+            if ( fVerboseExt ) printf( "Finished writing extension \"i\".\n" );
         }
         pTimes = Tim_ManGetReqTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "o" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerOutPrintf( pFile, "o" );
+            Gia_AigerOutWriteBufferSize( pFile, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerOutWrite( pFile, pTimes, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
-            if ( fVerbose ) printf( "Finished writing extension \"o\".\n" );
+            if ( fVerboseExt ) printf( "Finished writing extension \"o\".\n" );
         }
     }
     // write equivalences
     if ( p->pReprs && p->pNexts )
     {
         extern Vec_Str_t * Gia_WriteEquivClasses( Gia_Man_t * p );
-        fprintf( pFile, "e" );
+        Gia_AigerOutPrintf( pFile, "e" );
         vStrExt = Gia_WriteEquivClasses( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
     // write flop classes
     if ( p->vFlopClasses )
     {
-        fprintf( pFile, "f" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManRegNum(p) );
+        Gia_AigerOutPrintf( pFile, "f" );
+        Gia_AigerOutWriteBufferSize( pFile, 4*Gia_ManRegNum(p) );
         assert( Vec_IntSize(p->vFlopClasses) == Gia_ManRegNum(p) );
-        fwrite( Vec_IntArray(p->vFlopClasses), 1, 4*Gia_ManRegNum(p), pFile );
+        Gia_AigerOutWrite( pFile, Vec_IntArray(p->vFlopClasses), 4*Gia_ManRegNum(p) );
     }
     // write gate classes
     if ( p->vGateClasses )
     {
-        fprintf( pFile, "g" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pFile, "g" );
+        Gia_AigerOutWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vGateClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vGateClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pFile, Vec_IntArray(p->vGateClasses), 4*Gia_ManObjNum(p) );
     }
     // write hierarchy info
     if ( p->pManTime )
     {
-        fprintf( pFile, "h" );
+        Gia_AigerOutPrintf( pFile, "h" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 1 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
-        if ( fVerbose ) printf( "Finished writing extension \"h\".\n" );
+        if ( fVerboseExt ) printf( "Finished writing extension \"h\".\n" );
     }
     // write packing
     if ( p->vPacking )
     {
         extern Vec_Str_t * Gia_WritePacking( Vec_Int_t * vPacking );
-        fprintf( pFile, "k" );
+        Gia_AigerOutPrintf( pFile, "k" );
         vStrExt = Gia_WritePacking( p->vPacking );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
-        if ( fVerbose ) printf( "Finished writing extension \"k\".\n" );
+        if ( fVerboseExt ) printf( "Finished writing extension \"k\".\n" );
     }
     // write edges
     if ( p->vEdge1 )
     {
         Vec_Int_t * vPairs = Gia_ManEdgeToArray( p );
         int i;
-        fprintf( pFile, "w" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(vPairs)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(vPairs)/2 );
+        Gia_AigerOutPrintf( pFile, "w" );
+        Gia_AigerOutWriteBufferSize( pFile, 4*(Vec_IntSize(vPairs)+1) );
+        Gia_AigerOutWriteBufferSize( pFile, Vec_IntSize(vPairs)/2 );
         for ( i = 0; i < Vec_IntSize(vPairs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(vPairs, i) );
+            Gia_AigerOutWriteBufferSize( pFile, Vec_IntEntry(vPairs, i) );
         Vec_IntFree( vPairs );
     }
     // write mapping
@@ -1457,129 +1803,140 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         extern Vec_Str_t * Gia_AigerWriteMapping( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingSimple( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingDoc( Gia_Man_t * p );
-        fprintf( pFile, "m" );
+        Gia_AigerOutPrintf( pFile, "m" );
         vStrExt = Gia_AigerWriteMappingDoc( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
-        if ( fVerbose ) printf( "Finished writing extension \"m\".\n" );
+        if ( fVerboseExt ) printf( "Finished writing extension \"m\".\n" );
     }
     // write cell mapping
     if ( Gia_ManHasCellMapping(p) )
     {
         extern Vec_Str_t * Gia_AigerWriteCellMappingDoc( Gia_Man_t * p );
-        fprintf( pFile, "M" );
+        Gia_AigerOutPrintf( pFile, "M" );
         vStrExt = Gia_AigerWriteCellMappingDoc( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
-        if ( fVerbose ) printf( "Finished writing extension \"M\".\n" );
+        if ( fVerboseExt ) printf( "Finished writing extension \"M\".\n" );
 
     }
     // write placement
     if ( p->pPlacement )
     {
-        fprintf( pFile, "p" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
-        fwrite( p->pPlacement, 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pFile, "p" );
+        Gia_AigerOutWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pFile, p->pPlacement, 4*Gia_ManObjNum(p) );
     }
     // write register classes
     if ( p->vRegClasses )
     {
         int i;
-        fprintf( pFile, "r" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegClasses)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegClasses) );
+        Gia_AigerOutPrintf( pFile, "r" );
+        Gia_AigerOutWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegClasses)+1) );
+        Gia_AigerOutWriteBufferSize( pFile, Vec_IntSize(p->vRegClasses) );
         for ( i = 0; i < Vec_IntSize(p->vRegClasses); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegClasses, i) );
+            Gia_AigerOutWriteBufferSize( pFile, Vec_IntEntry(p->vRegClasses, i) );
     }
     // write register inits
     if ( p->vRegInits )
     {
         int i;
-        fprintf( pFile, "s" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegInits)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegInits) );
+        Gia_AigerOutPrintf( pFile, "s" );
+        Gia_AigerOutWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegInits)+1) );
+        Gia_AigerOutWriteBufferSize( pFile, Vec_IntSize(p->vRegInits) );
         for ( i = 0; i < Vec_IntSize(p->vRegInits); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegInits, i) );
+            Gia_AigerOutWriteBufferSize( pFile, Vec_IntEntry(p->vRegInits, i) );
     }
     // write configuration data
     if ( p->vConfigs )
     {
-        fprintf( pFile, "b" );
+        Gia_AigerOutPrintf( pFile, "b" );
         assert( p->pCellStr != NULL );
-        Gia_FileWriteBufferSize( pFile, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
-        fwrite( p->pCellStr, 1, strlen(p->pCellStr) + 1, pFile );
-//        fwrite( Vec_IntArray(p->vConfigs), 1, 4*Vec_IntSize(p->vConfigs), pFile );
+        Gia_AigerOutWriteBufferSize( pFile, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
+        Gia_AigerOutWrite( pFile, p->pCellStr, strlen(p->pCellStr) + 1 );
+//        Gia_AigerOutWrite( pFile, Vec_IntArray(p->vConfigs), 4*Vec_IntSize(p->vConfigs) );
         for ( i = 0; i < Vec_IntSize(p->vConfigs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vConfigs, i) );
+            Gia_AigerOutWriteBufferSize( pFile, Vec_IntEntry(p->vConfigs, i) );
     }
     // write choices
     if ( Gia_ManHasChoices(p) )
     {
         int i, nPairs = 0;
-        fprintf( pFile, "q" );
+        Gia_AigerOutPrintf( pFile, "q" );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             nPairs += (Gia_ObjSibl(p, i) > 0);
-        Gia_FileWriteBufferSize( pFile, 4*(nPairs * 2 + 1) );
-        Gia_FileWriteBufferSize( pFile, nPairs );
+        Gia_AigerOutWriteBufferSize( pFile, 4*(nPairs * 2 + 1) );
+        Gia_AigerOutWriteBufferSize( pFile, nPairs );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             if ( Gia_ObjSibl(p, i) )
             {
                 assert( i > Gia_ObjSibl(p, i) );
-                Gia_FileWriteBufferSize( pFile, i );
-                Gia_FileWriteBufferSize( pFile, Gia_ObjSibl(p, i) );
+                Gia_AigerOutWriteBufferSize( pFile, i );
+                Gia_AigerOutWriteBufferSize( pFile, Gia_ObjSibl(p, i) );
             }
-        if ( fVerbose ) printf( "Finished writing extension \"q\".\n" );
+        if ( fVerboseExt ) printf( "Finished writing extension \"q\".\n" );
     }
     // write switching activity
     if ( p->pSwitching )
     {
-        fprintf( pFile, "u" );
-        Gia_FileWriteBufferSize( pFile, Gia_ManObjNum(p) );
-        fwrite( p->pSwitching, 1, Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pFile, "u" );
+        Gia_AigerOutWriteBufferSize( pFile, Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pFile, p->pSwitching, Gia_ManObjNum(p) );
     }
 /*
     // write timing information
     if ( p->pManTime )
     {
-        fprintf( pFile, "t" );
+        Gia_AigerOutPrintf( pFile, "t" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 0 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
 */
     // write object classes
     if ( p->vObjClasses )
     {
-        fprintf( pFile, "v" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pFile, "v" );
+        Gia_AigerOutWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vObjClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vObjClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pFile, Vec_IntArray(p->vObjClasses), 4*Gia_ManObjNum(p) );
     }
     // write name
     if ( p->pName )
     {
-        fprintf( pFile, "n" );
-        Gia_FileWriteBufferSize( pFile, strlen(p->pName)+1 );
-        fwrite( p->pName, 1, strlen(p->pName), pFile );
-        fprintf( pFile, "%c", '\0' );
+        Gia_AigerOutPrintf( pFile, "n" );
+        Gia_AigerOutWriteBufferSize( pFile, strlen(p->pName)+1 );
+        Gia_AigerOutWrite( pFile, p->pName, strlen(p->pName) );
+        Gia_AigerOutPrintf( pFile, "%c", '\0' );
     }
     // write comments
     if ( fWriteNewLine )
-        fprintf( pFile, "c\n" );
+        Gia_AigerOutPrintf( pFile, "c\n" );
     if ( !fSkipComment ) {
-        fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
-        fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+        Gia_AigerOutPrintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
+        Gia_AigerOutPrintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+    }
+    nBytes = Gia_AigerOutStop( pFile );
+    if ( fVerbose )
+    {
+        double Time = Abc_MaxDouble( 1.0*(Abc_Clock() - clk)/CLOCKS_PER_SEC, 1e-6 );
+        printf( "Written %.2f MB%s with %d objects using %d thread%s in %.2f sec: %.2f MB/sec.\n", 
+            1.0*nBytes/(1<<20), Gia_FileNameIsGz(pFileName) ? " (before compression)" : "", Gia_ManObjNum(p), 
+            nProcs, nProcs > 1 ? "s" : "", Time, 1.0*nBytes/(1<<20)/Time );
     }
-    fclose( pFile );
     if ( p != pInit )
     {
         Gia_ManTransferTiming( pInit, p );
         Gia_ManStop( p );
     }
 }
+void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment )
+{
+    Gia_AigerWriteP( pInit, pFileName, fWriteSymbols, fCompact, fWriteNewLine, fSkipComment, 1, 0 );
+}
 
 /**Function*************************************************************
 
@@ -1709,7 +1709,7 @@ void Gia_ManArePrintReport( Gia_ManAre_t * p, abctime Time, int fFinal )
 ***********************************************************************/
 int Gia_ManArePerform( Gia_Man_t * pAig, int nStatesMax, int fMiter, int fVerbose )
 {
-//    extern Gia_Man_t * Gia_ManCompress2( Gia_Man_t * p, int fUpdateLevel, int fVerbose );
+//    extern Gia_Man_t * Gia_ManCompress2( Gia_Man_t * p, int fUpdateLevel, int nProcs, int fVerbose );
     extern Abc_Cex_t * Gia_ManAreDeriveCex( Gia_ManAre_t * p, Gia_StaAre_t * pLast );
     Gia_ManAre_t * p;
     abctime clk = Abc_Clock();
@@ -1720,7 +1720,7 @@ int Gia_ManArePerform( Gia_Man_t * pAig, int nStatesMax, int fMiter, int fVerbos
         return -1;
     }
     ABC_FREE( pAig->pCexSeq );
-//    p = Gia_ManAreCreate( Gia_ManCompress2(pAig, 0, 0) );
+//    p = Gia_ManAreCreate( Gia_ManCompress2(pAig, 0, 1, 0) );
     p = Gia_ManAreCreate( Gia_ManDup(pAig) );
     p->fMiter = fMiter;
     Gia_ManAreCubeProcess( p, Gia_ManAreCreateStaInit(p) );
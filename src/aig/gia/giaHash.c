@@ -20,6 +20,24 @@
 
 #include "gia.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#include <stdbool.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -478,7 +496,7 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
         return 0;
     if ( iLit0 == Abc_LitNot(iLit1) )
         return 1;
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
+    if ( (p->nObjs & 0xFF) == 0 && 2 * (word)Vec_IntSize(&p->vHTable) < (word)Gia_ManAndNum(p) )
         Gia_ManHashResize( p );
     if ( iLit0 < iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
@@ -588,7 +606,7 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
         assert( Vec_IntSize(&p->vHTable) == 0 );
         return Gia_ManAppendAnd( p, iLit0, iLit1 );
     }
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
+    if ( (p->nObjs & 0xFF) == 0 && 2 * (word)Vec_IntSize(&p->vHTable) < (word)Gia_ManAndNum(p) )
         Gia_ManHashResize( p );
     if ( p->fAddStrash )
     {
@@ -769,6 +787,263 @@ Gia_Man_t * Gia_ManRehash( Gia_Man_t * p, int fAddStrash )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded rehashing of AIG.]
+
+  Description [Produces exactly the same AIG as Gia_ManRehash( p, 0 ).
+  The AND nodes are processed level by level. Inside a level, the threads 
+  concurrently look up the structural classes of the nodes in a lock-free 
+  open-addressed table, whose keys are pairs of fanin class literals. 
+  A class is identified by the node that inserted its key. The new AIG is 
+  then built by one pass over the objects in the original order, which 
+  creates a node for the first member of each class, exactly as the 
+  sequential procedure would do, but without hashing.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+Gia_Man_t * Gia_ManRehashMt( Gia_Man_t * p, int nProcs, int fVerbose )
+{
+    return Gia_ManRehash( p, 0 );
+}
+
+#else // pthreads are used
+
+#define GIA_STR_THR_MAX 100
+
+typedef struct Gia_StrMan_t_ Gia_StrMan_t;
+struct Gia_StrMan_t_
+{
+    Gia_Man_t *      p;           // the AIG being rehashed
+    int *            pClass;      // class literal of each object
+    atomic_ullong *  pKeys;       // table keys (ordered pairs of fanin class literals)
+    atomic_int *     pOwner;      // the node that inserted each key
+    word             TableMask;   // table size minus one
+};
+typedef struct Gia_StrThData_t_
+{
+    Gia_StrMan_t *   pMan;
+    int *            pNodes;      // nodes to process
+    int              nNodes;      // the number of nodes (-1 to stop)
+    atomic_bool      fWorking;
+} Gia_StrThData_t;
+
+static inline word Gia_StrHashKey( word Key )
+{
+    Key ^= Key >> 29;
+    Key *= ABC_CONST(0x9E3779B97F4A7C15);
+    return Key ^ (Key >> 32);
+}
+static inline int Gia_StrTableLookup( Gia_StrMan_t * p, word Key, int iObj )
+{
+    word h = Gia_StrHashKey( Key ) & p->TableMask;
+    while ( 1 )
+    {
+        unsigned long long Cur = atomic_load_explicit( &p->pKeys[h], memory_order_acquire );
+        if ( Cur == 0 )
+        {
+            if ( atomic_compare_exchange_strong( &p->pKeys[h], &Cur, (unsigned long long)Key ) )
+            {
+                atomic_store_explicit( &p->pOwner[h], iObj, memory_order_release );
+                return iObj;
+            }
+            // another thread took this slot; Cur now holds its key
+        }
+        if ( Cur == Key )
+        {
+            int iOwner;
+            // the owner is published right after its key
+            while ( (iOwner = atomic_load_explicit( &p->pOwner[h], memory_order_acquire )) == 0 );
+            return iOwner;
+        }
+        h = (h + 1) & p->TableMask;
+    }
+    return -1;
+}
+static inline void Gia_StrProcessNode( Gia_StrMan_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->p, iObj );
+    int iLit0 = Abc_LitNotCond( p->pClass[Gia_ObjFaninId0(pObj, iObj)], Gia_ObjFaninC0(pObj) );
+    int iLit1 = Abc_LitNotCond( p->pClass[Gia_ObjFaninId1(pObj, iObj)], Gia_ObjFaninC1(pObj) );
+    // the same trivial cases as in Gia_ManHashAnd()
+    if ( iLit0 < 2 )
+        p->pClass[iObj] = iLit0 ? iLit1 : 0;
+    else if ( iLit1 < 2 )
+        p->pClass[iObj] = iLit1 ? iLit0 : 0;
+    else if ( iLit0 == iLit1 )
+        p->pClass[iObj] = iLit1;
+    else if ( iLit0 == Abc_LitNot(iLit1) )
+        p->pClass[iObj] = 0;
+    else
+    {
+        if ( iLit0 > iLit1 )
+            iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+        p->pClass[iObj] = Abc_Var2Lit( Gia_StrTableLookup(p, ((word)iLit1 << 32) | (word)iLit0, iObj), 0 );
+    }
+}
+void * Gia_StrWorkerThread( void * pArg )
+{
+    Gia_StrThData_t * pThData = (Gia_StrThData_t *)pArg;
+    int k;
+    while ( 1 )
+    {
+        while ( !atomic_load_explicit( &pThData->fWorking, memory_order_acquire ) );
+        if ( pThData->nNodes == -1 )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        for ( k = 0; k < pThData->nNodes; k++ )
+            Gia_StrProcessNode( pThData->pMan, pThData->pNodes[k] );
+        atomic_store_explicit( &pThData->fWorking, false, memory_order_release );
+    }
+    assert( 0 );
+    return NULL;
+}
+Gia_Man_t * Gia_ManRehashMt( Gia_Man_t * p, int nProcs, int fVerbose )
+{
+    pthread_t WorkerThread[GIA_STR_THR_MAX];
+    Gia_StrThData_t ThData[GIA_STR_THR_MAX];
+    Gia_StrMan_t Man, * pMan = &Man;
+    Gia_Man_t * pNew, * pTemp;
+    Gia_Obj_t * pObj;
+    int * pLevels, * pStarts, * pOrder, * pNewLits;
+    int i, k, iLevel, nLevels = 0, nTableSize = 1024, status;
+    abctime clk = Abc_Clock(), clkLevel, clkClass, clkBuild;
+    if ( nProcs <= 1 || p->pMuxes )
+        return Gia_ManRehash( p, 0 );
+    nProcs = Abc_MinInt( nProcs, GIA_STR_THR_MAX );
+    // sort AND nodes by level
+    pLevels = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        pLevels[i] = 1 + Abc_MaxInt( pLevels[Gia_ObjFaninId0(pObj, i)], pLevels[Gia_ObjFaninId1(pObj, i)] );
+        nLevels = Abc_MaxInt( nLevels, pLevels[i] );
+    }
+    pStarts = ABC_CALLOC( int, nLevels + 2 );
+    Gia_ManForEachAnd( p, pObj, i )
+        pStarts[pLevels[i] + 1]++;
+    for ( k = 1; k <= nLevels + 1; k++ )
+        pStarts[k] += pStarts[k-1];
+    pOrder = ABC_ALLOC( int, Gia_ManAndNum(p) + 1 );
+    Gia_ManForEachAnd( p, pObj, i )
+        pOrder[pStarts[pLevels[i]]++] = i;
+    // restore the level boundaries, which were shifted while filling
+    for ( k = nLevels + 1; k > 0; k-- )
+        pStarts[k] = pStarts[k-1];
+    pStarts[0] = 0;
+    ABC_FREE( pLevels );
+    clkLevel = Abc_Clock() - clk;
+    // start the table
+    while ( nTableSize < 2 * Gia_ManAndNum(p) )
+        nTableSize *= 2;
+    pMan->p         = p;
+    pMan->pClass    = ABC_ALLOC( int, Gia_ManObjNum(p) );
+    pMan->pKeys     = (atomic_ullong *)ABC_CALLOC( word, nTableSize );
+    pMan->pOwner    = (atomic_int *)ABC_CALLOC( int, nTableSize );
+    pMan->TableMask = nTableSize - 1;
+    pMan->pClass[0] = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pMan->pClass[Gia_ObjId(p, pObj)] = Abc_Var2Lit( Gia_ObjId(p, pObj), 0 );
+    // start the threads (the main thread processes the first chunk)
+    for ( i = 1; i < nProcs; i++ )
+    {
+        ThData[i].pMan   = pMan;
+        ThData[i].pNodes = NULL;
+        ThData[i].nNodes = 0;
+        atomic_store_explicit( &ThData[i].fWorking, false, memory_order_release );
+        status = pthread_create( WorkerThread + i, NULL, Gia_StrWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    // compute classes level by level
+    clk = Abc_Clock();
+    for ( iLevel = 1; iLevel <= nLevels; iLevel++ )
+    {
+        int * pNodes = pOrder + pStarts[iLevel];
+        int nNodes = pStarts[iLevel+1] - pStarts[iLevel];
+        int nChunk = (nNodes + nProcs - 1) / nProcs;
+        if ( nNodes < 64 * nProcs )
+        {
+            // small levels are cheaper to process without synchronization
+            for ( k = 0; k < nNodes; k++ )
+                Gia_StrProcessNode( pMan, pNodes[k] );
+            continue;
+        }
+        for ( i = 1; i < nProcs; i++ )
+        {
+            ThData[i].pNodes = pNodes + Abc_MinInt( i * nChunk, nNodes );
+            ThData[i].nNodes = Abc_MinInt( nChunk, nNodes - Abc_MinInt( i * nChunk, nNodes ) );
+            atomic_store_explicit( &ThData[i].fWorking, true, memory_order_release );
+        }
+        for ( k = 0; k < nChunk; k++ )
+            Gia_StrProcessNode( pMan, pNodes[k] );
+        for ( i = 1; i < nProcs; i++ )
+            while ( atomic_load_explicit( &ThData[i].fWorking, memory_order_acquire ) );
+    }
+    // stop the threads
+    for ( i = 1; i < nProcs; i++ )
+    {
+        ThData[i].nNodes = -1;
+        atomic_store_explicit( &ThData[i].fWorking, true, memory_order_release );
+    }
+    for ( i = 1; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    clkClass = Abc_Clock() - clk;
+    // build the new AIG in the original order
+    clk = Abc_Clock();
+    pNewLits = ABC_FALLOC( int, Gia_ManObjNum(p) );
+    pNewLits[0] = 0;
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            int iClass = Abc_Lit2Var( pMan->pClass[i] );
+            if ( pNewLits[iClass] == -1 )
+            {
+                // the first member of its class creates the node
+                int iLit0 = Abc_LitNotCond( pNewLits[Abc_Lit2Var(pMan->pClass[Gia_ObjFaninId0(pObj, i)])], Abc_LitIsCompl(pMan->pClass[Gia_ObjFaninId0(pObj, i)]) ^ Gia_ObjFaninC0(pObj) );
+                int iLit1 = Abc_LitNotCond( pNewLits[Abc_Lit2Var(pMan->pClass[Gia_ObjFaninId1(pObj, i)])], Abc_LitIsCompl(pMan->pClass[Gia_ObjFaninId1(pObj, i)]) ^ Gia_ObjFaninC1(pObj) );
+                assert( !Abc_LitIsCompl(pMan->pClass[i]) );
+                pNewLits[iClass] = Gia_ManAppendAnd( pNew, iLit0, iLit1 );
+            }
+            pObj->Value = Abc_LitNotCond( pNewLits[iClass], Abc_LitIsCompl(pMan->pClass[i]) );
+        }
+        else if ( Gia_ObjIsCi(pObj) )
+            pObj->Value = pNewLits[i] = Gia_ManAppendCi( pNew );
+        else if ( Gia_ObjIsCo(pObj) )
+            pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    }
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    clkBuild = Abc_Clock() - clk;
+    ABC_FREE( pNewLits );
+    ABC_FREE( pMan->pClass );
+    ABC_FREE( pMan->pKeys );
+    ABC_FREE( pMan->pOwner );
+    ABC_FREE( pStarts );
+    ABC_FREE( pOrder );
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    if ( fVerbose )
+    {
+        printf( "Rehashed %d nodes on %d levels using %d threads (table size %d).\n", Gia_ManAndNum(p), nLevels, nProcs, nTableSize );
+        Abc_PrintTime( 1, "Levelizing", clkLevel );
+        Abc_PrintTime( 1, "Hashing   ", clkClass );
+        Abc_PrintTime( 1, "Building  ", clkBuild );
+    }
+    return pNew;
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Creates well-balanced AND gate.]
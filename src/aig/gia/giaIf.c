@@ -1284,7 +1284,7 @@ int Gia_ManFromIfLogicNode( void * pIfMan, Gia_Man_t * pNew, int iObj, Vec_Int_t
     {
         extern int If_CluMinimumBase( word * t, int * pSupp, int nVarsAll, int * pnVars );
 
-        static word TruthStore[16][1<<10] = {{0}}, * pTruths[16];
+        static ABC_THREAD_LOCAL word TruthStore[16][1<<10] = {{0}}, * pTruths[16];
         word Func0, Func1, Func2;
         char pLut0[32], pLut1[32], pLut2[32] = {0};
 
@@ -26,6 +26,24 @@
 #include "opt/dau/dau.h"
 #include "bool/kit/kit.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#include <stdbool.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -73,6 +91,7 @@ struct Mf_Man_t_
     Vec_Int_t       vCnfSizes;      // handles to CNF
     Vec_Int_t       vCnfMem;        // memory for CNF
     Vec_Int_t       vTemp;          // temporary array
+    Vec_Int_t *     vArena;         // private cut storage of a thread
     int             iCur;           // current position
     int             Iter;           // mapping iterations
     int             fUseEla;        // use exact area
@@ -729,16 +748,42 @@ static inline int Mf_ManPrepareCuts( Mf_Cut_t * pCuts, Mf_Man_t * p, int iObj, i
     }
     return Mf_CutCreateUnit( pCuts, iObj );
 }
-static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
+static inline int Mf_ManAllocCutSet( Mf_Man_t * p, int nInts )
 {
-    int i, * pPlace, iCur, nInts = 1;
-    for ( i = 0; i < nCuts; i++ )
-        nInts += pCuts[i]->nLeaves + 1;
+    int iCur;
     if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
         p->iCur = ((p->iCur >> 16) + 1) << 16;
     if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
         Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
     iCur = p->iCur; p->iCur += nInts;
+    return iCur;
+}
+static inline int Mf_ManSaveCutSet( Mf_Man_t * p, int * pList )
+{
+    int i, * pCut, iCur, nInts = 1;
+    Mf_SetForEachCut( pList, pCut, i )
+        nInts += Mf_CutSize(pCut) + 1;
+    iCur = Mf_ManAllocCutSet( p, nInts );
+    memcpy( Mf_ManCutSet(p, iCur), pList, sizeof(int) * nInts );
+    return iCur;
+}
+static inline int Mf_ManSaveCutsArena( Vec_Int_t * vArena, Mf_Cut_t ** pCuts, int nCuts )
+{
+    int i, iCur = Vec_IntSize(vArena);
+    Vec_IntPush( vArena, nCuts );
+    for ( i = 0; i < nCuts; i++ )
+    {
+        Vec_IntPush( vArena, Mf_CutSetBoth(pCuts[i]->nLeaves, pCuts[i]->iFunc) );
+        Vec_IntPushArray( vArena, pCuts[i]->pLeaves, pCuts[i]->nLeaves );
+    }
+    return iCur;
+}
+static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
+{
+    int i, * pPlace, iCur, nInts = 1;
+    for ( i = 0; i < nCuts; i++ )
+        nInts += pCuts[i]->nLeaves + 1;
+    iCur = Mf_ManAllocCutSet( p, nInts );
     pPlace = Mf_ManCutSet( p, iCur );
     *pPlace++ = nCuts;
     for ( i = 0; i < nCuts; i++ )
@@ -1114,7 +1159,10 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
     // store the cutset
     pBest->Flow = pCutsR[0]->Flow;
     pBest->Delay = pCutsR[0]->Delay;
-    pBest->iCutSet = Mf_ManSaveCuts( p, pCutsR, nCutsR );
+    if ( p->vArena ) // the cutset is moved into the cut memory later
+        pBest->iCutSet = Mf_ManSaveCutsArena( p->vArena, pCutsR, nCutsR );
+    else
+        pBest->iCutSet = Mf_ManSaveCuts( p, pCutsR, nCutsR );
     // verify
     assert( nCutsR > 0 && nCutsR < nCutNum );
 //    assert( Mf_SetCheckArray(pCutsR, nCutsR) );
@@ -1528,11 +1576,204 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
     }
     fflush( stdout );
 }
-void Mf_ManComputeCuts( Mf_Man_t * p )
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded cut computation.]
+
+  Description [Computes the same cuts as the sequential computation.
+  The AND nodes are processed level by level. The threads take small 
+  chunks of the current level from a shared counter until the level is 
+  exhausted, so that the fast threads pick up the work left by the slow 
+  ones. Each thread works with a shallow copy of the manager, which has 
+  its own statistics and its own cut arena. After each level, the main 
+  thread moves the cutsets from the arenas into the cut memory.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void Mf_ManComputeCutsMt( Mf_Man_t * p )
 {
     int i;
     Gia_ManForEachAndId( p->pGia, i )
         Mf_ObjMergeOrder( p, i );
+}
+
+#else // pthreads are used
+
+#define MF_THR_MAX    100
+#define MF_THR_CHUNK   16
+
+typedef struct Mf_ThLevel_t_
+{
+    int *           pNodes;         // nodes of the current level
+    int             nNodes;         // the number of nodes
+    int *           pThreads;       // the thread that processed each node
+    atomic_int      iNext;          // the next node to be taken
+} Mf_ThLevel_t;
+typedef struct Mf_ThData_t_
+{
+    Mf_Man_t        Man;            // copy of the manager used by this thread
+    Mf_ThLevel_t *  pLevel;         // the current level
+    int             Id;             // thread ID
+    int             fStop;          // stop the thread
+    abctime         clkUsed;        // runtime of this thread
+    atomic_bool     fWorking;
+} Mf_ThData_t;
+
+void Mf_ManProcessLevel( Mf_ThData_t * pThData )
+{
+    Mf_ThLevel_t * pLevel = pThData->pLevel;
+    abctime clk = Abc_Clock();
+    int k, kStop;
+    while ( (k = atomic_fetch_add( &pLevel->iNext, MF_THR_CHUNK )) < pLevel->nNodes )
+    {
+        for ( kStop = Abc_MinInt( k + MF_THR_CHUNK, pLevel->nNodes ); k < kStop; k++ )
+        {
+            pLevel->pThreads[k] = pThData->Id;
+            Mf_ObjMergeOrder( &pThData->Man, pLevel->pNodes[k] );
+        }
+    }
+    pThData->clkUsed += Abc_Clock() - clk;
+}
+void * Mf_WorkerThread( void * pArg )
+{
+    Mf_ThData_t * pThData = (Mf_ThData_t *)pArg;
+    while ( 1 )
+    {
+        while ( !atomic_load_explicit( &pThData->fWorking, memory_order_acquire ) );
+        if ( pThData->fStop )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        Mf_ManProcessLevel( pThData );
+        atomic_store_explicit( &pThData->fWorking, false, memory_order_release );
+    }
+    assert( 0 );
+    return NULL;
+}
+void Mf_ManComputeCutsMt( Mf_Man_t * p )
+{
+    pthread_t WorkerThread[MF_THR_MAX];
+    Mf_ThData_t * ThData;
+    Mf_ThLevel_t Level, * pLevel = &Level;
+    Gia_Obj_t * pObj;
+    int nProcs = Abc_MinInt( p->pPars->nProcNum, MF_THR_MAX );
+    int * pLevels, * pStarts, * pOrder;
+    int i, k, iLevel, nLevels = 0, status;
+    // sort the nodes by level
+    pLevels = ABC_CALLOC( int, Gia_ManObjNum(p->pGia) );
+    Gia_ManForEachAnd( p->pGia, pObj, i )
+    {
+        pLevels[i] = 1 + Abc_MaxInt( pLevels[Gia_ObjFaninId0(pObj, i)], pLevels[Gia_ObjFaninId1(pObj, i)] );
+        if ( Gia_ObjIsMuxId(p->pGia, i) )
+            pLevels[i] = Abc_MaxInt( pLevels[i], 1 + pLevels[Gia_ObjFaninId2(p->pGia, i)] );
+        nLevels = Abc_MaxInt( nLevels, pLevels[i] );
+    }
+    pStarts = ABC_CALLOC( int, nLevels + 2 );
+    Gia_ManForEachAndId( p->pGia, i )
+        pStarts[pLevels[i] + 1]++;
+    for ( k = 1; k <= nLevels + 1; k++ )
+        pStarts[k] += pStarts[k-1];
+    pOrder = ABC_ALLOC( int, Gia_ManAndNum(p->pGia) + 1 );
+    Gia_ManForEachAndId( p->pGia, i )
+        pOrder[pStarts[pLevels[i]]++] = i;
+    for ( k = nLevels + 1; k > 0; k-- )
+        pStarts[k] = pStarts[k-1];
+    pStarts[0] = 0;
+    ABC_FREE( pLevels );
+    // start the threads (the main thread is thread 0)
+    pLevel->pThreads = ABC_ALLOC( int, Gia_ManAndNum(p->pGia) + 1 );
+    ThData = ABC_CALLOC( Mf_ThData_t, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].Man        = *p;
+        ThData[i].Man.vArena = Vec_IntAlloc( 1 << 16 );
+        memset( ThData[i].Man.CutCount, 0, sizeof(double) * 4 );
+        memset( ThData[i].Man.nCutCounts, 0, sizeof(int) * (MF_LEAF_MAX+1) );
+        ThData[i].pLevel     = pLevel;
+        ThData[i].Id         = i;
+        atomic_store_explicit( &ThData[i].fWorking, false, memory_order_release );
+        if ( i == 0 )
+            continue;
+        status = pthread_create( WorkerThread + i, NULL, Mf_WorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    // process the levels
+    for ( iLevel = 1; iLevel <= nLevels; iLevel++ )
+    {
+        pLevel->pNodes = pOrder + pStarts[iLevel];
+        pLevel->nNodes = pStarts[iLevel+1] - pStarts[iLevel];
+        if ( pLevel->nNodes < 4 * MF_THR_CHUNK * nProcs )
+        {
+            // small levels are cheaper to process without synchronization
+            for ( k = 0; k < pLevel->nNodes; k++ )
+                Mf_ObjMergeOrder( p, pLevel->pNodes[k] );
+            continue;
+        }
+        atomic_store_explicit( &pLevel->iNext, 0, memory_order_release );
+        for ( i = 0; i < nProcs; i++ )
+        {
+            ThData[i].Man.vPages = p->vPages; // the cut memory may have grown
+            if ( i > 0 )
+                atomic_store_explicit( &ThData[i].fWorking, true, memory_order_release );
+        }
+        Mf_ManProcessLevel( ThData );
+        for ( i = 1; i < nProcs; i++ )
+            while ( atomic_load_explicit( &ThData[i].fWorking, memory_order_acquire ) );
+        // move the cutsets into the cut memory
+        for ( k = 0; k < pLevel->nNodes; k++ )
+        {
+            Mf_Obj_t * pBest = Mf_ManObj( p, pLevel->pNodes[k] );
+            pBest->iCutSet = Mf_ManSaveCutSet( p, Vec_IntEntryP(ThData[pLevel->pThreads[k]].Man.vArena, pBest->iCutSet) );
+        }
+        for ( i = 0; i < nProcs; i++ )
+            Vec_IntClear( ThData[i].Man.vArena );
+    }
+    // stop the threads
+    for ( i = 1; i < nProcs; i++ )
+    {
+        ThData[i].fStop = 1;
+        atomic_store_explicit( &ThData[i].fWorking, true, memory_order_release );
+    }
+    for ( i = 1; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    // collect statistics
+    for ( i = 0; i < nProcs; i++ )
+    {
+        for ( k = 0; k < 4; k++ )
+            p->CutCount[k] += ThData[i].Man.CutCount[k];
+        for ( k = 0; k <= MF_LEAF_MAX; k++ )
+            p->nCutCounts[k] += ThData[i].Man.nCutCounts[k];
+        if ( p->pPars->fVerbose )
+        {
+            double Time = 1.0*ThData[i].clkUsed/CLOCKS_PER_SEC;
+            printf( "Thread %2d :  Cuts = %10.0f  ", i, ThData[i].Man.CutCount[3] );
+            printf( "Rate = %8.2f Kcuts/sec  ", Time > 0 ? ThData[i].Man.CutCount[3]/Time/1000 : 0.0 );
+            Abc_PrintTime( 1, "Time", ThData[i].clkUsed );
+        }
+        Vec_IntFree( ThData[i].Man.vArena );
+    }
+    ABC_FREE( ThData );
+    ABC_FREE( pLevel->pThreads );
+    ABC_FREE( pStarts );
+    ABC_FREE( pOrder );
+}
+
+#endif // pthreads are used
+
+void Mf_ManComputeCuts( Mf_Man_t * p )
+{
+    int i;
+    if ( p->pPars->nProcNum > 1 && !p->pPars->fCutMin && !Gia_ManHasChoices(p->pGia) )
+        Mf_ManComputeCutsMt( p );
+    else
+        Gia_ManForEachAndId( p->pGia, i )
+            Mf_ObjMergeOrder( p, i );
     Mf_ManSetMapRefs( p );
     Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
 }
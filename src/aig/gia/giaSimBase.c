@@ -20,6 +20,7 @@
 
 #include "gia.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilSimd.h"
 #include "misc/extra/extra.h"
 //#include <immintrin.h>
 #include "aig/miniaig/miniaig.h"
@@ -99,7 +100,14 @@ static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
     word * pSims0 = pSims + nWords*Gia_ObjFaninId0(pObj, i);
     word * pSims1 = pSims + nWords*Gia_ObjFaninId1(pObj, i);
     word * pSims2 = pSims + nWords*i; int w;
-    if ( Gia_ObjIsXor(pObj) )
+    if ( nWords >= ABC_SIMD_MIN_WORDS )
+    {
+        if ( Gia_ObjIsXor(pObj) )
+            Abc_SimdXor( pSims2, pSims0, pSims1, Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj), nWords );
+        else
+            Abc_SimdAnd( pSims2, pSims0, pSims1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), nWords );
+    }
+    else if ( Gia_ObjIsXor(pObj) )
         for ( w = 0; w < nWords; w++ )
             pSims2[w] = (pSims0[w] ^ Diff0) ^ (pSims1[w] ^ Diff1);
     else
@@ -126,7 +134,7 @@ Vec_Wrd_t * Gia_ManSimPatSim( Gia_Man_t * pGia )
 {
     Gia_Obj_t * pObj;
     int i, nWords = Vec_WrdSize(pGia->vSimsPi) / Gia_ManCiNum(pGia);
-    Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
+    Vec_Wrd_t * vSims = Vec_WrdStartAligned( Gia_ManObjNum(pGia) * nWords );
     assert( Vec_WrdSize(pGia->vSimsPi) % Gia_ManCiNum(pGia) == 0 );
     Gia_ManSimPatAssignInputs( pGia, nWords, vSims, pGia->vSimsPi );
     Gia_ManForEachAnd( pGia, pObj, i ) 
@@ -2429,6 +2437,74 @@ void Gia_ManSimTest( Gia_Man_t * pGia )
     Vec_WrdFree( vSim0 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Benchmarks the simulation kernels.]
+
+  Description [Simulates the AIG with random patterns using each of the 
+  instruction sets supported by the processor, checks that the results 
+  agree, and reports the number of simulated node-patterns per second.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimBenchOne( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims )
+{
+    Gia_Obj_t * pObj; int i;
+    word * pSims = Vec_WrdArray( vSims );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        word * pSim  = pSims + nWords * i;
+        word * pSim0 = pSims + nWords * Gia_ObjFaninId0(pObj, i);
+        word * pSim1 = pSims + nWords * Gia_ObjFaninId1(pObj, i);
+        if ( Gia_ObjIsMuxId(p, i) )
+            Abc_SimdMux( pSim, pSims + nWords * Gia_ObjFaninId2(p, i), pSim1, pSim0, Gia_ObjFaninC2(p, pObj), Gia_ObjFaninC1(pObj), Gia_ObjFaninC0(pObj), nWords );
+        else if ( Gia_ObjIsXor(pObj) )
+            Abc_SimdXor( pSim, pSim0, pSim1, Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj), nWords );
+        else
+            Abc_SimdAnd( pSim, pSim0, pSim1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), nWords );
+    }
+    Gia_ManForEachCo( p, pObj, i )
+        Abc_SimdCopy( pSims + nWords * Gia_ObjId(p, pObj), pSims + nWords * Gia_ObjFaninId0p(p, pObj), Gia_ObjFaninC0(pObj), nWords );
+}
+void Gia_ManSimBench( Gia_Man_t * p, int nWords, int nRounds, int fVerbose )
+{
+    Vec_Wrd_t * vSims, * vSimsRef = NULL;
+    int i, k, r, Id, Level, LevelOld = Abc_SimdLevel(), nMismatches = 0;
+    double Total = (double)Gia_ManAndNum(p) * 64 * nWords * nRounds;
+    vSims = Vec_WrdStartAligned( Gia_ManObjNum(p) * nWords );
+    Abc_RandomW( 1 );
+    Gia_ManForEachCiId( p, Id, i )
+        for ( k = 0; k < nWords; k++ )
+            Vec_WrdWriteEntry( vSims, Id * nWords + k, Abc_RandomW(0) );
+    printf( "Simulating %d nodes with %d words (%d patterns) in %d rounds.  The best instruction set is %s.\n", 
+        Gia_ManAndNum(p), nWords, 64 * nWords, nRounds, Abc_SimdLevelName(Abc_SimdLevelSupported()) );
+    for ( Level = ABC_SIMD_SCALAR; Level <= Abc_SimdLevelSupported(); Level++ )
+    {
+        abctime clk;
+        Abc_SimdSetLevel( Level );
+        clk = Abc_Clock();
+        for ( r = 0; r < nRounds; r++ )
+            Gia_ManSimBenchOne( p, nWords, vSims );
+        clk = Abc_Clock() - clk;
+        printf( "%-8s : %10.2f M node-patterns/sec  ", Abc_SimdLevelName(Level), clk ? Total / 1000000 / ((double)clk / CLOCKS_PER_SEC) : 0.0 );
+        Abc_PrintTime( 1, "Time", clk );
+        if ( vSimsRef == NULL )
+            vSimsRef = Vec_WrdDup( vSims );
+        else if ( !Vec_WrdEqual(vSims, vSimsRef) )
+            nMismatches++;
+    }
+    Abc_SimdSetLevel( LevelOld );
+    if ( nMismatches )
+        printf( "Simulation results of the instruction sets do not agree.\n" );
+    else if ( fVerbose )
+        printf( "Simulation results of the instruction sets agree.\n" );
+    Vec_WrdFreeP( &vSimsRef );
+    Vec_WrdFree( vSims );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Trying compiled simulation.]
@@ -110,10 +110,30 @@ Vec_Int_t * Gia_StochProcessArray( Vec_Ptr_t * vGias, char * pScript, int TimeSe
   SeeAlso     []
 
 ***********************************************************************/
+Gia_Man_t * Gia_StochProcessThread( Gia_Man_t * p, char * pScript )
+{
+    // the script runs in the frame of this thread without spawning a process
+    Abc_Frame_t * pAbc = Abc_FrameStartThread();
+    Gia_Man_t * pTemp, * pNew = NULL;
+    Abc_FrameUpdateGia( pAbc, Gia_ManDup(p) );
+    if ( Cmd_CommandExecute( pAbc, pScript ) )
+    {
+        fprintf( stderr, "The following command has returned non-zero exit status:\n" );
+        fprintf( stderr, "\"%s\"\n", pScript );
+        fflush( stdout );
+    }
+    else if ( (pTemp = Abc_FrameReadGia(pAbc)) && Gia_ManAndNum(pTemp) < Gia_ManAndNum(p) )
+        pNew = Gia_ManDup( pTemp );
+    Abc_FrameStopThread( pAbc );
+    return pNew ? pNew : Gia_ManDup(p);
+}
 Gia_Man_t * Gia_StochProcessOne( Gia_Man_t * p, char * pScript, int Rand, int TimeSecs )
 {
     Gia_Man_t * pNew;
     char FileName[100], Command[1000];
+    // only the scripts made of reentrant commands are run on this thread
+    if ( Cmd_CommandIsReentrant(pScript) )
+        return Gia_StochProcessThread( p, pScript );
     sprintf( FileName, "%06x.aig", Rand );
     Gia_AigerWrite( p, FileName, 0, 0, 0 );
     sprintf( Command, "./abc -q \"&read %s; %s; &write %s\"", FileName, pScript, FileName );
@@ -158,7 +158,7 @@ Gia_Man_t * Gia_ManTranStochOpt1( Gia_ManTranStochParam * p, Gia_Man_t * pOld )
       pGia = pNew;
     } else {
       Gia_ManTranStochLock( p );
-      pNew = Gia_ManCompress2( pGia, 1, 0 );
+      pNew = Gia_ManCompress2( pGia, 1, 1, 0 );
       Gia_ManTranStochUnlock( p );
       Gia_ManStop( pGia );
       pGia = pNew;
@@ -1627,7 +1627,7 @@ clk = Abc_Clock();
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fVerbose )
+Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fFanout, int fPower, int nProcs, int fVerbose )
 {
     Aig_Man_t * pMan, * pTemp;
     Abc_Ntk_t * pNtkAig;
@@ -1639,7 +1639,7 @@ Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fF
 //    Aig_ManPrintStats( pMan );
 
 clk = Abc_Clock();
-    pMan = Dar_ManCompress2( pTemp = pMan, fBalance, fUpdateLevel, fFanout, fPower, fVerbose ); 
+    pMan = Dar_ManCompress2( pTemp = pMan, fBalance, fUpdateLevel, fFanout, fPower, nProcs, fVerbose ); 
     Aig_ManStop( pTemp );
 //ABC_PRT( "time", Abc_Clock() - clk );
 
@@ -1844,12 +1844,13 @@ Abc_Ntk_t * Abc_NtkConstructFromCnf( Abc_Ntk_t * pNtk, Cnf_Man_t * p, Vec_Ptr_t
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose )
+Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fBinary, int nProcs, int fVerbose )
 {
 //    Vec_Ptr_t * vMapped = NULL;
     Aig_Man_t * pMan;
 //    Cnf_Man_t * pManCnf = NULL;
     Cnf_Dat_t * pCnf;
+    int pStats[3];
     Abc_Ntk_t * pNtkNew = NULL;
     abctime clk = Abc_Clock();
     assert( Abc_NtkIsStrash(pNtk) );
@@ -1868,11 +1869,21 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
     if ( fVerbose )
     Aig_ManPrintStats( pMan );
 
+    // derive CNF and write it into the file without building the complete CNF
+    if ( !fFastAlgo )
+    {
+        if ( Cnf_DeriveWriteFile( pMan, pFileName, 0, fChangePol, fBinary, nProcs, fVerbose, pStats ) )
+        {
+            Abc_Print( 1, "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d.   ", pStats[0], pStats[1], pStats[2] );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        Cnf_ManFree();
+        Aig_ManStop( pMan );
+        return pNtkNew;
+    }
+
     // derive CNF
-    if ( fFastAlgo )
-        pCnf = Cnf_DeriveFast( pMan, 0 );
-    else
-        pCnf = Cnf_Derive( pMan, 0 );
+    pCnf = Cnf_DeriveFast( pMan, 0 );
 
     // adjust polarity
     if ( fChangePol )
@@ -1893,7 +1904,7 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
     Vec_PtrFree( vMapped );
 */
     // write CNF into a file
-    Cnf_DataWriteIntoFile( pCnf, pFileName, 0, NULL, NULL );
+    Cnf_DataWriteIntoFileFast( pCnf, pFileName, fBinary, nProcs, fVerbose );
     Cnf_DataFree( pCnf );
     Cnf_ManFree();
     Aig_ManStop( pMan );
@@ -61,7 +61,7 @@ static Abc_Obj_t *  Abc_NodeFromMapSuperChoice_rec( Abc_Ntk_t * pNtkNew, Map_Sup
 ***********************************************************************/
 Abc_Ntk_t * Abc_NtkMap( Abc_Ntk_t * pNtk, Mio_Library_t* userLib, double DelayTarget, double AreaMulti, double DelayMulti, float LogFan, float Slew, float Gain, int nGatesMin, int fRecovery, int fSwitching, int fSkipFanout, int fUseProfile, int fUseBuffs, int fVerbose )
 {
-    static int fUseMulti = 0;
+    int fUseMulti = (AreaMulti != 0.0 || DelayMulti != 0.0);
     int fShowSwitching = 1;
     Abc_Ntk_t * pNtkNew;
     Map_Man_t * pMan;
@@ -85,8 +85,7 @@ Abc_Ntk_t * Abc_NtkMap( Abc_Ntk_t * pNtk, Mio_Library_t* userLib, double DelayTa
             Mio_LibraryTransferProfile( pLib, (Mio_Library_t *)Abc_FrameReadLibGen() );
         }
         // remove supergate library
-        Map_SuperLibFree( (Map_SuperLib_t *)Abc_FrameReadLibSuper() );
-        Abc_FrameSetLibSuper( NULL );
+        Map_SuperLibReplace( NULL );
     }
 
     if ( userLib != NULL ) {
@@ -100,18 +99,12 @@ Abc_Ntk_t * Abc_NtkMap( Abc_Ntk_t * pNtk, Mio_Library_t* userLib, double DelayTa
         return 0;
     }
     if ( AreaMulti != 0.0 )
-        fUseMulti = 1, printf( "The cell areas are multiplied by the factor: <num_fanins> ^ (%.2f).\n", AreaMulti );
+        printf( "The cell areas are multiplied by the factor: <num_fanins> ^ (%.2f).\n", AreaMulti );
     if ( DelayMulti != 0.0 )
-        fUseMulti = 1, printf( "The cell delays are multiplied by the factor: <num_fanins> ^ (%.2f).\n", DelayMulti );
+        printf( "The cell delays are multiplied by the factor: <num_fanins> ^ (%.2f).\n", DelayMulti );
 
-    // penalize large gates by increasing their area
-    if ( AreaMulti != 0.0 )
-        Mio_LibraryMultiArea( pLib, AreaMulti );
-    if ( DelayMulti != 0.0 )
-        Mio_LibraryMultiDelay( pLib, DelayMulti );
-
-    // derive the supergate library
-    if ( fUseMulti || Abc_FrameReadLibSuper() == NULL )
+    // derive the supergate library (penalize large gates by increasing their area/delay)
+    if ( fUseMulti || Abc_FrameReadLibSuper() == NULL || Map_SuperLibReadMulti((Map_SuperLib_t *)Abc_FrameReadLibSuper()) )
     {
         if ( fVerbose )
             printf( "Converting \"%s\" into supergate library \"%s\".\n", 
@@ -119,15 +112,12 @@ Abc_Ntk_t * Abc_NtkMap( Abc_Ntk_t * pNtk, Mio_Library_t* userLib, double DelayTa
         // compute supergate library to be used for mapping
         if ( Mio_LibraryHasProfile(pLib) )
             printf( "Abc_NtkMap(): Genlib library has profile.\n" );
-        Map_SuperLibDeriveFromGenlib( pLib, fVerbose );
+        if ( fUseMulti )
+            Map_SuperLibDeriveFromGenlibMulti( pLib, AreaMulti, DelayMulti, fVerbose );
+        else
+            Map_SuperLibDeriveFromGenlib( pLib, fVerbose );
     }
 
-    // return the library to normal
-    if ( AreaMulti != 0.0 )
-        Mio_LibraryMultiArea( (Mio_Library_t *)Abc_FrameReadLibGen(), -AreaMulti );
-    if ( DelayMulti != 0.0 )
-        Mio_LibraryMultiDelay( (Mio_Library_t *)Abc_FrameReadLibGen(), -DelayMulti );
-
     // print a warning about choice nodes
     if ( fVerbose && Abc_NtkGetChoiceNum( pNtk ) )
         printf( "Performing mapping with choices.\n" );
@@ -1291,6 +1291,23 @@ typedef struct StochSynData_t_
     int          TimeOut;
 } StochSynData_t;
 
+Abc_Ntk_t * Abc_NtkStochProcessThread( Abc_Ntk_t * p, char * pScript )
+{
+    // the script runs in the frame of this thread, which shares the library of the main frame
+    Abc_Frame_t * pAbc = Abc_FrameStartThread();
+    Abc_Ntk_t * pTemp, * pNew = NULL;
+    Abc_FrameReplaceCurrentNetwork( pAbc, Abc_NtkDupDfs(p) );
+    if ( Cmd_CommandExecute( pAbc, pScript ) )
+    {
+        fprintf( stderr, "The following command has returned non-zero exit status:\n" );
+        fprintf( stderr, "\"%s\"\n", pScript );
+        fflush( stdout );
+    }
+    else if ( (pTemp = Abc_FrameReadNtk(pAbc)) && Abc_NtkGetMappedArea(pTemp) <= Abc_NtkGetMappedArea(p) )
+        pNew = Abc_NtkDupDfs( pTemp );
+    Abc_FrameStopThread( pAbc );
+    return pNew ? pNew : Abc_NtkDupDfs(p);
+}
 Abc_Ntk_t * Abc_NtkStochProcessOne( Abc_Ntk_t * p, char * pScript0, int Rand, int TimeSecs )
 {
     extern int Abc_NtkWriteToFile( char * pFileName, Abc_Ntk_t * pNtk );
@@ -1298,6 +1315,9 @@ Abc_Ntk_t * Abc_NtkStochProcessOne( Abc_Ntk_t * p, char * pScript0, int Rand, in
     Abc_Ntk_t * pNew, * pTemp;
     char FileName[100], Command[1000], PreCommand[500] = {0};
     char * pLibFileName = Abc_NtkIsMappedLogic(p) ? Mio_LibraryReadFileName((Mio_Library_t *)p->pManFunc) : NULL;
+    // only the scripts made of reentrant commands are run on this thread
+    if ( Cmd_CommandIsReentrant(pScript0) )
+        return Abc_NtkStochProcessThread( p, pScript0 );
     if ( pLibFileName ) sprintf( PreCommand, "read_genlib %s; ", pLibFileName );
     sprintf( FileName, "%06x.mm", Rand );
     Abc_NtkWriteToFile( FileName, p );    
@@ -421,7 +421,7 @@ Gia_Man_t * Abc_NtkTestTimPerformSynthesis( Gia_Man_t * p, int fChoices )
         pNew = Dar_ManChoiceNew( pNew, pPars );
     else
     {
-        pNew = Dar_ManCompress2( pTemp = pNew, 1, 1, 1, 0, 0 );
+        pNew = Dar_ManCompress2( pTemp = pNew, 1, 1, 1, 0, 1, 0 );
         Aig_ManStop( pTemp );
     }
     pGia = Gia_ManFromAig( pNew );
@@ -163,6 +163,102 @@ void Cmd_End( Abc_Frame_t * pAbc )
 
 
 
+/**Function********************************************************************
+
+  Synopsis    [Starts the command package in the frame of a thread.]
+
+  Description [The frame of the thread shares the commands of the main 
+  frame pMain and gets its own copies of the aliases and the flags, so 
+  that no files are read and the scripts of the thread can change them
+  independently.]
+
+  SideEffects []
+
+  SeeAlso     [Cmd_EndThread]
+
+******************************************************************************/
+void Cmd_InitThread( Abc_Frame_t * pAbc, Abc_Frame_t * pMain )
+{
+    st__generator * gen;
+    char * pKey, * pValue;
+    pAbc->tCommands = st__copy( pMain->tCommands );
+    pAbc->tAliases  = st__init_table(strcmp, st__strhash);
+    pAbc->tFlags    = st__init_table(strcmp, st__strhash);
+    pAbc->aHistory  = Vec_PtrAlloc( 100 );
+    st__foreach_item( pMain->tAliases, gen, (const char **)&pKey, (char **)&pValue )
+        CmdCommandAliasAdd( pAbc, pKey, ((Abc_Alias *)pValue)->argc, ((Abc_Alias *)pValue)->argv );
+    st__foreach_item( pMain->tFlags, gen, (const char **)&pKey, (char **)&pValue )
+        Cmd_FlagUpdateValue( pAbc, Extra_UtilStrsav(pKey), pValue );
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Ends the command package in the frame of a thread.]
+
+  Description [The shared commands are not freed.]
+
+  SideEffects []
+
+  SeeAlso     [Cmd_InitThread]
+
+******************************************************************************/
+void Cmd_EndThread( Abc_Frame_t * pAbc )
+{
+    st__generator * gen;
+    char * pKey, * pValue;
+    st__free_table( pAbc->tCommands );
+
+    st__foreach_item( pAbc->tAliases, gen, (const char **)&pKey, (char **)&pValue )
+        CmdCommandAliasFree( (Abc_Alias *)pValue );
+    st__free_table( pAbc->tAliases );
+
+    st__foreach_item( pAbc->tFlags, gen, (const char **)&pKey, (char **)&pValue )
+        ABC_FREE( pKey ), ABC_FREE( pValue );
+    st__free_table( pAbc->tFlags );
+
+    Vec_PtrFreeFree( pAbc->aHistory );
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Returns 1 if the script can run in the frame of a thread.]
+
+  Description [Each command of the script should be in the list of
+  commands whose code was checked for static data shared by concurrent
+  calls. Other scripts should run in a separate process.]
+
+  SideEffects []
+
+  SeeAlso     [Cmd_InitThread]
+
+******************************************************************************/
+int Cmd_CommandIsReentrant( char * pScript )
+{
+    static const char * pReentrant[] = { "&st", "&b", "&dc2", "&dch", "&synch2", "&if", "&lf", NULL };
+    char * pCur = pScript, * pEnd;
+    int i, Length;
+    while ( 1 )
+    {
+        while ( *pCur == ' ' || *pCur == '\t' )
+            pCur++;
+        for ( pEnd = pCur; *pEnd && *pEnd != ';' && *pEnd != ' ' && *pEnd != '\t'; pEnd++ );
+        Length = (int)(pEnd - pCur);
+        if ( Length > 0 )
+        {
+            for ( i = 0; pReentrant[i]; i++ )
+                if ( (int)strlen(pReentrant[i]) == Length && !strncmp(pCur, pReentrant[i], Length) )
+                    break;
+            if ( pReentrant[i] == NULL )
+                return 0;
+        }
+        while ( *pEnd && *pEnd != ';' )
+            pEnd++;
+        if ( *pEnd == 0 )
+            return 1;
+        pCur = pEnd + 1;
+    }
+}
+
 /**Function********************************************************************
 
   Synopsis    []
@@ -50,6 +50,9 @@ typedef struct MvAlias      Abc_Alias;    // one alias
 /*=== cmd.c ===========================================================*/
 extern void        Cmd_Init( Abc_Frame_t * pAbc );
 extern void        Cmd_End( Abc_Frame_t * pAbc );
+extern void        Cmd_InitThread( Abc_Frame_t * pAbc, Abc_Frame_t * pMain );
+extern void        Cmd_EndThread( Abc_Frame_t * pAbc );
+extern int         Cmd_CommandIsReentrant( char * pScript );
 /*=== cmdApi.c ========================================================*/
 typedef int (*Cmd_CommandFuncType)(Abc_Frame_t*, int, char**);
 extern int         Cmd_CommandIsDefined( Abc_Frame_t * pAbc, const char * sName );
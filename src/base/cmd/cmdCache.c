@@ -0,0 +1,375 @@
+/**CFile****************************************************************
+
+  FileName    [cmdCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [On-disk cache of the results of AIG commands.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "base/main/mainInt.h"
+#include "cmdInt.h"
+#include "aig/gia/gia.h"
+#include "map/if/if.h"
+#include "misc/util/utilSignal.h"
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The cache is enabled by "set gia_cache <dir>", where <dir> is an existing
+// directory. A command listed in "gia_cache_cmds" (or in the default list
+// below), which is applied to the current AIG, is looked up in the cache
+// using the key computed from the AIG structure (including the LUT mapping),
+// the timing information, the command line, and the current LUT library. 
+// On a hit, the stored AIG replaces the current one, taking over its names
+// and timing information, and the command is not executed. On a miss,
+// the command is executed and its result is stored in "<dir>/<key>.aig".
+// Setting "gia_cache_verbose" prints hits and misses.
+
+// Structural choices cannot be saved in AIGER, so commands producing them
+// (such as &dch and &synch2) are not cached; the mapping performed on the choices is.
+
+static char * s_CmdCacheDefault = "&st &dc2 &syn2 &syn3 &syn4 &b &fx &if &mf &lf &jf &mfs";
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Mixes the next value into the hash.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word CmdCacheMix( word h, word x )
+{
+    x += h + ABC_CONST(0x9E3779B97F4A7C15);
+    x  = (x ^ (x >> 30)) * ABC_CONST(0xBF58476D1CE4E5B9);
+    x  = (x ^ (x >> 27)) * ABC_CONST(0x94D049BB133111EB);
+    return x ^ (x >> 31);
+}
+static inline void CmdCacheMix2( word * pKey, word x )
+{
+    pKey[0] = CmdCacheMix( pKey[0], x );
+    pKey[1] = CmdCacheMix( pKey[1], ~x );
+}
+static inline void CmdCacheMixFlt( word * pKey, float x )
+{
+    union { float f; unsigned u; } v;
+    v.f = x;
+    CmdCacheMix2( pKey, v.u );
+}
+static inline void CmdCacheMixVecInt( word * pKey, Vec_Int_t * v )
+{
+    int i, Entry;
+    CmdCacheMix2( pKey, v ? Vec_IntSize(v) + 1 : 0 );
+    if ( v )
+        Vec_IntForEachEntry( v, Entry, i )
+            CmdCacheMix2( pKey, (unsigned)Entry );
+}
+static inline void CmdCacheMixVecFlt( word * pKey, Vec_Flt_t * v )
+{
+    float Entry;
+    int i;
+    CmdCacheMix2( pKey, v ? Vec_FltSize(v) + 1 : 0 );
+    if ( v )
+        Vec_FltForEachEntry( v, Entry, i )
+            CmdCacheMixFlt( pKey, Entry );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the 128-bit key of the AIG and the command.]
+
+  Description [The AIG is hashed in the order of its objects, which is
+  the order in which the AND nodes were created by structural hashing.
+  The objects are numbered as in the normalized AIG written into AIGER,
+  so that an AIG loaded from the cache has the same key as the AIG that
+  was stored. Returns 0 if the AIG contains information not covered by 
+  the key.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word CmdCacheLit( Vec_Int_t * vMap, int iLit )
+{
+    return Abc_Var2Lit( Vec_IntEntry(vMap, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit) );
+}
+int CmdCacheComputeKey( Abc_Frame_t * pAbc, Gia_Man_t * p, int argc, char ** argv, word * pKey )
+{
+    If_LibLut_t * pLutLib = (If_LibLut_t *)pAbc->pLibLut;
+    Vec_Int_t * vMap;
+    Gia_Obj_t * pObj;
+    int i, k, iFan, nObjs = 0;
+    word Lit0, Lit1;
+    if ( p->pManTime || p->pAigExtra || p->pMuxes )
+        return 0;
+    // number the objects as in the normalized AIG
+    vMap = Vec_IntStartFull( Gia_ManObjNum(p) );
+    Vec_IntWriteEntry( vMap, 0, nObjs++ );
+    Gia_ManForEachCi( p, pObj, i )
+        Vec_IntWriteEntry( vMap, Gia_ObjId(p, pObj), nObjs++ );
+    Gia_ManForEachAnd( p, pObj, i )
+        Vec_IntWriteEntry( vMap, i, nObjs++ );
+    Gia_ManForEachCo( p, pObj, i )
+        Vec_IntWriteEntry( vMap, Gia_ObjId(p, pObj), nObjs++ );
+    // hash the structure
+    pKey[0] = ABC_CONST(0x0123456789ABCDEF);
+    pKey[1] = ABC_CONST(0xFEDCBA9876543210);
+    CmdCacheMix2( pKey, Gia_ManObjNum(p) );
+    CmdCacheMix2( pKey, Gia_ManCiNum(p) );
+    CmdCacheMix2( pKey, Gia_ManCoNum(p) );
+    CmdCacheMix2( pKey, Gia_ManRegNum(p) );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        Lit0 = CmdCacheLit( vMap, Gia_ObjFaninLit0(pObj, i) );
+        Lit1 = CmdCacheLit( vMap, Gia_ObjFaninLit1(pObj, i) );
+        CmdCacheMix2( pKey, (Abc_MinWord(Lit0, Lit1) << 32) | Abc_MaxWord(Lit0, Lit1) );
+    }
+    Gia_ManForEachCo( p, pObj, i )
+        CmdCacheMix2( pKey, CmdCacheLit( vMap, Gia_ObjFaninLit0p(p, pObj) ) );
+    if ( Gia_ManHasChoices(p) )
+    {
+        Gia_ManForEachAnd( p, pObj, i )
+            if ( Gia_ObjSibl(p, i) )
+                CmdCacheMix2( pKey, ((word)Vec_IntEntry(vMap, i) << 32) | Vec_IntEntry(vMap, Gia_ObjSibl(p, i)) );
+    }
+    if ( Gia_ManHasMapping(p) )
+    {
+        Gia_ManForEachLut( p, i )
+        {
+            CmdCacheMix2( pKey, ((word)Vec_IntEntry(vMap, i) << 32) | Gia_ObjLutSize(p, i) );
+            Gia_LutForEachFanin( p, i, iFan, k )
+                CmdCacheMix2( pKey, Vec_IntEntry(vMap, iFan) );
+        }
+    }
+    Vec_IntFree( vMap );
+    // hash the timing information used by the mappers
+    CmdCacheMixVecInt( pKey, p->vCiArrs );
+    CmdCacheMixVecInt( pKey, p->vCoReqs );
+    CmdCacheMixVecFlt( pKey, p->vInArrs );
+    CmdCacheMixVecFlt( pKey, p->vOutReqs );
+    if ( p->vInArrs || p->vOutReqs )
+    {
+        CmdCacheMixFlt( pKey, p->DefInArrs );
+        CmdCacheMixFlt( pKey, p->DefOutReqs );
+    }
+    CmdCacheMix2( pKey, (unsigned)p->And2Delay );
+    // hash the command line and the LUT library
+    for ( i = 0; i < argc; i++ )
+        for ( k = 0; k <= (int)strlen(argv[i]); k++ )
+            CmdCacheMix2( pKey, (unsigned char)argv[i][k] );
+    if ( pLutLib )
+    {
+        CmdCacheMix2( pKey, pLutLib->LutMax );
+        for ( i = 0; i <= pLutLib->LutMax; i++ )
+        {
+            CmdCacheMix2( pKey, (word)(1000 * pLutLib->pLutAreas[i]) );
+            for ( k = 0; k <= pLutLib->LutMax; k++ )
+                CmdCacheMix2( pKey, (word)(1000 * pLutLib->pLutDelays[i][k]) );
+        }
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the command is cached.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int CmdCacheCommandIsCached( char * pCommand )
+{
+    char * pList = Abc_FrameReadFlag( "gia_cache_cmds" );
+    char * pCur;
+    int nLength = strlen(pCommand);
+    if ( pList == NULL )
+        pList = s_CmdCacheDefault;
+    for ( pCur = strstr(pList, pCommand); pCur; pCur = strstr(pCur + 1, pCommand) )
+        if ( (pCur == pList || pCur[-1] == ' ') && (pCur[nLength] == ' ' || pCur[nLength] == 0) )
+            return 1;
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the file name of the cache entry.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * CmdCacheFileName( char * pDir, word * pKey, char * pSuffix )
+{
+    char * pFileName = ABC_ALLOC( char, strlen(pDir) + 50 );
+    sprintf( pFileName, "%s/%08x%08x%08x%08x.aig%s", pDir,
+        (unsigned)(pKey[0] >> 32), (unsigned)pKey[0], (unsigned)(pKey[1] >> 32), (unsigned)pKey[1], pSuffix );
+    return pFileName;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Looks up the result of the command in the cache.]
+
+  Description [Returns 1 if the result is found and loaded. Otherwise,
+  returns 0 and sets the key to be used for storing the result (the key
+  is zero if the command should not be cached). The loaded AIG takes 
+  the CI/CO names of the current AIG, because the key does not include 
+  them and the entry may have been stored for another design; the names 
+  saved in the entry are used only if the current AIG has none. The timing 
+  information is copied from the current AIG, as the commands do.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int CmdCacheLookup( Abc_Frame_t * pAbc, int argc, char ** argv, word * pKey )
+{
+    char * pDir = Abc_FrameReadFlag( "gia_cache" );
+    char * pFileName;
+    Gia_Man_t * pNew;
+    FILE * pFile;
+    pKey[0] = pKey[1] = 0;
+    if ( pDir == NULL || pAbc->pGia == NULL || !CmdCacheCommandIsCached(argv[0]) )
+        return 0;
+    if ( !CmdCacheComputeKey( pAbc, pAbc->pGia, argc, argv, pKey ) )
+    {
+        pKey[0] = pKey[1] = 0;
+        return 0;
+    }
+    pFileName = CmdCacheFileName( pDir, pKey, "" );
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        if ( Abc_FrameIsFlagEnabled( "gia_cache_verbose" ) )
+            Abc_Print( 1, "Cache miss for \"%s\".\n", argv[0] );
+        ABC_FREE( pFileName );
+        return 0;
+    }
+    fclose( pFile );
+    pNew = Gia_AigerRead( pFileName, 0, 1, 0 );
+    if ( pNew == NULL )
+    {
+        ABC_FREE( pFileName );
+        return 0;
+    }
+    if ( Abc_FrameIsFlagEnabled( "gia_cache_verbose" ) )
+        Abc_Print( 1, "Cache hit for \"%s\" (file \"%s\").\n", argv[0], pFileName );
+    ABC_FREE( pFileName );
+    ABC_FREE( pNew->pName );
+    ABC_FREE( pNew->pSpec );
+    pNew->pName = Abc_UtilStrsav( pAbc->pGia->pName );
+    pNew->pSpec = Abc_UtilStrsav( pAbc->pGia->pSpec );
+    // the names of the current AIG are transferred by Abc_FrameUpdateGia()
+    if ( pAbc->pGia->vNamesIn && Vec_PtrSize(pAbc->pGia->vNamesIn) == Gia_ManCiNum(pNew) && pNew->vNamesIn )
+        Vec_PtrFreeFree( pNew->vNamesIn ), pNew->vNamesIn = NULL;
+    if ( pAbc->pGia->vNamesOut && Vec_PtrSize(pAbc->pGia->vNamesOut) == Gia_ManCoNum(pNew) && pNew->vNamesOut )
+        Vec_PtrFreeFree( pNew->vNamesOut ), pNew->vNamesOut = NULL;
+    if ( pNew->vNamesNode )
+        Vec_PtrFreeFree( pNew->vNamesNode ), pNew->vNamesNode = NULL;
+    pNew->vCiArrs    = pAbc->pGia->vCiArrs  ? Vec_IntDup( pAbc->pGia->vCiArrs )  : NULL;
+    pNew->vCoReqs    = pAbc->pGia->vCoReqs  ? Vec_IntDup( pAbc->pGia->vCoReqs )  : NULL;
+    pNew->vInArrs    = pAbc->pGia->vInArrs  ? Vec_FltDup( pAbc->pGia->vInArrs )  : NULL;
+    pNew->vOutReqs   = pAbc->pGia->vOutReqs ? Vec_FltDup( pAbc->pGia->vOutReqs ) : NULL;
+    pNew->DefInArrs  = pAbc->pGia->DefInArrs;
+    pNew->DefOutReqs = pAbc->pGia->DefOutReqs;
+    pNew->And2Delay  = pAbc->pGia->And2Delay;
+    Abc_FrameUpdateGia( pAbc, pNew );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stores the result of the command in the cache.]
+
+  Description [The AIG is written with its CI/CO names into a temporary 
+  file with a unique name, which is then renamed, so that concurrent runs 
+  sharing the directory never see a partially written entry.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void CmdCacheStore( Abc_Frame_t * pAbc, word * pKey )
+{
+    char * pDir = Abc_FrameReadFlag( "gia_cache" );
+    char * pFileName, * pPrefix, * pFileTemp = NULL;
+    int fd;
+    if ( pDir == NULL || pAbc->pGia == NULL || (pKey[0] == 0 && pKey[1] == 0) )
+        return;
+    if ( pAbc->pGia->pManTime || pAbc->pGia->pAigExtra || pAbc->pGia->nXors || pAbc->pGia->nMuxes || Gia_ManHasChoices(pAbc->pGia) )
+        return;
+    if ( Gia_ManCoNum(pAbc->pGia) == 0 )
+        return;
+    pFileName = CmdCacheFileName( pDir, pKey, "" );
+    pPrefix   = CmdCacheFileName( pDir, pKey, "." );
+    fd = Util_SignalTmpFile( pPrefix, ".tmp", &pFileTemp );
+    ABC_FREE( pPrefix );
+    if ( fd == -1 )
+    {
+        if ( Abc_FrameIsFlagEnabled( "gia_cache_verbose" ) )
+            Abc_Print( 1, "Cannot create a temporary file in the cache directory \"%s\".\n", pDir );
+        ABC_FREE( pFileName );
+        return;
+    }
+#ifdef WIN32
+    _close( fd );
+#else
+    close( fd );
+#endif
+    Gia_AigerWriteS( pAbc->pGia, pFileTemp, 1, 0, 0, 1 );
+    if ( rename( pFileTemp, pFileName ) != 0 )
+    {
+        if ( Abc_FrameIsFlagEnabled( "gia_cache_verbose" ) )
+            Abc_Print( 1, "Cannot store the result in the cache directory \"%s\".\n", pDir );
+        remove( pFileTemp );
+    }
+    ABC_FREE( pFileName );
+    ABC_FREE( pFileTemp );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
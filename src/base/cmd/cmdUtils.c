@@ -106,6 +106,7 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
     char * value;
     int fError;
     double clk;
+    word CacheKey[2];
 
     if ( argc == 0 )
         return 0;
@@ -151,10 +152,17 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
         }
     }
 
-    // execute the command
+    // execute the command unless its result is available in the cache
     clk = Extra_CpuTimeDouble();
-    pFunc = (int (*)(Abc_Frame_t *, int, char **))pCommand->pFunc;
-    fError = (*pFunc)( pAbc, argc, argv );
+    if ( CmdCacheLookup( pAbc, argc, argv, CacheKey ) )
+        fError = 0;
+    else
+    {
+        pFunc = (int (*)(Abc_Frame_t *, int, char **))pCommand->pFunc;
+        fError = (*pFunc)( pAbc, argc, argv );
+        if ( fError == 0 )
+            CmdCacheStore( pAbc, CacheKey );
+    }
     pAbc->TimeCommand += Extra_CpuTimeDouble() - clk;
 
     // automatic execution of arbitrary command after each command 
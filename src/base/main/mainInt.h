@@ -129,6 +129,7 @@ struct Abc_Frame_t_
     Vec_Ptr_t *     vCexVec;       // a vector of counter-examples if more than one PO fails
     Vec_Ptr_t *     vPoEquivs;     // equivalence classes of isomorphic primary outputs
     Vec_Int_t *     vStatuses;     // problem status for each output
+    Vec_Wec_t *     vInvVec;       // inductive invariant for each proved output (empty if not available)
     Vec_Int_t *     vAbcObjIds;    // object IDs
     int             Status;                // the status of verification problem (proved=1, disproved=0, undecided=-1)
     int             nFrames;               // the number of time frames completed by BMC
@@ -168,6 +169,9 @@ struct Abc_Frame_t_
     int *           pNdrArray;
 
     Abc_Frame_Callback_BmcFrameDone_Func pFuncOnFrameDone;
+    // frames of the threads running their own scripts
+    int             fThread;       // the frame shares the commands and libraries of the main frame
+    Abc_Frame_t *   pOuter;        // the frame that was current on this thread before this one
 };
 
 typedef void (*Abc_Frame_Initialization_Func)( Abc_Frame_t * pAbc );
@@ -21,6 +21,24 @@
 #include "if.h"
 #include "misc/extra/extra.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#include <stdbool.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -152,16 +170,16 @@ int * If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut )
 
   Synopsis    [Finds the best cut for the given node.]
 
-  Description [Mapping modes: delay (0), area flow (1), area (2).]
+  Description [Mapping modes: delay (0), area flow (1), area (2).
+  The cutset of the node is allocated and released by the caller.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+static void If_ObjPerformMappingAndInt( If_Man_t * p, If_Obj_t * pObj, If_Set_t * pCutSet, int Mode, int fPreprocess, int fFirst )
 {
-    If_Set_t * pCutSet;
     If_Cut_t * pCut0, * pCut1, * pCut;
     If_Cut_t * pCut0R, * pCut1R;
     int fFunc0R, fFunc1R;
@@ -181,9 +199,6 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     if ( Mode && pObj->nRefs > 0 )
         If_CutAreaDeref( p, If_ObjCutBest(pObj) );
 
-    // prepare the cutset
-    pCutSet = If_ManSetupNodeCutSet( p, pObj );
-
     // get the current assigned best cut
     pCut = If_ObjCutBest(pObj);
     if ( !fFirst )
@@ -503,6 +518,13 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     if ( p->pPars->pFuncUser )
         If_ObjForEachCut( pObj, pCut, i )
             p->pPars->pFuncUser( p, pObj, pCut );
+}
+void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+{
+    // prepare the cutset
+    If_Set_t * pCutSet = If_ManSetupNodeCutSet( p, pObj );
+    // compute the cuts
+    If_ObjPerformMappingAndInt( p, pObj, pCutSet, Mode, fPreprocess, fFirst );
     // free the cuts
     If_ManDerefNodeCutSet( p, pObj );
 }
@@ -592,6 +614,203 @@ void If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fP
     If_ManDerefChoiceCutSet( p, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the mapping round can use several threads.]
+
+  Description [Only delay-oriented rounds are parallelized. In the area 
+  recovery rounds, the cut evaluation depends on the reference counters 
+  updated by the previously mapped nodes of the same level. The mapping 
+  features relying on shared truth tables, DSD managers, user callbacks, 
+  timing managers or choices are computed sequentially.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPerformMappingMtIsUsed( If_Man_t * p, int Mode )
+{
+    If_Par_t * pPars = p->pPars;
+    if ( pPars->nProcNum < 2 || Mode != 0 )
+        return 0;
+    if ( p->pManTim || p->nChoices || pPars->fLiftLeaves )
+        return 0;
+    if ( pPars->fTruth || pPars->pFuncCost || pPars->pFuncUser || pPars->nGateSize > 0 )
+        return 0;
+    if ( pPars->fDelayOpt || pPars->fDelayOptLut || pPars->fDsdBalance || pPars->fUserRecLib || pPars->fUserSesLib || pPars->fUserLutDec || pPars->fUserLut2D )
+        return 0;
+    if ( pPars->pLutLib && pPars->pLutLib->fVarPinDelays ) // If_CutDelay() uses static storage
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded mapping of the internal nodes.]
+
+  Description [Computes the same cuts as the sequential mapping. The nodes 
+  are processed level by level. Before each level, the main thread allocates 
+  the cutsets of all nodes of the level. The threads take small chunks of 
+  nodes from a shared counter and compute their cuts using a shallow copy 
+  of the manager with its own statistics. After the level is processed, 
+  the main thread releases the cutsets of the fanins in the order of node 
+  IDs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void If_ManPerformMappingMt( If_Man_t * p, int Mode, int fPreprocess, int fFirst )
+{
+    If_Obj_t * pObj;
+    int i;
+    If_ManForEachNode( p, pObj, i )
+        If_ObjPerformMappingAnd( p, pObj, Mode, fPreprocess, fFirst );
+}
+
+#else // pthreads are used
+
+#define IF_THR_MAX    100
+#define IF_THR_CHUNK   16
+
+typedef struct If_ThLevel_t_
+{
+    If_Obj_t **     pNodes;         // nodes of the current level
+    int             nNodes;         // the number of nodes
+    int             Mode;           // mapping mode
+    int             fPreprocess;    // preprocessing
+    int             fFirst;         // the first round
+    atomic_int      iNext;          // the next node to be taken
+} If_ThLevel_t;
+typedef struct If_ThData_t_
+{
+    If_Man_t        Man;            // copy of the manager used by this thread
+    If_ThLevel_t *  pLevel;         // the current level
+    int             fStop;          // stop the thread
+    abctime         clkUsed;        // runtime of this thread
+    atomic_bool     fWorking;
+} If_ThData_t;
+
+void If_ManProcessLevel( If_ThData_t * pThData )
+{
+    If_ThLevel_t * pLevel = pThData->pLevel;
+    If_Obj_t * pObj;
+    abctime clk = Abc_Clock();
+    int k, kStop;
+    while ( (k = atomic_fetch_add( &pLevel->iNext, IF_THR_CHUNK )) < pLevel->nNodes )
+    {
+        for ( kStop = Abc_MinInt( k + IF_THR_CHUNK, pLevel->nNodes ); k < kStop; k++ )
+        {
+            pObj = pLevel->pNodes[k];
+            If_ObjPerformMappingAndInt( &pThData->Man, pObj, pObj->pCutSet, pLevel->Mode, pLevel->fPreprocess, pLevel->fFirst );
+        }
+    }
+    pThData->clkUsed += Abc_Clock() - clk;
+}
+void * If_WorkerThread( void * pArg )
+{
+    If_ThData_t * pThData = (If_ThData_t *)pArg;
+    while ( 1 )
+    {
+        while ( !atomic_load_explicit( &pThData->fWorking, memory_order_acquire ) );
+        if ( pThData->fStop )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        If_ManProcessLevel( pThData );
+        atomic_store_explicit( &pThData->fWorking, false, memory_order_release );
+    }
+    assert( 0 );
+    return NULL;
+}
+void If_ManPerformMappingMt( If_Man_t * p, int Mode, int fPreprocess, int fFirst )
+{
+    pthread_t WorkerThread[IF_THR_MAX];
+    If_ThData_t * ThData;
+    If_ThLevel_t Level, * pLevel = &Level;
+    Vec_Wec_t * vLevels = If_ManCollectLevels( p );
+    Vec_Int_t * vLevel;
+    If_Obj_t * pObj;
+    int nProcs = Abc_MinInt( p->pPars->nProcNum, IF_THR_MAX );
+    int i, k, status;
+    pLevel->pNodes      = ABC_ALLOC( If_Obj_t *, Vec_WecMaxLevelSize(vLevels) + 1 );
+    pLevel->Mode        = Mode;
+    pLevel->fPreprocess = fPreprocess;
+    pLevel->fFirst      = fFirst;
+    // start the threads (the main thread is thread 0)
+    ThData = ABC_CALLOC( If_ThData_t, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].Man             = *p;
+        ThData[i].Man.nCutsMerged = 0;
+        ThData[i].Man.nCutsTotal  = 0;
+        ThData[i].pLevel          = pLevel;
+        atomic_store_explicit( &ThData[i].fWorking, false, memory_order_release );
+        if ( i == 0 )
+            continue;
+        status = pthread_create( WorkerThread + i, NULL, If_WorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    // process the levels
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        if ( Vec_IntSize(vLevel) == 0 )
+            continue;
+        // allocate the cutsets
+        pLevel->nNodes = Vec_IntSize(vLevel);
+        for ( k = 0; k < pLevel->nNodes; k++ )
+        {
+            pLevel->pNodes[k] = pObj = If_ManObj( p, Vec_IntEntry(vLevel, k) );
+            If_ManSetupNodeCutSet( p, pObj );
+        }
+        atomic_store_explicit( &pLevel->iNext, 0, memory_order_release );
+        if ( pLevel->nNodes < 4 * IF_THR_CHUNK * nProcs )
+            If_ManProcessLevel( ThData ); // small levels are cheaper to process without synchronization
+        else
+        {
+            for ( k = 1; k < nProcs; k++ )
+                atomic_store_explicit( &ThData[k].fWorking, true, memory_order_release );
+            If_ManProcessLevel( ThData );
+            for ( k = 1; k < nProcs; k++ )
+                while ( atomic_load_explicit( &ThData[k].fWorking, memory_order_acquire ) );
+        }
+        // free the cutsets
+        for ( k = 0; k < pLevel->nNodes; k++ )
+            If_ManDerefNodeCutSet( p, pLevel->pNodes[k] );
+    }
+    // stop the threads
+    for ( i = 1; i < nProcs; i++ )
+    {
+        ThData[i].fStop = 1;
+        atomic_store_explicit( &ThData[i].fWorking, true, memory_order_release );
+    }
+    for ( i = 1; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    // collect statistics
+    for ( i = 0; i < nProcs; i++ )
+    {
+        p->nCutsMerged += ThData[i].Man.nCutsMerged;
+        p->nCutsTotal  += ThData[i].Man.nCutsTotal;
+        if ( p->pPars->fVerbose )
+        {
+            double Time = 1.0*ThData[i].clkUsed/CLOCKS_PER_SEC;
+            Abc_Print( 1, "Thread %2d :  Cuts = %10d  ", i, ThData[i].Man.nCutsMerged );
+            Abc_Print( 1, "Rate = %8.2f Kcuts/sec  ", Time > 0 ? ThData[i].Man.nCutsMerged/Time/1000 : 0.0 );
+            Abc_PrintTime( 1, "Time", ThData[i].clkUsed );
+        }
+    }
+    ABC_FREE( ThData );
+    ABC_FREE( pLevel->pNodes );
+    Vec_WecFree( vLevels );
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Performs one mapping pass over all nodes.]
@@ -658,6 +877,8 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+    else if ( If_ManPerformMappingMtIsUsed( p, Mode ) )
+        If_ManPerformMappingMt( p, Mode, fPreprocess, fFirst );
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
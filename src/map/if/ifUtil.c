@@ -349,6 +349,71 @@ int If_ManCrossCut( If_Man_t * p )
     return nCutSizeMax;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Collects the internal nodes by logic level.]
+
+  Description [Level k of the result lists the AND nodes of level k in 
+  the order of their IDs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * If_ManCollectLevels( If_Man_t * p )
+{
+    Vec_Wec_t * vLevels = Vec_WecStart( p->nLevelMax + 1 );
+    If_Obj_t * pObj;
+    int i;
+    If_ManForEachNode( p, pObj, i )
+        Vec_WecPush( vLevels, If_ObjLevel(pObj), pObj->Id );
+    return vLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cross-cut of the circuit processed by levels.]
+
+  Description [Similar to If_ManCrossCut() but assumes that the cutsets of 
+  all nodes of one level are allocated before the cutsets of this level 
+  are computed, as it is done by the multi-threaded mapping.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManCrossCutLevel( If_Man_t * p )
+{
+    Vec_Wec_t * vLevels = If_ManCollectLevels( p );
+    Vec_Int_t * vLevel;
+    If_Obj_t * pObj, * pFanin;
+    int i, k, Id, nCutSize = 0, nCutSizeMax = 0;
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        nCutSize += Vec_IntSize(vLevel);
+        nCutSizeMax = Abc_MaxInt( nCutSizeMax, nCutSize );
+        Vec_IntForEachEntry( vLevel, Id, k )
+        {
+            pObj = If_ManObj( p, Id );
+            if ( pObj->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin0(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin1(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+        }
+    }
+    If_ManForEachObj( p, pObj, i )
+        pObj->nVisits = pObj->nVisitsCopy;
+    assert( nCutSize == 0 );
+    Vec_WecFree( vLevels );
+    return nCutSizeMax;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the reverse topological order of nodes.]
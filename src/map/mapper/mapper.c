@@ -158,8 +158,7 @@ int Map_CommandReadLibrary( Abc_Frame_t * pAbc, int argc, char **argv )
     // replace the current library
 //    Map_SuperLibFree( s_pSuperLib );
 //    s_pSuperLib = pLib;
-    Map_SuperLibFree( (Map_SuperLib_t *)Abc_FrameReadLibSuper() );
-    Abc_FrameSetLibSuper( pLib );
+    Map_SuperLibReplace( pLib );
     // replace the current genlib library
 //    Mio_LibraryDelete( (Mio_Library_t *)Abc_FrameReadLibGen() );
 //    Abc_FrameSetLibGen( (Mio_Library_t *)pLib->pGenlib );
@@ -154,6 +154,7 @@ extern unsigned char * Map_SuperReadPhases( Map_Super_t * p );
 extern int             Map_SuperReadFanoutLimit( Map_Super_t * p );
 
 extern Mio_Library_t * Map_SuperLibReadGenLib( Map_SuperLib_t * p );
+extern int             Map_SuperLibReadMulti( Map_SuperLib_t * p );
 extern float           Map_SuperLibReadAreaInv( Map_SuperLib_t * p );
 extern Map_Time_t      Map_SuperLibReadDelayInv( Map_SuperLib_t * p );
 extern int             Map_SuperLibReadVarsMax( Map_SuperLib_t * p );
@@ -175,7 +176,9 @@ extern Vec_Ptr_t *     Map_CutInternalNodes( Map_Node_t * pObj, Map_Cut_t * pCut
 extern int             Map_Mapping( Map_Man_t * p );
 /*=== mapperLib.c =============================================================*/
 extern int             Map_SuperLibDeriveFromGenlib( Mio_Library_t * pLib, int fVerbose );
+extern int             Map_SuperLibDeriveFromGenlibMulti( Mio_Library_t * pLib, double AreaMulti, double DelayMulti, int fVerbose );
 extern void            Map_SuperLibFree( Map_SuperLib_t * p );
+extern void            Map_SuperLibReplace( Map_SuperLib_t * p );
 /*=== mapperMntk.c =============================================================*/
 //extern Mntk_Man_t *    Map_ConvertMappingToMntk( Map_Man_t * pMan );
 /*=== mapperSuper.c =============================================================*/
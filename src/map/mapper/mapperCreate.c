@@ -166,6 +166,7 @@ unsigned char * Map_SuperReadPhases( Map_Super_t * p )           {  return p->uP
 int             Map_SuperReadFanoutLimit( Map_Super_t * p )      {  return p->nFanLimit;}
 
 Mio_Library_t * Map_SuperLibReadGenLib( Map_SuperLib_t * p )     {  return p->pGenlib;  }
+int             Map_SuperLibReadMulti( Map_SuperLib_t * p )      {  return p->fMulti;   }
 float           Map_SuperLibReadAreaInv( Map_SuperLib_t * p )    {  return p->AreaInv;  }
 Map_Time_t      Map_SuperLibReadDelayInv( Map_SuperLib_t * p )   {  return p->tDelayInv;}
 int             Map_SuperLibReadVarsMax( Map_SuperLib_t * p )    {  return p->nVarsMax; }
@@ -178,6 +178,7 @@ struct Map_SuperLibStruct_t_
     int                 nSupersReal;   // the total number of supergates
     int                 nLines;        // the total number of lines in the supergate file
     int                 fVerbose;      // the verbosity flag
+    int                 fMulti;        // the gates were scaled by the fanin count when deriving
 
     // hash tables
     Map_Super_t **      ppSupers;      // the array of supergates
@@ -218,11 +218,84 @@ int Map_SuperLibDeriveFromGenlib( Mio_Library_t * pLib, int fVerbose )
     Vec_StrFree( vStr );
 
     // replace the library
-    Map_SuperLibFree( (Map_SuperLib_t *)Abc_FrameReadLibSuper() );
-    Abc_FrameSetLibSuper( pLibSuper );
+    Map_SuperLibReplace( pLibSuper );
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives the library from the scaled genlib library.]
+
+  Description [The areas and delays of the gates are multiplied by 
+  <num_fanins> ^ AreaMulti and <num_fanins> ^ DelayMulti in a copy of 
+  the library, so that the library, which may be shared by several 
+  threads, is not modified. The supergates are then bound to the gates 
+  of the library.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Mio_Gate_t * Map_SuperLibTransferGate( Mio_Library_t * pLib, Mio_Gate_t * pGate )
+{
+    Mio_Gate_t * pGateNew;
+    if ( pGate == NULL )
+        return NULL;
+    pGateNew = Mio_LibraryReadGateByName( pLib, Mio_GateReadName(pGate), Mio_GateReadOutName(pGate) );
+    assert( pGateNew != NULL );
+    return pGateNew;
+}
+int Map_SuperLibDeriveFromGenlibMulti( Mio_Library_t * pLib, double AreaMulti, double DelayMulti, int fVerbose )
+{
+    Map_SuperLib_t * pLibSuper;
+    Mio_Library_t * pLibMulti;
+    int i;
+    if ( pLib == NULL )
+        return 0;
+    pLibMulti = Mio_LibraryDup( pLib );
+    if ( pLibMulti == NULL )
+        return 0;
+    if ( AreaMulti != 0.0 )
+        Mio_LibraryMultiArea( pLibMulti, AreaMulti );
+    if ( DelayMulti != 0.0 )
+        Mio_LibraryMultiDelay( pLibMulti, DelayMulti );
+    if ( !Map_SuperLibDeriveFromGenlib( pLibMulti, fVerbose ) )
+    {
+        Mio_LibraryFree( pLibMulti );
+        return 0;
+    }
+    // bind the supergates to the gates of the library
+    pLibSuper = (Map_SuperLib_t *)Abc_FrameReadLibSuper();
+    for ( i = 0; i < pLibSuper->nSupersAll; i++ )
+        pLibSuper->ppSupers[i]->pRoot = Map_SuperLibTransferGate( pLib, pLibSuper->ppSupers[i]->pRoot );
+    pLibSuper->pSuperInv->pRoot = Map_SuperLibTransferGate( pLib, pLibSuper->pSuperInv->pRoot );
+    pLibSuper->pGateInv = Map_SuperLibTransferGate( pLib, pLibSuper->pGateInv );
+    pLibSuper->pGenlib  = pLib;
+    pLibSuper->fMulti   = 1;
+    Mio_LibraryFree( pLibMulti );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Replaces the supergate library of the current frame.]
+
+  Description [The library that a thread frame shares with the main 
+  frame is not freed (see Abc_FrameStartThread).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Map_SuperLibReplace( Map_SuperLib_t * p )
+{
+    if ( Abc_FrameOwnsLibSuper() )
+        Map_SuperLibFree( (Map_SuperLib_t *)Abc_FrameReadLibSuper() );
+    Abc_FrameSetLibSuper( p );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derives the library from the genlib library.]
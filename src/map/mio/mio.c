@@ -244,10 +244,7 @@ void Mio_UpdateGenlib( Mio_Library_t * pLib )
 {
     // free the current superlib because it depends on the old Mio library
     if ( Abc_FrameReadLibSuper() )
-    {
-        Map_SuperLibFree( (Map_SuperLib_t *)Abc_FrameReadLibSuper() );
-        Abc_FrameSetLibSuper( NULL );
-    }
+        Map_SuperLibReplace( NULL );
 
     // replace the current library
     Mio_LibraryDelete( (Mio_Library_t *)Abc_FrameReadLibGen() );
@@ -267,10 +264,7 @@ int Mio_UpdateGenlib2( Vec_Str_t * vStr, Vec_Str_t * vStr2, char * pFileName, in
 
     // free the current superlib because it depends on the old Mio library
     if ( Abc_FrameReadLibSuper() )
-    {
-        Map_SuperLibFree( (Map_SuperLib_t *)Abc_FrameReadLibSuper() );
-        Abc_FrameSetLibSuper( NULL );
-    }
+        Map_SuperLibReplace( NULL );
 
     // replace the current library
     Mio_LibraryDelete( (Mio_Library_t *)Abc_FrameReadLibGen() );
@@ -191,6 +191,7 @@ extern int               Mio_ParseCheckFormula( Mio_Gate_t * pGate, char * pForm
 extern char *            Mio_LibDeriveSop( int nVars, Vec_Int_t * vExpr, Vec_Str_t * vStr );
 /*=== mioUtils.c =============================================================*/
 extern void              Mio_LibraryDelete( Mio_Library_t * pLib );
+extern void              Mio_LibraryFree( Mio_Library_t * pLib );
 extern void              Mio_GateDelete( Mio_Gate_t * pGate );
 extern void              Mio_PinDelete( Mio_Pin_t * pPin );
 extern Mio_Pin_t *       Mio_PinDup( Mio_Pin_t * pPin );
@@ -208,6 +209,7 @@ extern void              Mio_DeriveGateDelays( Mio_Gate_t * pGate,
                             float * ptDelaysRes, float * ptPinDelayMax );
 extern Mio_Gate_t *      Mio_GateCreatePseudo( int nInputs );
 extern void              Mio_LibraryShiftDelay( Mio_Library_t * pLib, double Shift );
+extern Mio_Library_t *   Mio_LibraryDup( Mio_Library_t * pLib );
 extern void              Mio_LibraryMultiArea( Mio_Library_t * pLib, double Multi );
 extern void              Mio_LibraryMultiDelay( Mio_Library_t * pLib, double Multi );
 extern void              Mio_LibraryTransferDelays( Mio_Library_t * pLibD, Mio_Library_t * pLibS );
@@ -49,14 +49,32 @@ ABC_NAMESPACE_IMPL_START
 
 ***********************************************************************/
 void Mio_LibraryDelete( Mio_Library_t * pLib )
+{
+    if ( pLib == NULL )
+        return;
+    // free the bindings of nodes to gates from this library for all networks
+    Abc_FrameUnmapAllNetworks( Abc_FrameGetGlobalFrame() );
+    Mio_LibraryFree( pLib );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Frees the library that is not used by any network.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Mio_LibraryFree( Mio_Library_t * pLib )
 {
     Mio_Gate_t * pGate, * pGate2;
     if ( pLib == NULL )
         return;
     Mio_LibraryMatchesStop( pLib );
     Mio_LibraryMatches2Stop( pLib );
-    // free the bindings of nodes to gates from this library for all networks
-    Abc_FrameUnmapAllNetworks( Abc_FrameGetGlobalFrame() );
     // free the library
     ABC_FREE( pLib->pName );
     Mio_LibraryForEachGateSafe( pLib, pGate, pGate2 )
@@ -1243,6 +1261,49 @@ void Mio_LibraryShiftDelay( Mio_Library_t * pLib, double Shift )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the library.]
+
+  Description [The copy is parsed from the genlib text of the library
+  written with the full precision. The gates of the copy are in the 
+  same order as the gates of the library.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Mio_Library_t * Mio_LibraryDup( Mio_Library_t * pLib )
+{
+    char * pPhaseNames[10] = { "UNKNOWN", "INV", "NONINV" };
+    Mio_Library_t * pLibNew;
+    Mio_Gate_t * pGate;
+    Mio_Pin_t * pPin;
+    Vec_Str_t * vStr = Vec_StrAlloc( 1000 );
+    int i;
+    for ( i = 0; i < pLib->nGates; i++ )
+    {
+        pGate = pLib->ppGates0[i];
+        Vec_StrPrintF( vStr, "GATE %s %.17g %s=", pGate->pName, pGate->dArea, pGate->pOutName );
+        Vec_StrPrintStr( vStr, pGate->pForm );
+        Vec_StrPrintStr( vStr, ";\n" );
+        Mio_GateForEachPin( pGate, pPin )
+            Vec_StrPrintF( vStr, "    PIN %s %s %.17g %.17g %.17g %.17g %.17g %.17g\n", pPin->pName, pPhaseNames[pPin->Phase], 
+                pPin->dLoadInput, pPin->dLoadMax, pPin->dDelayBlockRise, pPin->dDelayFanoutRise, pPin->dDelayBlockFall, pPin->dDelayFanoutFall );
+    }
+    Vec_StrPrintStr( vStr, ".end\n" );
+    Vec_StrPush( vStr, '\0' );
+    pLibNew = Mio_LibraryRead( pLib->pName, Vec_StrArray(vStr), NULL, 0, 0 );
+    Vec_StrFree( vStr );
+    if ( pLibNew == NULL )
+        return NULL;
+    assert( pLibNew->nGates == pLib->nGates );
+    ABC_FREE( pLibNew->pName );
+    pLibNew->pName = Abc_UtilStrsav( pLib->pName );
+    return pLibNew;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Multiply areas/delays by values proportional to fanin count.]
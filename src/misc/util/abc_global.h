@@ -252,6 +252,13 @@ typedef ABC_INT64_T iword;
 
 #define ABC_SWAP(Type, a, b)  { Type t = a; a = b; b = t; }
 
+// static data of the procedures that may be called by several threads at once
+#if defined(ABC_USE_PTHREADS) && !defined(_MSC_VER)
+#define ABC_THREAD_LOCAL __thread
+#else
+#define ABC_THREAD_LOCAL
+#endif
+
 #define ABC_PRT(a,t)    (Abc_Print(1, "%s =", (a)), Abc_Print(1, "%9.2f sec\n", 1.0*((double)(t))/((double)CLOCKS_PER_SEC)))
 #define ABC_PRTr(a,t)   (Abc_Print(1, "%s =", (a)), Abc_Print(1, "%9.2f sec\r", 1.0*((double)(t))/((double)CLOCKS_PER_SEC)))
 #define ABC_PRTn(a,t)   (Abc_Print(1, "%s =", (a)), Abc_Print(1, "%9.2f sec  ", 1.0*((double)(t))/((double)CLOCKS_PER_SEC)))
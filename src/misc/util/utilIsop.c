@@ -454,7 +454,7 @@ word Abc_IsopCheck( word * pOn, word * pOnDc, word * pRes, int nVars, word CostL
 ***********************************************************************/
 static inline word ** Abc_IsopTtElems()
 {
-    static word TtElems[ABC_ISOP_MAX_VAR+1][ABC_ISOP_MAX_WORD], * pTtElems[ABC_ISOP_MAX_VAR+1] = {NULL};
+    static ABC_THREAD_LOCAL word TtElems[ABC_ISOP_MAX_VAR+1][ABC_ISOP_MAX_WORD], * pTtElems[ABC_ISOP_MAX_VAR+1] = {NULL};
     if ( pTtElems[0] == NULL )
     {
         int v;
@@ -0,0 +1,376 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Bit-parallel simulation kernels.]
+
+  Synopsis    [Bit-parallel simulation kernels.]
+
+  Author      [Alan Mishchenko]
+  
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    [$Id: utilSimd.c,v 1.00 2026/10/16 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "abc_global.h"
+#include "utilSimd.h"
+
+// the vector kernels are compiled for the x86 targets with GCC and Clang,
+// using function attributes, so that no special compiler flags are needed
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(ABC_NO_SIMD)
+#define ABC_SIMD_X86
+#include <immintrin.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+static ABC_THREAD_LOCAL int s_SimdLevel = -1; // the instruction set used by this thread
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Detects and selects the instruction set.]
+
+  Description [Abc_SimdLevelSupported() returns the best instruction set
+  supported by the processor and the OS. Abc_SimdSetLevel() selects the
+  instruction set used by the kernels (useful for benchmarking) and 
+  returns the previous one. The level cannot exceed the supported one.
+  The selection is local to the calling thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SimdLevelSupported()
+{
+    static int Level = -1;
+    if ( Level >= 0 )
+        return Level;
+    Level = ABC_SIMD_SCALAR;
+#ifdef ABC_SIMD_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx2") )
+        Level = ABC_SIMD_AVX2;
+    if ( __builtin_cpu_supports("avx512f") )
+        Level = ABC_SIMD_AVX512;
+#endif
+    return Level;
+}
+int Abc_SimdLevel()
+{
+    if ( s_SimdLevel < 0 )
+        s_SimdLevel = Abc_SimdLevelSupported();
+    return s_SimdLevel;
+}
+int Abc_SimdSetLevel( int Level )
+{
+    int LevelOld = Abc_SimdLevel();
+    s_SimdLevel = Abc_MaxInt( ABC_SIMD_SCALAR, Abc_MinInt(Level, Abc_SimdLevelSupported()) );
+    return LevelOld;
+}
+char * Abc_SimdLevelName( int Level )
+{
+    if ( Level == ABC_SIMD_AVX512 )
+        return "AVX-512";
+    if ( Level == ABC_SIMD_AVX2 )
+        return "AVX2";
+    return "scalar";
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates simulation storage aligned for the kernels.]
+
+  Description [The memory is aligned at 64 bytes and can be freed with
+  Abc_SimdFree(). The kernels do not require alignment, but aligned 
+  storage avoids loads crossing the cache lines.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word * Abc_SimdAlloc( int nWords )
+{
+    void * pArray = NULL;
+#if defined(_WIN32)
+    pArray = _aligned_malloc( sizeof(word) * Abc_MaxInt(nWords, 1), 64 );
+#else
+    if ( posix_memalign( &pArray, 64, sizeof(word) * Abc_MaxInt(nWords, 1) ) )
+        pArray = NULL;
+#endif
+    return (word *)pArray;
+}
+void Abc_SimdFree( word * pArray )
+{
+    if ( pArray == NULL )
+        return;
+#if defined(_WIN32)
+    _aligned_free( pArray );
+#else
+    free( pArray );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Scalar kernels.]
+
+  Description [Used when no vector instruction set is available and for
+  the words remaining after the vector loops.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SimdAndScalar( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords )
+{
+    int w;
+    word Mask0 = fCompl0 ? ~(word)0 : 0;
+    word Mask1 = fCompl1 ? ~(word)0 : 0;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Mask0) & (pIn1[w] ^ Mask1);
+}
+static void Abc_SimdXorScalar( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    int w;
+    word Mask = fCompl ? ~(word)0 : 0;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = pIn0[w] ^ pIn1[w] ^ Mask;
+}
+static void Abc_SimdMuxScalar( word * pOut, word * pCtrl, word * pIn1, word * pIn0, int fComplC, int fCompl1, int fCompl0, int nWords )
+{
+    int w;
+    word MaskC = fComplC ? ~(word)0 : 0;
+    word Mask1 = fCompl1 ? ~(word)0 : 0;
+    word Mask0 = fCompl0 ? ~(word)0 : 0;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = ((pCtrl[w] ^ MaskC) & (pIn1[w] ^ Mask1)) | (~(pCtrl[w] ^ MaskC) & (pIn0[w] ^ Mask0));
+}
+static void Abc_SimdCopyScalar( word * pOut, word * pIn, int fCompl, int nWords )
+{
+    int w;
+    word Mask = fCompl ? ~(word)0 : 0;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = pIn[w] ^ Mask;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 and AVX-512 kernels.]
+
+  Description [Each kernel processes all words, including the tail, so 
+  that the dispatcher reduces to one indirect jump. The AVX-512 kernels 
+  process the remaining four words as one AVX2 vector (AVX-512 implies 
+  AVX2).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_SIMD_X86
+
+__attribute__((target("avx2"))) static void Abc_SimdAnd256( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords )
+{
+    __m256i Mask0 = _mm256_set1_epi64x( fCompl0 ? -1 : 0 );
+    __m256i Mask1 = _mm256_set1_epi64x( fCompl1 ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i In0 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn0 + w)), Mask0 );
+        __m256i In1 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn1 + w)), Mask1 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_and_si256(In0, In1) );
+    }
+    Abc_SimdAndScalar( pOut + w, pIn0 + w, pIn1 + w, fCompl0, fCompl1, nWords - w );
+}
+__attribute__((target("avx2"))) static void Abc_SimdXor256( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    __m256i Mask = _mm256_set1_epi64x( fCompl ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i In0 = _mm256_loadu_si256( (__m256i *)(pIn0 + w) );
+        __m256i In1 = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_xor_si256(In0, In1), Mask) );
+    }
+    Abc_SimdXorScalar( pOut + w, pIn0 + w, pIn1 + w, fCompl, nWords - w );
+}
+__attribute__((target("avx2"))) static void Abc_SimdMux256( word * pOut, word * pCtrl, word * pIn1, word * pIn0, int fComplC, int fCompl1, int fCompl0, int nWords )
+{
+    __m256i MaskC = _mm256_set1_epi64x( fComplC ? -1 : 0 );
+    __m256i Mask1 = _mm256_set1_epi64x( fCompl1 ? -1 : 0 );
+    __m256i Mask0 = _mm256_set1_epi64x( fCompl0 ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i Ctrl = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pCtrl + w)), MaskC );
+        __m256i In1  = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn1 + w)),  Mask1 );
+        __m256i In0  = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn0 + w)),  Mask0 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_or_si256(_mm256_and_si256(Ctrl, In1), _mm256_andnot_si256(Ctrl, In0)) );
+    }
+    Abc_SimdMuxScalar( pOut + w, pCtrl + w, pIn1 + w, pIn0 + w, fComplC, fCompl1, fCompl0, nWords - w );
+}
+__attribute__((target("avx2"))) static void Abc_SimdCopy256( word * pOut, word * pIn, int fCompl, int nWords )
+{
+    __m256i Mask = _mm256_set1_epi64x( fCompl ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(pIn + w)), Mask) );
+    Abc_SimdCopyScalar( pOut + w, pIn + w, fCompl, nWords - w );
+}
+
+__attribute__((target("avx512f"))) static void Abc_SimdAnd512( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords )
+{
+    __m512i Mask0 = _mm512_set1_epi64( fCompl0 ? -1 : 0 );
+    __m512i Mask1 = _mm512_set1_epi64( fCompl1 ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i In0 = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn0 + w)), Mask0 );
+        __m512i In1 = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn1 + w)), Mask1 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_and_si512(In0, In1) );
+    }
+    if ( w + 4 <= nWords )
+    {
+        __m256i In0 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn0 + w)), _mm512_castsi512_si256(Mask0) );
+        __m256i In1 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn1 + w)), _mm512_castsi512_si256(Mask1) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_and_si256(In0, In1) );
+        w += 4;
+    }
+    Abc_SimdAndScalar( pOut + w, pIn0 + w, pIn1 + w, fCompl0, fCompl1, nWords - w );
+}
+__attribute__((target("avx512f"))) static void Abc_SimdXor512( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    __m512i Mask = _mm512_set1_epi64( fCompl ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i In0 = _mm512_loadu_si512( (void *)(pIn0 + w) );
+        __m512i In1 = _mm512_loadu_si512( (void *)(pIn1 + w) );
+        // the three-input XOR is a single instruction (truth table 0x96)
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_ternarylogic_epi64(In0, In1, Mask, 0x96) );
+    }
+    if ( w + 4 <= nWords )
+    {
+        __m256i In0 = _mm256_loadu_si256( (__m256i *)(pIn0 + w) );
+        __m256i In1 = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_xor_si256(In0, In1), _mm512_castsi512_si256(Mask)) );
+        w += 4;
+    }
+    Abc_SimdXorScalar( pOut + w, pIn0 + w, pIn1 + w, fCompl, nWords - w );
+}
+__attribute__((target("avx512f"))) static void Abc_SimdMux512( word * pOut, word * pCtrl, word * pIn1, word * pIn0, int fComplC, int fCompl1, int fCompl0, int nWords )
+{
+    __m512i MaskC = _mm512_set1_epi64( fComplC ? -1 : 0 );
+    __m512i Mask1 = _mm512_set1_epi64( fCompl1 ? -1 : 0 );
+    __m512i Mask0 = _mm512_set1_epi64( fCompl0 ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i Ctrl = _mm512_xor_si512( _mm512_loadu_si512((void *)(pCtrl + w)), MaskC );
+        __m512i In1  = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn1 + w)),  Mask1 );
+        __m512i In0  = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn0 + w)),  Mask0 );
+        // the MUX is a single instruction (truth table 0xCA for Ctrl ? In1 : In0)
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_ternarylogic_epi64(Ctrl, In1, In0, 0xCA) );
+    }
+    if ( w + 4 <= nWords )
+    {
+        __m256i Ctrl = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pCtrl + w)), _mm512_castsi512_si256(MaskC) );
+        __m256i In1  = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn1 + w)),  _mm512_castsi512_si256(Mask1) );
+        __m256i In0  = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn0 + w)),  _mm512_castsi512_si256(Mask0) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_or_si256(_mm256_and_si256(Ctrl, In1), _mm256_andnot_si256(Ctrl, In0)) );
+        w += 4;
+    }
+    Abc_SimdMuxScalar( pOut + w, pCtrl + w, pIn1 + w, pIn0 + w, fComplC, fCompl1, fCompl0, nWords - w );
+}
+__attribute__((target("avx512f"))) static void Abc_SimdCopy512( word * pOut, word * pIn, int fCompl, int nWords )
+{
+    __m512i Mask = _mm512_set1_epi64( fCompl ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(_mm512_loadu_si512((void *)(pIn + w)), Mask) );
+    if ( w + 4 <= nWords )
+    {
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(pIn + w)), _mm512_castsi512_si256(Mask)) );
+        w += 4;
+    }
+    Abc_SimdCopyScalar( pOut + w, pIn + w, fCompl, nWords - w );
+}
+
+#endif // ABC_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [Dispatched kernels.]
+
+  Description [Compute the simulation info of the AND, XOR, and MUX gates
+  and the complement/copy of the info, given the complemented attributes 
+  of the fanins. The output may coincide with one of the inputs. 
+  The kernels are selected from the tables indexed by the instruction 
+  set of the calling thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_SIMD_X86
+static void (*s_SimdAnd[3])( word *, word *, word *, int, int, int )                = { Abc_SimdAndScalar,  Abc_SimdAnd256,  Abc_SimdAnd512  };
+static void (*s_SimdXor[3])( word *, word *, word *, int, int )                     = { Abc_SimdXorScalar,  Abc_SimdXor256,  Abc_SimdXor512  };
+static void (*s_SimdMux[3])( word *, word *, word *, word *, int, int, int, int )   = { Abc_SimdMuxScalar,  Abc_SimdMux256,  Abc_SimdMux512  };
+static void (*s_SimdCopy[3])( word *, word *, int, int )                            = { Abc_SimdCopyScalar, Abc_SimdCopy256, Abc_SimdCopy512 };
+#else
+static void (*s_SimdAnd[3])( word *, word *, word *, int, int, int )                = { Abc_SimdAndScalar,  Abc_SimdAndScalar,  Abc_SimdAndScalar  };
+static void (*s_SimdXor[3])( word *, word *, word *, int, int )                     = { Abc_SimdXorScalar,  Abc_SimdXorScalar,  Abc_SimdXorScalar  };
+static void (*s_SimdMux[3])( word *, word *, word *, word *, int, int, int, int )   = { Abc_SimdMuxScalar,  Abc_SimdMuxScalar,  Abc_SimdMuxScalar  };
+static void (*s_SimdCopy[3])( word *, word *, int, int )                            = { Abc_SimdCopyScalar, Abc_SimdCopyScalar, Abc_SimdCopyScalar };
+#endif
+
+void Abc_SimdAnd( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords )
+{
+    s_SimdAnd[Abc_SimdLevel()]( pOut, pIn0, pIn1, fCompl0, fCompl1, nWords );
+}
+void Abc_SimdXor( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    s_SimdXor[Abc_SimdLevel()]( pOut, pIn0, pIn1, fCompl, nWords );
+}
+void Abc_SimdMux( word * pOut, word * pCtrl, word * pIn1, word * pIn0, int fComplC, int fCompl1, int fCompl0, int nWords )
+{
+    s_SimdMux[Abc_SimdLevel()]( pOut, pCtrl, pIn1, pIn0, fComplC, fCompl1, fCompl0, nWords );
+}
+void Abc_SimdCopy( word * pOut, word * pIn, int fCompl, int nWords )
+{
+    s_SimdCopy[Abc_SimdLevel()]( pOut, pIn, fCompl, nWords );
+}
+void Abc_SimdNot( word * pOut, word * pIn, int nWords )
+{
+    Abc_SimdCopy( pOut, pIn, 1, nWords );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,67 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Bit-parallel simulation kernels.]
+
+  Synopsis    [Bit-parallel simulation kernels.]
+
+  Author      [agent <agent@local>]
+  
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+ 
+#ifndef ABC__misc__util__utilSimd_h
+#define ABC__misc__util__utilSimd_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// the instruction sets used by the kernels
+#define ABC_SIMD_SCALAR    0
+#define ABC_SIMD_AVX2      1
+#define ABC_SIMD_AVX512    2
+
+// the number of words below which the callers use their inlined scalar code;
+// a kernel call costs about as much as simulating a node with fewer words,
+// so the default four words of SAT sweeping (Cec4) stay on the inlined code
+#define ABC_SIMD_MIN_WORDS 8
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilSimd.c ===========================================================*/
+extern int           Abc_SimdLevelSupported();
+extern int           Abc_SimdLevel();
+extern int           Abc_SimdSetLevel( int Level );
+extern char *        Abc_SimdLevelName( int Level );
+extern word *        Abc_SimdAlloc( int nWords );
+extern void          Abc_SimdFree( word * pArray );
+extern void          Abc_SimdAnd( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords );
+extern void          Abc_SimdXor( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords );
+extern void          Abc_SimdMux( word * pOut, word * pCtrl, word * pIn1, word * pIn0, int fComplC, int fCompl1, int fCompl0, int nWords );
+extern void          Abc_SimdNot( word * pOut, word * pIn, int nWords );
+extern void          Abc_SimdCopy( word * pOut, word * pIn, int fCompl, int nWords );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
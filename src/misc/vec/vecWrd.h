@@ -121,6 +121,37 @@ static inline Vec_Wrd_t * Vec_WrdStart( int nSize )
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Allocates a cleaned vector with the array aligned at 64 bytes.]
+
+  Description [Used for the simulation info processed by the vector 
+  instructions. The array can be freed as usual. The alignment is lost 
+  if the vector is resized.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Vec_Wrd_t * Vec_WrdStartAligned( int nSize )
+{
+#if defined(_WIN32)
+    return Vec_WrdStart( nSize );
+#else
+    Vec_Wrd_t * p;
+    void * pArray = NULL;
+    if ( nSize < 16 || posix_memalign( &pArray, 64, sizeof(word) * (size_t)nSize ) )
+        return Vec_WrdStart( nSize );
+    p = ABC_ALLOC( Vec_Wrd_t, 1 );
+    p->nSize  = nSize;
+    p->nCap   = nSize;
+    p->pArray = (word *)pArray;
+    memset( p->pArray, 0, sizeof(word) * (size_t)nSize );
+    return p;
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    [Allocates a vector with the given size and cleans it.]
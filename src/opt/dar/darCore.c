@@ -20,6 +20,24 @@
 
 #include "darInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -59,24 +77,32 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
     pPars->fUseZeros    =  0;
     pPars->fPower       =  0;
     pPars->fRecycle     =  1;
+    pPars->nProcs       =  1;
+    pPars->nWinMax      =  100000;
     pPars->fVerbose     =  0;
     pPars->fVeryVerbose =  0;
 }
 
 #define MAX_VAL 10
 
+// smaller AIGs are not split into windows
+#define DAR_WIN_MIN 1000
+// the depth of the fanout of the window inputs rewritten again
+#define DAR_WIN_DEPTH 3
+
 /**Function*************************************************************
 
   Synopsis    []
 
-  Description []
+  Description [If fMarkedOnly is set, only the nodes marked with fMarkB
+  are rewritten.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+static int Dar_ManRewriteInt( Aig_Man_t * pAig, Dar_RwrPar_t * pPars, int fMarkedOnly )
 {
     extern Vec_Int_t * Saig_ManComputeSwitchProbs( Aig_Man_t * p, int nFrames, int nPref, int fProbOne );
     Dar_Man_t * p;
@@ -124,6 +150,8 @@ int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
         if ( i > nNodesOld )
 //        if ( p->pPars->fUseZeros && i > nNodesOld )
             break;
+        if ( fMarkedOnly && !pObj->fMarkB )
+            continue;
         if ( pPars->fRecycle && ++Counter % 50000 == 0 && Aig_DagSize(pObj) < Vec_PtrSize(p->vCutNodes)/100 )
         {
 //            printf( "Counter = %7d.  Node = %7d.  Dag = %5d. Vec = %5d.\n", 
@@ -249,6 +277,325 @@ p->timeOther = p->timeTotal - p->timeCuts - p->timeEval;
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives the windows for parallel rewriting.]
+
+  Description [The nodes are split into windows of consecutive nodes 
+  in the DFS order from the COs (the first window is shorter by iShift 
+  nodes), so that the fanins outside of a window 
+  belong to the earlier windows and most of the logic cone of a node is 
+  in the same window. A window is an AIG, whose CIs are the fanins from 
+  outside (listed in vIns) and whose COs are the nodes that have fanouts 
+  outside or drive the COs (listed in vOuts). Because these nodes are 
+  COs, rewriting the window does not change their functions. The CIs 
+  of a window keep the levels of their nodes and its nodes keep fMarkB.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Ptr_t * Dar_ManDeriveWindows( Aig_Man_t * pAig, int nWinSize, int iShift, Vec_Wec_t * vIns, Vec_Wec_t * vOuts )
+{
+    Vec_Ptr_t * vWins, * vNodes;
+    Aig_Man_t * pWin;
+    Aig_Obj_t * pObj, * pFanin;
+    int * pWinIds, * pIsOut;
+    int i, k, w, iBeg, iEnd, nWins;
+    vNodes  = Aig_ManDfs( pAig, 1 );
+    nWins   = (Vec_PtrSize(vNodes) + iShift + nWinSize - 1) / nWinSize;
+    vWins   = Vec_PtrAlloc( nWins );
+    pWinIds = ABC_FALLOC( int, Aig_ManObjNumMax(pAig) );
+    pIsOut  = ABC_CALLOC( int, Aig_ManObjNumMax(pAig) );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        pWinIds[pObj->Id] = (i + iShift) / nWinSize;
+    // mark the nodes used outside of their windows
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+    {
+        if ( Aig_ObjIsNode(Aig_ObjFanin0(pObj)) && pWinIds[Aig_ObjFaninId0(pObj)] != pWinIds[pObj->Id] )
+            pIsOut[Aig_ObjFaninId0(pObj)] = 1;
+        if ( Aig_ObjIsNode(Aig_ObjFanin1(pObj)) && pWinIds[Aig_ObjFaninId1(pObj)] != pWinIds[pObj->Id] )
+            pIsOut[Aig_ObjFaninId1(pObj)] = 1;
+    }
+    Aig_ManForEachCo( pAig, pObj, i )
+        if ( Aig_ObjIsNode(Aig_ObjFanin0(pObj)) )
+            pIsOut[Aig_ObjFaninId0(pObj)] = 1;
+    // create the windows
+    Vec_WecInit( vIns, nWins );
+    Vec_WecInit( vOuts, nWins );
+    for ( w = 0; w < nWins; w++ )
+    {
+        iBeg = Abc_MaxInt( w * nWinSize - iShift, 0 );
+        iEnd = Abc_MinInt( (w + 1) * nWinSize - iShift, Vec_PtrSize(vNodes) );
+        pWin = Aig_ManStart( iEnd - iBeg );
+        Aig_ManIncrementTravId( pAig );
+        Aig_ManConst1(pAig)->pData = Aig_ManConst1(pWin);
+        Aig_ObjSetTravIdCurrent( pAig, Aig_ManConst1(pAig) );
+        for ( i = iBeg; i < iEnd; i++ )
+        {
+            pObj = (Aig_Obj_t *)Vec_PtrEntry( vNodes, i );
+            for ( k = 0; k < 2; k++ )
+            {
+                pFanin = k ? Aig_ObjFanin1(pObj) : Aig_ObjFanin0(pObj);
+                if ( Aig_ObjIsTravIdCurrent(pAig, pFanin) )
+                    continue;
+                Aig_ObjSetTravIdCurrent( pAig, pFanin );
+                pFanin->pData = Aig_ObjCreateCi( pWin );
+                ((Aig_Obj_t *)pFanin->pData)->Level = pFanin->Level;
+                Vec_IntPush( Vec_WecEntry(vIns, w), pFanin->Id );
+            }
+            Aig_ObjSetTravIdCurrent( pAig, pObj );
+            pObj->pData = Aig_And( pWin, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+            if ( Aig_ObjIsNode(Aig_Regular((Aig_Obj_t *)pObj->pData)) )
+                Aig_Regular((Aig_Obj_t *)pObj->pData)->fMarkB = pObj->fMarkB;
+        }
+        for ( i = iBeg; i < iEnd; i++ )
+        {
+            pObj = (Aig_Obj_t *)Vec_PtrEntry( vNodes, i );
+            if ( !pIsOut[pObj->Id] )
+                continue;
+            Aig_ObjCreateCo( pWin, (Aig_Obj_t *)pObj->pData );
+            Vec_IntPush( Vec_WecEntry(vOuts, w), pObj->Id );
+        }
+        pWin->Time2Quit = pAig->Time2Quit;
+        Vec_PtrPush( vWins, pWin );
+    }
+    ABC_FREE( pWinIds );
+    ABC_FREE( pIsOut );
+    Vec_PtrFree( vNodes );
+    return vWins;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stitches the rewritten windows into the AIG.]
+
+  Description [The windows are added in their order, so the fanins of 
+  their CIs are ready. Structural hashing merges the nodes shared by 
+  the windows. The COs are then transferred to the new nodes and the 
+  old nodes are removed. The windows are deleted. If fMarkInputs is set,
+  the new nodes of the window inputs that are not CIs are marked with 
+  fMarkB.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dar_ManStitchWindows( Aig_Man_t * pAig, Vec_Ptr_t * vWins, Vec_Wec_t * vIns, Vec_Wec_t * vOuts, int fMarkInputs )
+{
+    Vec_Ptr_t * vCopy, * vNodes;
+    Vec_Int_t * vLevel;
+    Aig_Man_t * pWin;
+    Aig_Obj_t * pObj, * pNew;
+    int i, k, w;
+    vCopy = Vec_PtrStart( Aig_ManObjNumMax(pAig) );
+    Vec_PtrWriteEntry( vCopy, 0, Aig_ManConst1(pAig) );
+    Aig_ManForEachCi( pAig, pObj, i )
+        Vec_PtrWriteEntry( vCopy, pObj->Id, pObj );
+    Vec_PtrForEachEntry( Aig_Man_t *, vWins, pWin, w )
+    {
+        Aig_ManConst1(pWin)->pData = Aig_ManConst1(pAig);
+        Aig_ManForEachCi( pWin, pObj, k )
+            pObj->pData = Vec_PtrEntry( vCopy, Vec_IntEntry(Vec_WecEntry(vIns, w), k) );
+        vNodes = Aig_ManDfs( pWin, 1 );
+        Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, k )
+            pObj->pData = Aig_And( pAig, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+        Vec_PtrFree( vNodes );
+        Aig_ManForEachCo( pWin, pObj, k )
+            Vec_PtrWriteEntry( vCopy, Vec_IntEntry(Vec_WecEntry(vOuts, w), k), Aig_ObjChild0Copy(pObj) );
+        Aig_ManCleanMarkB( pWin );
+        Aig_ManStop( pWin );
+    }
+    if ( fMarkInputs )
+        Vec_WecForEachLevel( vIns, vLevel, w )
+            Vec_IntForEachEntry( vLevel, k, i )
+                if ( Aig_ObjIsNode(Aig_ManObj(pAig, k)) )
+                    Aig_Regular((Aig_Obj_t *)Vec_PtrEntry(vCopy, k))->fMarkB = 1;
+    Aig_ManForEachCo( pAig, pObj, i )
+    {
+        pNew = Aig_NotCond( (Aig_Obj_t *)Vec_PtrEntry(vCopy, Aig_ObjFaninId0(pObj)), Aig_ObjFaninC0(pObj) );
+        if ( pNew != Aig_ObjChild0(pObj) )
+            Aig_ObjPatchFanin0( pAig, pObj, pNew );
+    }
+    Vec_PtrFree( vCopy );
+    Aig_ManCleanup( pAig );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Marks the nodes close to the boundaries of the windows.]
+
+  Description [Extends the nodes marked with fMarkB to their transitive 
+  fanout of nDepth levels. These are the nodes whose cuts could have 
+  crossed the boundaries of the windows.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dar_ManMarkBoundary( Aig_Man_t * pAig, int nDepth )
+{
+    Vec_Ptr_t * vNodes = Aig_ManDfs( pAig, 1 );
+    Aig_Obj_t * pObj;
+    int * pDist = ABC_ALLOC( int, Aig_ManObjNumMax(pAig) );
+    int i, Dist0, Dist1, Counter = 0;
+    Aig_ManForEachObj( pAig, pObj, i )
+        pDist[i] = nDepth + 1;
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+    {
+        Dist0 = pDist[Aig_ObjFaninId0(pObj)];
+        Dist1 = pDist[Aig_ObjFaninId1(pObj)];
+        pDist[pObj->Id] = pObj->fMarkB ? 0 : Abc_MinInt( 1 + Abc_MinInt(Dist0, Dist1), nDepth + 1 );
+        pObj->fMarkB = (pDist[pObj->Id] <= nDepth);
+        Counter += pObj->fMarkB;
+    }
+    ABC_FREE( pDist );
+    Vec_PtrFree( vNodes );
+    return Counter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs DAG-aware rewriting of the windows in parallel.]
+
+  Description [Each thread takes the next window and rewrites it using
+  its own copy of the library data. The result does not depend on the
+  order in which the threads process the windows.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+#define DAR_PAR_THR_MAX 100
+typedef struct Dar_ParMan_t_
+{
+    Vec_Ptr_t *      vWins;          // the windows
+    Dar_RwrPar_t *   pPars;          // the parameters of rewriting
+    int              fMarkedOnly;    // rewriting only the marked nodes
+    atomic_int       iNext;          // the next window to rewrite
+} Dar_ParMan_t;
+
+static void * Dar_ManRewriteWorker( void * pArg )
+{
+    Dar_ParMan_t * p = (Dar_ParMan_t *)pArg;
+    Dar_RwrPar_t Pars = *p->pPars;
+    int iWin, fStarted = Dar_LibStartThread( Pars.nSubgMax );
+    while ( (iWin = atomic_fetch_add(&p->iNext, 1)) < Vec_PtrSize(p->vWins) )
+        Dar_ManRewriteInt( (Aig_Man_t *)Vec_PtrEntry(p->vWins, iWin), &Pars, p->fMarkedOnly );
+    if ( fStarted )
+        Dar_LibStopThread();
+    return NULL;
+}
+
+static void Dar_ManRewriteParPass( Aig_Man_t * pAig, Dar_RwrPar_t * pPars, int nProcs, int nWinSize, int iShift, int fMarked, int fVerbose )
+{
+    pthread_t WorkerThread[DAR_PAR_THR_MAX];
+    Dar_ParMan_t Man, * p = &Man;
+    Vec_Wec_t * vIns  = Vec_WecAlloc( 0 );
+    Vec_Wec_t * vOuts = Vec_WecAlloc( 0 );
+    int i, status, nNodesOld = Aig_ManNodeNum( pAig );
+    abctime clk = Abc_Clock(), clkWins, clkRwr;
+    p->vWins = Dar_ManDeriveWindows( pAig, nWinSize, iShift, vIns, vOuts );
+    p->pPars = pPars;
+    p->fMarkedOnly = fMarked;
+    atomic_store( &p->iNext, 0 );
+    nProcs = Abc_MinInt( nProcs, Vec_PtrSize(p->vWins) );
+    clkWins = Abc_Clock() - clk;
+    // rewrite the windows (the main thread is one of the workers)
+    clk = Abc_Clock();
+    for ( i = 1; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Dar_ManRewriteWorker, (void *)p );  assert( status == 0 );
+    }
+    Dar_ManRewriteWorker( (void *)p );
+    for ( i = 1; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    clkRwr = Abc_Clock() - clk;
+    // put the windows back
+    clk = Abc_Clock();
+    if ( fVerbose )
+        printf( "Rewriting %d windows (%d inputs, %d outputs) using %d threads. ", 
+            Vec_PtrSize(p->vWins), Vec_WecSizeSize(vIns), Vec_WecSizeSize(vOuts), nProcs );
+    Dar_ManStitchWindows( pAig, p->vWins, vIns, vOuts, !fMarked );
+    if ( fVerbose )
+    {
+        printf( "Nodes: %d -> %d.\n", nNodesOld, Aig_ManNodeNum(pAig) );
+        ABC_PRT( "Windows  ", clkWins );
+        ABC_PRT( "Rewriting", clkRwr );
+        ABC_PRT( "Stitching", Abc_Clock() - clk );
+    }
+    Vec_PtrFree( p->vWins );
+    Vec_WecFree( vIns );
+    Vec_WecFree( vOuts );
+}
+static int Dar_ManRewritePar( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+    Dar_RwrPar_t Pars = *pPars;
+    int nProcs = Abc_MinInt( pPars->nProcs, DAR_PAR_THR_MAX );
+    int nWinSize, nMarked;
+    Aig_ManCleanup( pAig );
+    nWinSize = Abc_MinInt( pPars->nWinMax, (Aig_ManNodeNum(pAig) + nProcs - 1) / nProcs );
+    nWinSize = Abc_MaxInt( nWinSize, DAR_WIN_MIN );
+    Pars.nProcs       = 1;
+    Pars.fVerbose     = 0;
+    Pars.fVeryVerbose = 0;
+    if ( pPars->fVerbose )
+        printf( "Splitting the AIG with %d nodes into windows of %d nodes.\n", Aig_ManNodeNum(pAig), nWinSize );
+    Dar_ManRewriteParPass( pAig, &Pars, nProcs, nWinSize, 0, 0, pPars->fVerbose );
+    // the second pass rewrites the nodes near the boundaries of the first one
+    nMarked = Dar_ManMarkBoundary( pAig, DAR_WIN_DEPTH );
+    if ( pPars->fVerbose )
+        printf( "Rewriting %d nodes near the boundaries of the windows.\n", nMarked );
+    Dar_ManRewriteParPass( pAig, &Pars, nProcs, nWinSize, nWinSize / 2, 1, pPars->fVerbose );
+    Aig_ManCleanMarkB( pAig );
+    Aig_ManCheckPhase( pAig );
+    if ( !Aig_ManCheck( pAig ) )
+    {
+        printf( "Aig_ManRewrite: The network check has failed.\n" );
+        return 0;
+    }
+    return 1;
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Performs DAG-aware rewriting.]
+
+  Description [The library of subgraphs keeps the data of the current
+  evaluation, so each call works with its own copy of this data (see
+  Dar_LibStartThread) and the calls from different threads can run at 
+  the same time. With several threads (pPars->nProcs), the AIG is split into windows
+  of at most pPars->nWinMax nodes, which are rewritten concurrently.
+  The nodes used outside of a window are kept, so the result is close
+  but not always identical to serial rewriting.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+    int RetValue, fStarted = Dar_LibStartThread( pPars->nSubgMax );
+#ifdef ABC_USE_PTHREADS
+    if ( pPars->nProcs > 1 && !pPars->fPower && Aig_ManNodeNum(pAig) > 2 * DAR_WIN_MIN )
+        RetValue = Dar_ManRewritePar( pAig, pPars );
+    else
+#endif
+    RetValue = Dar_ManRewriteInt( pAig, pPars, 0 );
+    if ( fStarted )
+        Dar_LibStopThread();
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the total number of cuts.]
@@ -22,6 +22,17 @@
 #include "aig/gia/gia.h"
 #include "dar.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -103,10 +114,27 @@ struct Dar_Lib_t_ // library
     char *           pPhases; 
     char *           pPerms; 
     unsigned char *  pMap;
+    // per-thread copy
+    int              fCopy;         // the copy shares all but the objects and their data
 };
 
 static Dar_Lib_t * s_DarLib = NULL;
 
+// the copy of the library used by the current thread (see Dar_LibStartThread)
+static ABC_THREAD_LOCAL Dar_Lib_t * s_DarLibThread = NULL;
+
+// the shared library is prepared and copied by one thread at a time
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_DarLibMutex = PTHREAD_MUTEX_INITIALIZER;
+static inline void Dar_LibLock()   { pthread_mutex_lock( &s_DarLibMutex );   }
+static inline void Dar_LibUnlock() { pthread_mutex_unlock( &s_DarLibMutex ); }
+#else
+static inline void Dar_LibLock()   {}
+static inline void Dar_LibUnlock() {}
+#endif
+
+static inline Dar_Lib_t *    Dar_LibCur()                           { return s_DarLibThread ? s_DarLibThread : s_DarLib; }
+
 static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
 static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
 
@@ -193,7 +221,7 @@ void Dar_LibFree( Dar_Lib_t * p )
 ***********************************************************************/
 int Dar_LibReturnClass( unsigned uTruth )
 {
-    return s_DarLib->pMap[uTruth & 0xffff];
+    return Dar_LibCur()->pMap[uTruth & 0xffff];
 }
 
 
@@ -214,9 +242,9 @@ void Dar_LibReturnCanonicals( unsigned * pCanons )
     int i, k;
     // find canonical truth tables
     for ( i = k = 0; i < (1<<16); i++ )
-        if ( !Visits[s_DarLib->pMap[i]] )
+        if ( !Visits[Dar_LibCur()->pMap[i]] )
         {
-            Visits[s_DarLib->pMap[i]] = 1;
+            Visits[Dar_LibCur()->pMap[i]] = 1;
             pCanons[k++] = ((i<<16) | i);
         }
     assert( k == 222 );
@@ -477,9 +505,10 @@ void Dar_LibSetup0_rec( Dar_Lib_t * p, Dar_LibObj_t * pObj, int Class, int fColl
 ***********************************************************************/
 void Dar_LibPrepare( int nSubgraphs )
 {
-    Dar_Lib_t * p = s_DarLib;
+    Dar_Lib_t * p = Dar_LibCur();
     int i, k, nNodes0Total;
-    if ( p->nSubgraphs == nSubgraphs )
+    // the copy of a thread shares the subgraphs prepared before it was started
+    if ( p->fCopy || p->nSubgraphs == nSubgraphs )
         return;
 
     // favor special classes:
@@ -619,6 +648,75 @@ void Dar_LibStop()
     s_DarLib = NULL;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the copy of the library for the current thread.]
+
+  Description [The evaluation of a cut writes into the library objects
+  and their data, so each thread evaluating cuts concurrently with other 
+  threads gets its own copy of these and of the subgraphs prepared for
+  nSubgraphs subgraphs per class, while the library subgraphs, the 
+  priorities and the NPN tables are shared. The shared library should be 
+  started before calling this procedure. It is prepared and copied under 
+  a mutex, so the copy does not depend on later preparations of the shared 
+  library for other numbers of subgraphs. Returns 0 if the current thread 
+  already has its copy, which is then used as it is.]
+               
+  SideEffects []
+
+  SeeAlso     [Dar_LibStopThread]
+
+***********************************************************************/
+int Dar_LibStartThread( int nSubgraphs )
+{
+    Dar_Lib_t * p, * pLib = s_DarLib;
+    int i;
+    assert( s_DarLib != NULL );
+    if ( s_DarLibThread != NULL )
+        return 0;
+    Dar_LibLock();
+    Dar_LibPrepare( nSubgraphs );
+    p = ABC_ALLOC( Dar_Lib_t, 1 );
+    memcpy( p, pLib, sizeof(Dar_Lib_t) );
+    p->pObjs  = ABC_ALLOC( Dar_LibObj_t, p->nObjs );
+    memcpy( p->pObjs, pLib->pObjs, sizeof(Dar_LibObj_t) * p->nObjs );
+    p->pDatas = ABC_CALLOC( Dar_LibDat_t, p->nDatas );
+    p->pSubgr0Mem = ABC_ALLOC( int, pLib->nSubgrTotal );
+    memcpy( p->pSubgr0Mem, pLib->pSubgr0Mem, sizeof(int) * pLib->nSubgrTotal );
+    p->pNodes0Mem = ABC_ALLOC( int, pLib->nNodesTotal );
+    memcpy( p->pNodes0Mem, pLib->pNodes0Mem, sizeof(int) * pLib->nNodesTotal );
+    for ( i = 0; i < 222; i++ )
+    {
+        p->pSubgr0[i] = p->pSubgr0Mem + (pLib->pSubgr0[i] - pLib->pSubgr0Mem);
+        p->pNodes0[i] = p->pNodes0Mem + (pLib->pNodes0[i] - pLib->pNodes0Mem);
+    }
+    Dar_LibUnlock();
+    p->fCopy  = 1;
+    s_DarLibThread = p;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the copy of the library for the current thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     [Dar_LibStartThread]
+
+***********************************************************************/
+void Dar_LibStopThread()
+{
+    assert( s_DarLibThread != NULL && s_DarLibThread->fCopy );
+    ABC_FREE( s_DarLibThread->pObjs );
+    ABC_FREE( s_DarLibThread->pDatas );
+    ABC_FREE( s_DarLibThread->pSubgr0Mem );
+    ABC_FREE( s_DarLibThread->pNodes0Mem );
+    ABC_FREE( s_DarLibThread );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Updates the score of the class and adjusts the priority of this class.]
@@ -632,12 +730,12 @@ void Dar_LibStop()
 ***********************************************************************/
 void Dar_LibIncrementScore( int Class, int Out, int Gain )
 {
-    int * pPrios = s_DarLib->pPrios[Class];  // pPrios[i] = Out
-    int * pPlace = s_DarLib->pPlace[Class];  // pPlace[Out] = i
-    int * pScore = s_DarLib->pScore[Class];  // score of Out
+    int * pPrios = Dar_LibCur()->pPrios[Class];  // pPrios[i] = Out
+    int * pPlace = Dar_LibCur()->pPlace[Class];  // pPlace[Out] = i
+    int * pScore = Dar_LibCur()->pScore[Class];  // score of Out
     int Out2;
     assert( Class >= 0 && Class < 222 );
-    assert( Out >= 0 && Out < s_DarLib->nSubgr[Class] );
+    assert( Out >= 0 && Out < Dar_LibCur()->nSubgr[Class] );
     assert( pPlace[pPrios[Out]] == Out );
     // increment the score
     pScore[Out] += Gain;
@@ -668,16 +766,16 @@ void Dar_LibIncrementScore( int Class, int Out, int Gain )
 void Dar_LibDumpPriorities()
 {
     int i, k, Out, Out2, Counter = 0, Printed = 0;
-    printf( "\nOutput priorities (total = %d):\n", s_DarLib->nSubgrTotal );
+    printf( "\nOutput priorities (total = %d):\n", Dar_LibCur()->nSubgrTotal );
     for ( i = 0; i < 222; i++ )
     {
 //        printf( "Class%d: ", i );
-        for ( k = 0; k < s_DarLib->nSubgr[i]; k++ )
+        for ( k = 0; k < Dar_LibCur()->nSubgr[i]; k++ )
         {
-            Out = s_DarLib->pPrios[i][k];
-            Out2 = k == 0 ? Out : s_DarLib->pPrios[i][k-1];
-            assert( s_DarLib->pScore[i][Out2] >= s_DarLib->pScore[i][Out] );
-//            printf( "%d(%d), ", Out, s_DarLib->pScore[i][Out] );
+            Out = Dar_LibCur()->pPrios[i][k];
+            Out2 = k == 0 ? Out : Dar_LibCur()->pPrios[i][k-1];
+            assert( Dar_LibCur()->pScore[i][Out2] >= Dar_LibCur()->pScore[i][Out] );
+//            printf( "%d(%d), ", Out, Dar_LibCur()->pScore[i][Out] );
             printf( "%d, ", Out );
             Printed++;
             if ( ++Counter == 15 )
@@ -688,7 +786,7 @@ void Dar_LibDumpPriorities()
         }
     }
     printf( "\n" );
-    assert( Printed == s_DarLib->nSubgrTotal );
+    assert( Printed == Dar_LibCur()->nSubgrTotal );
 }
 
 
@@ -711,8 +809,8 @@ int Dar_LibCutMatch( Dar_Man_t * p, Dar_Cut_t * pCut )
     int i;
     assert( pCut->nLeaves == 4 );
     // get the fanin permutation
-    uPhase = s_DarLib->pPhases[pCut->uTruth];
-    pPerm = s_DarLib->pPerms4[ (int)s_DarLib->pPerms[pCut->uTruth] ];
+    uPhase = Dar_LibCur()->pPhases[pCut->uTruth];
+    pPerm = Dar_LibCur()->pPerms4[ (int)Dar_LibCur()->pPerms[pCut->uTruth] ];
     // collect fanins with the corresponding permutation/phase
     for ( i = 0; i < (int)pCut->nLeaves; i++ )
     {
@@ -723,13 +821,13 @@ int Dar_LibCutMatch( Dar_Man_t * p, Dar_Cut_t * pCut )
             return 0;
         }
         pFanin = Aig_NotCond(pFanin, ((uPhase >> i) & 1) );
-        s_DarLib->pDatas[i].pFunc = pFanin;
-        s_DarLib->pDatas[i].Level = Aig_Regular(pFanin)->Level;
+        Dar_LibCur()->pDatas[i].pFunc = pFanin;
+        Dar_LibCur()->pDatas[i].Level = Aig_Regular(pFanin)->Level;
         // copy the propability of node being one
         if ( p->pPars->fPower )
         {
             float Prob = Abc_Int2Float( Vec_IntEntry( p->pAig->vProbs, Aig_ObjId(Aig_Regular(pFanin)) ) );
-            s_DarLib->pDatas[i].dProb = Aig_IsComplement(pFanin)? 1.0-Prob : Prob;
+            Dar_LibCur()->pDatas[i].dProb = Aig_IsComplement(pFanin)? 1.0-Prob : Prob;
         }
     }
     p->nCutsGood++;
@@ -754,12 +852,12 @@ int Dar_LibCutMarkMffc( Aig_Man_t * p, Aig_Obj_t * pRoot, int nLeaves, float * p
     int i, nNodes;
     // mark the cut leaves
     for ( i = 0; i < nLeaves; i++ )
-        Aig_Regular(s_DarLib->pDatas[i].pFunc)->nRefs++;
+        Aig_Regular(Dar_LibCur()->pDatas[i].pFunc)->nRefs++;
     // label MFFC with current ID
     nNodes = Aig_NodeMffcLabel( p, pRoot, pPower );
     // unmark the cut leaves
     for ( i = 0; i < nLeaves; i++ )
-        Aig_Regular(s_DarLib->pDatas[i].pFunc)->nRefs--;
+        Aig_Regular(Dar_LibCur()->pDatas[i].pFunc)->nRefs--;
     return nNodes;
 }
 
@@ -778,14 +876,14 @@ void Dar_LibObjPrint_rec( Dar_LibObj_t * pObj )
 {
     if ( pObj->fTerm )
     {
-        printf( "%c", 'a' + (int)(pObj - s_DarLib->pObjs) );
+        printf( "%c", 'a' + (int)(pObj - Dar_LibCur()->pObjs) );
         return;
     }
     printf( "(" );
-    Dar_LibObjPrint_rec( Dar_LibObj(s_DarLib, pObj->Fan0) );
+    Dar_LibObjPrint_rec( Dar_LibObj(Dar_LibCur(), pObj->Fan0) );
     if ( pObj->fCompl0 )
         printf( "\'" );
-    Dar_LibObjPrint_rec( Dar_LibObj(s_DarLib, pObj->Fan1) );
+    Dar_LibObjPrint_rec( Dar_LibObj(Dar_LibCur(), pObj->Fan1) );
     if ( pObj->fCompl0 )
         printf( "\'" );
     printf( ")" );
@@ -809,22 +907,22 @@ void Dar_LibEvalAssignNums( Dar_Man_t * p, int Class, Aig_Obj_t * pRoot )
     Dar_LibDat_t * pData, * pData0, * pData1;
     Aig_Obj_t * pFanin0, * pFanin1;
     int i;
-    for ( i = 0; i < s_DarLib->nNodes0[Class]; i++ )
+    for ( i = 0; i < Dar_LibCur()->nNodes0[Class]; i++ )
     {
         // get one class node, assign its temporary number and set its data
-        pObj = Dar_LibObj(s_DarLib, s_DarLib->pNodes0[Class][i]);
+        pObj = Dar_LibObj(Dar_LibCur(), Dar_LibCur()->pNodes0[Class][i]);
         pObj->Num = 4 + i;
-        assert( (int)pObj->Num < s_DarLib->nNodes0Max + 4 );
-        pData = s_DarLib->pDatas + pObj->Num;
+        assert( (int)pObj->Num < Dar_LibCur()->nNodes0Max + 4 );
+        pData = Dar_LibCur()->pDatas + pObj->Num;
         pData->fMffc = 0;
         pData->pFunc = NULL;
         pData->TravId = 0xFFFF;
 
         // explore the fanins
-        assert( (int)Dar_LibObj(s_DarLib, pObj->Fan0)->Num < s_DarLib->nNodes0Max + 4 );
-        assert( (int)Dar_LibObj(s_DarLib, pObj->Fan1)->Num < s_DarLib->nNodes0Max + 4 );
-        pData0 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
-        pData1 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
+        assert( (int)Dar_LibObj(Dar_LibCur(), pObj->Fan0)->Num < Dar_LibCur()->nNodes0Max + 4 );
+        assert( (int)Dar_LibObj(Dar_LibCur(), pObj->Fan1)->Num < Dar_LibCur()->nNodes0Max + 4 );
+        pData0 = Dar_LibCur()->pDatas + Dar_LibObj(Dar_LibCur(), pObj->Fan0)->Num;
+        pData1 = Dar_LibCur()->pDatas + Dar_LibObj(Dar_LibCur(), pObj->Fan1)->Num;
         pData->Level = 1 + Abc_MaxInt(pData0->Level, pData1->Level);
         if ( pData0->pFunc == NULL || pData1->pFunc == NULL )
             continue;
@@ -867,7 +965,7 @@ int Dar_LibEval_rec( Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required
     int Area;
     if ( pPower )
         *pPower = (float)0.0;
-    pData = s_DarLib->pDatas + pObj->Num;
+    pData = Dar_LibCur()->pDatas + pObj->Num;
     if ( pData->TravId == Out )
         return 0;
     pData->TravId = Out;
@@ -888,16 +986,16 @@ int Dar_LibEval_rec( Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required
     }
     // this is a new node - get a bound on the area of its branches
     nNodesSaved--;
-    Area = Dar_LibEval_rec( Dar_LibObj(s_DarLib, pObj->Fan0), Out, nNodesSaved, Required+1, pPower? &Power0 : NULL );
+    Area = Dar_LibEval_rec( Dar_LibObj(Dar_LibCur(), pObj->Fan0), Out, nNodesSaved, Required+1, pPower? &Power0 : NULL );
     if ( Area > nNodesSaved )
         return 0xff;
-    Area += Dar_LibEval_rec( Dar_LibObj(s_DarLib, pObj->Fan1), Out, nNodesSaved, Required+1, pPower? &Power1 : NULL );
+    Area += Dar_LibEval_rec( Dar_LibObj(Dar_LibCur(), pObj->Fan1), Out, nNodesSaved, Required+1, pPower? &Power1 : NULL );
     if ( Area > nNodesSaved )
         return 0xff;
     if ( pPower )
     {
-        Dar_LibDat_t * pData0 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
-        Dar_LibDat_t * pData1 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
+        Dar_LibDat_t * pData0 = Dar_LibCur()->pDatas + Dar_LibObj(Dar_LibCur(), pObj->Fan0)->Num;
+        Dar_LibDat_t * pData1 = Dar_LibCur()->pDatas + Dar_LibObj(Dar_LibCur(), pObj->Fan1)->Num;
         pData->dProb = (pObj->fCompl0? 1.0 - pData0->dProb : pData0->dProb)*
                        (pObj->fCompl1? 1.0 - pData1->dProb : pData1->dProb);
         *pPower = Power0 + 2.0 * pData0->dProb * (1.0 - pData0->dProb) +
@@ -932,15 +1030,15 @@ void Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Requir
     // mark MFFC of the node
     nNodesSaved = Dar_LibCutMarkMffc( p->pAig, pRoot, pCut->nLeaves, p->pPars->fPower? &PowerSaved : NULL );
     // evaluate the cut
-    Class = s_DarLib->pMap[pCut->uTruth];
+    Class = Dar_LibCur()->pMap[pCut->uTruth];
     Dar_LibEvalAssignNums( p, Class, pRoot );
     // profile outputs by their savings
-    p->nTotalSubgs += s_DarLib->nSubgr0[Class];
-    p->ClassSubgs[Class] += s_DarLib->nSubgr0[Class];
-    for ( Out = 0; Out < s_DarLib->nSubgr0[Class]; Out++ )
+    p->nTotalSubgs += Dar_LibCur()->nSubgr0[Class];
+    p->ClassSubgs[Class] += Dar_LibCur()->nSubgr0[Class];
+    for ( Out = 0; Out < Dar_LibCur()->nSubgr0[Class]; Out++ )
     {
-        pObj = Dar_LibObj(s_DarLib, s_DarLib->pSubgr0[Class][Out]);
-        if ( Aig_Regular(s_DarLib->pDatas[pObj->Num].pFunc) == pRoot )
+        pObj = Dar_LibObj(Dar_LibCur(), Dar_LibCur()->pSubgr0[Class][Out]);
+        if ( Aig_Regular(Dar_LibCur()->pDatas[pObj->Num].pFunc) == pRoot )
             continue;
         nNodesAdded = Dar_LibEval_rec( pObj, Out, nNodesSaved - !p->pPars->fUseZeros, Required, p->pPars->fPower? &PowerAdded : NULL );
         nNodesGained = nNodesSaved - nNodesAdded;
@@ -951,15 +1049,15 @@ void Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Requir
         if ( nNodesGained < 0 || (nNodesGained == 0 && !p->pPars->fUseZeros) )
             continue;
         if ( nNodesGained <  p->GainBest || 
-            (nNodesGained == p->GainBest && s_DarLib->pDatas[pObj->Num].Level >= p->LevelBest) )
+            (nNodesGained == p->GainBest && Dar_LibCur()->pDatas[pObj->Num].Level >= p->LevelBest) )
             continue;
         // remember this possibility
         Vec_PtrClear( p->vLeavesBest );
         for ( k = 0; k < (int)pCut->nLeaves; k++ )
-            Vec_PtrPush( p->vLeavesBest, s_DarLib->pDatas[k].pFunc );
-        p->OutBest    = s_DarLib->pSubgr0[Class][Out];
+            Vec_PtrPush( p->vLeavesBest, Dar_LibCur()->pDatas[k].pFunc );
+        p->OutBest    = Dar_LibCur()->pSubgr0[Class][Out];
         p->OutNumBest = Out;
-        p->LevelBest  = s_DarLib->pDatas[pObj->Num].Level;
+        p->LevelBest  = Dar_LibCur()->pDatas[pObj->Num].Level;
         p->GainBest   = nNodesGained;
         p->ClassBest  = Class;
         assert( p->LevelBest <= Required );
@@ -986,9 +1084,9 @@ void Dar_LibBuildClear_rec( Dar_LibObj_t * pObj, int * pCounter )
     if ( pObj->fTerm )
         return;
     pObj->Num = (*pCounter)++;
-    s_DarLib->pDatas[ pObj->Num ].pFunc = NULL;
-    Dar_LibBuildClear_rec( Dar_LibObj(s_DarLib, pObj->Fan0), pCounter );
-    Dar_LibBuildClear_rec( Dar_LibObj(s_DarLib, pObj->Fan1), pCounter );
+    Dar_LibCur()->pDatas[ pObj->Num ].pFunc = NULL;
+    Dar_LibBuildClear_rec( Dar_LibObj(Dar_LibCur(), pObj->Fan0), pCounter );
+    Dar_LibBuildClear_rec( Dar_LibObj(Dar_LibCur(), pObj->Fan1), pCounter );
 }
 
 /**Function*************************************************************
@@ -1005,11 +1103,11 @@ void Dar_LibBuildClear_rec( Dar_LibObj_t * pObj, int * pCounter )
 Aig_Obj_t * Dar_LibBuildBest_rec( Dar_Man_t * p, Dar_LibObj_t * pObj )
 {
     Aig_Obj_t * pFanin0, * pFanin1;
-    Dar_LibDat_t * pData = s_DarLib->pDatas + pObj->Num;
+    Dar_LibDat_t * pData = Dar_LibCur()->pDatas + pObj->Num;
     if ( pData->pFunc )
         return pData->pFunc;
-    pFanin0 = Dar_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, pObj->Fan0) );
-    pFanin1 = Dar_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, pObj->Fan1) );
+    pFanin0 = Dar_LibBuildBest_rec( p, Dar_LibObj(Dar_LibCur(), pObj->Fan0) );
+    pFanin1 = Dar_LibBuildBest_rec( p, Dar_LibObj(Dar_LibCur(), pObj->Fan1) );
     pFanin0 = Aig_NotCond( pFanin0, pObj->fCompl0 );
     pFanin1 = Aig_NotCond( pFanin1, pObj->fCompl1 );
     pData->pFunc = Aig_And( p->pAig, pFanin0, pFanin1 );
@@ -1032,9 +1130,9 @@ Aig_Obj_t * Dar_LibBuildBest( Dar_Man_t * p )
 {
     int i, Counter = 4;
     for ( i = 0; i < Vec_PtrSize(p->vLeavesBest); i++ )
-        s_DarLib->pDatas[i].pFunc = (Aig_Obj_t *)Vec_PtrEntry( p->vLeavesBest, i );
-    Dar_LibBuildClear_rec( Dar_LibObj(s_DarLib, p->OutBest), &Counter );
-    return Dar_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, p->OutBest) );
+        Dar_LibCur()->pDatas[i].pFunc = (Aig_Obj_t *)Vec_PtrEntry( p->vLeavesBest, i );
+    Dar_LibBuildClear_rec( Dar_LibObj(Dar_LibCur(), p->OutBest), &Counter );
+    return Dar_LibBuildBest_rec( p, Dar_LibObj(Dar_LibCur(), p->OutBest) );
 }
 
 
@@ -1060,16 +1158,16 @@ int Dar2_LibCutMatch( Gia_Man_t * p, Vec_Int_t * vCutLits, unsigned uTruth )
     int i;
     assert( Vec_IntSize(vCutLits) == 4 );
     // get the fanin permutation
-    uPhase = s_DarLib->pPhases[uTruth];
-    pPerm  = s_DarLib->pPerms4[ (int)s_DarLib->pPerms[uTruth] ];
+    uPhase = Dar_LibCur()->pPhases[uTruth];
+    pPerm  = Dar_LibCur()->pPerms4[ (int)Dar_LibCur()->pPerms[uTruth] ];
     // collect fanins with the corresponding permutation/phase
     for ( i = 0; i < Vec_IntSize(vCutLits); i++ )
     {
 //        pFanin = Gia_ManObj( p, pCut->pLeaves[ (int)pPerm[i] ] );
 //        pFanin = Gia_ManObj( p, Vec_IntEntry( vCutLits, (int)pPerm[i] ) );
 //        pFanin = Gia_ObjFromLit( p, Vec_IntEntry( vCutLits, (int)pPerm[i] ) );
-        s_DarLib->pDatas[i].iGunc = Abc_LitNotCond( Vec_IntEntry(vCutLits, (int)pPerm[i]), ((uPhase >> i) & 1) );
-        s_DarLib->pDatas[i].Level = Gia_ObjLevel( p, Gia_Regular(Gia_ObjFromLit(p, s_DarLib->pDatas[i].iGunc)) );
+        Dar_LibCur()->pDatas[i].iGunc = Abc_LitNotCond( Vec_IntEntry(vCutLits, (int)pPerm[i]), ((uPhase >> i) & 1) );
+        Dar_LibCur()->pDatas[i].Level = Gia_ObjLevel( p, Gia_Regular(Gia_ObjFromLit(p, Dar_LibCur()->pDatas[i].iGunc)) );
     }
     return 1;
 }
@@ -1090,22 +1188,22 @@ void Dar2_LibEvalAssignNums( Gia_Man_t * p, int Class )
     Dar_LibObj_t * pObj;
     Dar_LibDat_t * pData, * pData0, * pData1;
     int iFanin0, iFanin1, i, iLit;
-    for ( i = 0; i < s_DarLib->nNodes0[Class]; i++ )
+    for ( i = 0; i < Dar_LibCur()->nNodes0[Class]; i++ )
     {
         // get one class node, assign its temporary number and set its data
-        pObj = Dar_LibObj(s_DarLib, s_DarLib->pNodes0[Class][i]);
+        pObj = Dar_LibObj(Dar_LibCur(), Dar_LibCur()->pNodes0[Class][i]);
         pObj->Num = 4 + i;
-        assert( (int)pObj->Num < s_DarLib->nNodes0Max + 4 );
-        pData = s_DarLib->pDatas + pObj->Num;
+        assert( (int)pObj->Num < Dar_LibCur()->nNodes0Max + 4 );
+        pData = Dar_LibCur()->pDatas + pObj->Num;
         pData->fMffc = 0;
         pData->iGunc = -1;
         pData->TravId = 0xFFFF;
 
         // explore the fanins
-        assert( (int)Dar_LibObj(s_DarLib, pObj->Fan0)->Num < s_DarLib->nNodes0Max + 4 );
-        assert( (int)Dar_LibObj(s_DarLib, pObj->Fan1)->Num < s_DarLib->nNodes0Max + 4 );
-        pData0 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
-        pData1 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
+        assert( (int)Dar_LibObj(Dar_LibCur(), pObj->Fan0)->Num < Dar_LibCur()->nNodes0Max + 4 );
+        assert( (int)Dar_LibObj(Dar_LibCur(), pObj->Fan1)->Num < Dar_LibCur()->nNodes0Max + 4 );
+        pData0 = Dar_LibCur()->pDatas + Dar_LibObj(Dar_LibCur(), pObj->Fan0)->Num;
+        pData1 = Dar_LibCur()->pDatas + Dar_LibObj(Dar_LibCur(), pObj->Fan1)->Num;
         pData->Level = 1 + Abc_MaxInt(pData0->Level, pData1->Level);
         if ( pData0->iGunc == -1 || pData1->iGunc == -1 )
             continue;
@@ -1150,7 +1248,7 @@ int Dar2_LibEval_rec( Dar_LibObj_t * pObj, int Out )
 {
     Dar_LibDat_t * pData;
     int Area;
-    pData = s_DarLib->pDatas + pObj->Num;
+    pData = Dar_LibCur()->pDatas + pObj->Num;
     if ( pData->TravId == Out )
         return 0;
     pData->TravId = Out;
@@ -1161,10 +1259,10 @@ int Dar2_LibEval_rec( Dar_LibObj_t * pObj, int Out )
         return 0;
     // this is a new node - get a bound on the area of its branches
 //    nNodesSaved--;
-    Area = Dar2_LibEval_rec( Dar_LibObj(s_DarLib, pObj->Fan0), Out );
+    Area = Dar2_LibEval_rec( Dar_LibObj(Dar_LibCur(), pObj->Fan0), Out );
 //    if ( Area > nNodesSaved )
 //        return 0xff;
-    Area += Dar2_LibEval_rec( Dar_LibObj(s_DarLib, pObj->Fan1), Out );
+    Area += Dar2_LibEval_rec( Dar_LibObj(Dar_LibCur(), pObj->Fan1), Out );
 //    if ( Area > nNodesSaved )
 //        return 0xff;
     return Area + 1;
@@ -1201,36 +1299,36 @@ int Dar2_LibEval( Gia_Man_t * p, Vec_Int_t * vCutLits, unsigned uTruth, int fKee
 //    nNodesSaved = Dar2_LibCutMarkMffc( p->pAig, pRoot, pCut->nLeaves, p->pPars->fPower? &PowerSaved : NULL );
     nNodesSaved = 0;
     // evaluate the cut
-    Class = s_DarLib->pMap[uTruth];
+    Class = Dar_LibCur()->pMap[uTruth];
     Dar2_LibEvalAssignNums( p, Class );
     // profile outputs by their savings
-//    p->nTotalSubgs += s_DarLib->nSubgr0[Class];
-//    p->ClassSubgs[Class] += s_DarLib->nSubgr0[Class];
-    for ( Out = 0; Out < s_DarLib->nSubgr0[Class]; Out++ )
+//    p->nTotalSubgs += Dar_LibCur()->nSubgr0[Class];
+//    p->ClassSubgs[Class] += Dar_LibCur()->nSubgr0[Class];
+    for ( Out = 0; Out < Dar_LibCur()->nSubgr0[Class]; Out++ )
     {
-        pObj = Dar_LibObj(s_DarLib, s_DarLib->pSubgr0[Class][Out]);
+        pObj = Dar_LibObj(Dar_LibCur(), Dar_LibCur()->pSubgr0[Class][Out]);
 //        nNodesAdded = Dar2_LibEval_rec( pObj, Out, nNodesSaved - !p->pPars->fUseZeros, Required, p->pPars->fPower? &PowerAdded : NULL );
         nNodesAdded = Dar2_LibEval_rec( pObj, Out );
         nNodesGained = nNodesSaved - nNodesAdded;
         if ( fKeepLevel )
         {
-            if ( s_DarLib->pDatas[pObj->Num].Level >  p_LevelBest || 
-                (s_DarLib->pDatas[pObj->Num].Level == p_LevelBest && nNodesGained <= p_GainBest) )
+            if ( Dar_LibCur()->pDatas[pObj->Num].Level >  p_LevelBest || 
+                (Dar_LibCur()->pDatas[pObj->Num].Level == p_LevelBest && nNodesGained <= p_GainBest) )
                 continue;
         }
         else
         {
             if ( nNodesGained <  p_GainBest || 
-                (nNodesGained == p_GainBest && s_DarLib->pDatas[pObj->Num].Level >= p_LevelBest) )
+                (nNodesGained == p_GainBest && Dar_LibCur()->pDatas[pObj->Num].Level >= p_LevelBest) )
                 continue;
         }
         // remember this possibility
         Vec_IntClear( vLeavesBest2 );
         for ( k = 0; k < Vec_IntSize(vCutLits); k++ )
-            Vec_IntPush( vLeavesBest2, s_DarLib->pDatas[k].iGunc );
-        p_OutBest    = s_DarLib->pSubgr0[Class][Out];
+            Vec_IntPush( vLeavesBest2, Dar_LibCur()->pDatas[k].iGunc );
+        p_OutBest    = Dar_LibCur()->pSubgr0[Class][Out];
         p_OutNumBest = Out;
-        p_LevelBest  = s_DarLib->pDatas[pObj->Num].Level;
+        p_LevelBest  = Dar_LibCur()->pDatas[pObj->Num].Level;
         p_GainBest   = nNodesGained;
         p_ClassBest  = Class;
 //        assert( p_LevelBest <= Required );
@@ -1258,9 +1356,9 @@ void Dar2_LibBuildClear_rec( Dar_LibObj_t * pObj, int * pCounter )
     if ( pObj->fTerm )
         return;
     pObj->Num = (*pCounter)++;
-    s_DarLib->pDatas[ pObj->Num ].iGunc = -1;
-    Dar2_LibBuildClear_rec( Dar_LibObj(s_DarLib, pObj->Fan0), pCounter );
-    Dar2_LibBuildClear_rec( Dar_LibObj(s_DarLib, pObj->Fan1), pCounter );
+    Dar_LibCur()->pDatas[ pObj->Num ].iGunc = -1;
+    Dar2_LibBuildClear_rec( Dar_LibObj(Dar_LibCur(), pObj->Fan0), pCounter );
+    Dar2_LibBuildClear_rec( Dar_LibObj(Dar_LibCur(), pObj->Fan1), pCounter );
 }
 
 /**Function*************************************************************
@@ -1279,11 +1377,11 @@ int Dar2_LibBuildBest_rec( Gia_Man_t * p, Dar_LibObj_t * pObj )
     Gia_Obj_t * pNode;
     Dar_LibDat_t * pData;
     int iFanin0, iFanin1;
-    pData = s_DarLib->pDatas + pObj->Num;
+    pData = Dar_LibCur()->pDatas + pObj->Num;
     if ( pData->iGunc >= 0 )
         return pData->iGunc;
-    iFanin0 = Dar2_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, pObj->Fan0) );
-    iFanin1 = Dar2_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, pObj->Fan1) );
+    iFanin0 = Dar2_LibBuildBest_rec( p, Dar_LibObj(Dar_LibCur(), pObj->Fan0) );
+    iFanin1 = Dar2_LibBuildBest_rec( p, Dar_LibObj(Dar_LibCur(), pObj->Fan1) );
     iFanin0 = Abc_LitNotCond( iFanin0, pObj->fCompl0 );
     iFanin1 = Abc_LitNotCond( iFanin1, pObj->fCompl1 );
     pData->iGunc = Gia_ManHashAnd( p, iFanin0, iFanin1 );
@@ -1310,9 +1408,9 @@ int Dar2_LibBuildBest( Gia_Man_t * p, Vec_Int_t * vLeavesBest2, int OutBest )
     int i, iLeaf, Counter = 4;
     assert( Vec_IntSize(vLeavesBest2) == 4 );
     Vec_IntForEachEntry( vLeavesBest2, iLeaf, i )
-        s_DarLib->pDatas[i].iGunc = iLeaf;
-    Dar2_LibBuildClear_rec( Dar_LibObj(s_DarLib, OutBest), &Counter );
-    return Dar2_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, OutBest) );
+        Dar_LibCur()->pDatas[i].iGunc = iLeaf;
+    Dar2_LibBuildClear_rec( Dar_LibObj(Dar_LibCur(), OutBest), &Counter );
+    return Dar2_LibBuildBest_rec( p, Dar_LibObj(Dar_LibCur(), OutBest) );
 }
 
 /**Function*************************************************************
@@ -589,7 +589,7 @@ char * Dau_DsdMerge( char * pDsd0i, int * pPerm0, char * pDsd1i, int * pPerm1, i
     int fVerbose = 0;
     int fCheck = 0;
     static int Counter = 0;
-    static char pRes[2*DAU_MAX_STR+10];
+    static ABC_THREAD_LOCAL char pRes[2*DAU_MAX_STR+10];
     char pDsd0[DAU_MAX_STR];
     char pDsd1[DAU_MAX_STR];
     int pMatches0[DAU_MAX_STR];
@@ -92,6 +92,7 @@ struct Fxch_Man_t_
     Vec_Wec_t* vCubes;
     int nCubesInit;
     int LitCountMax;
+    int nProcs;        /* the number of threads */
 
     /* internal data */
     Fxch_SCHashTable_t* pSCHashTable;
@@ -154,8 +155,8 @@ static inline int Fxch_CountOnes( unsigned num )
 }
 
 /*===== Fxch.c =======================================================*/
-int Abc_NtkFxchPerform( Abc_Ntk_t* pNtk, int nMaxDivExt, int fVerbose, int fVeryVerbose );
-int Fxch_FastExtract( Vec_Wec_t* vCubes, int ObjIdMax, int nMaxDivExt, int fVerbose, int fVeryVerbose );
+int Abc_NtkFxchPerform( Abc_Ntk_t* pNtk, int nMaxDivExt, int nProcs, int fVerbose, int fVeryVerbose );
+int Fxch_FastExtract( Vec_Wec_t* vCubes, int ObjIdMax, int nMaxDivExt, int nProcs, int fVerbose, int fVeryVerbose );
 
 /*===== FxchDiv.c ====================================================================================================*/
 int  Fxch_DivCreate( Fxch_Man_t* pFxchMan,  Fxch_SubCube_t* pSubCube0, Fxch_SubCube_t* pSubCube1 );
@@ -207,6 +208,21 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
                             uint32_t iLit1,
                             char fUpdate );
 
+int Fxch_SCHashTablePairAdd( Fxch_SCHashTable_t* pSCHashTable,
+                             Fxch_SubCube_t* pEntry,
+                             Fxch_SubCube_t* pNewEntry,
+                             char fUpdate );
+
+unsigned int Fxch_SCHashTableBinId( Fxch_SCHashTable_t* pSCHashTable,
+                                    uint32_t SubCubeID );
+
+int Fxch_SCHashTableInsertPar( Fxch_SCHashTable_t* pSCHashTable,
+                               Vec_Wec_t* vCubes,
+                               Fxch_SubCube_t* pSubCube,
+                               int Key,
+                               Vec_Int_t* vSubCube0,
+                               Vec_Int_t* vSubCube1,
+                               Vec_Int_t* vPairs );
 
 int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
                             Vec_Wec_t* vCubes,
@@ -17,6 +17,16 @@
 ***********************************************************************/
 #include "Fxch.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -285,10 +295,9 @@ void Fxch_ManSCHashTablesFree( Fxch_Man_t* pFxchMan )
     Fxch_SCHashTableDelete( pFxchMan->pSCHashTable );
 }
 
-void Fxch_ManDivCreate( Fxch_Man_t* pFxchMan )
+static void Fxch_ManDivCreateSerial( Fxch_Man_t* pFxchMan )
 {
     Vec_Int_t* vCube;
-    float Weight;
     int fAdd = 1,
         fUpdate = 0,
         iCube;
@@ -298,6 +307,271 @@ void Fxch_ManDivCreate( Fxch_Man_t* pFxchMan )
         Fxch_ManDivSingleCube( pFxchMan, iCube, fAdd, fUpdate );
         Fxch_ManDivDoubleCube( pFxchMan, iCube, fAdd, fUpdate );
     }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [ Collects the initial divisors using several threads. ]
+
+  Description [ The bins of the sub-cube hash table are divided into 
+                shards, one for each thread. First, each thread 
+                enumerates the sub-cubes of its range of cubes and 
+                distributes them among the shards. Next, each thread 
+                inserts the sub-cubes of its shard into the table in 
+                the order of the cubes and saves the pairs of equal 
+                sub-cubes without touching the divisors. Finally, the 
+                main thread adds the single-cube divisors and the saved 
+                pairs in the same order as Fxch_ManDivCreateSerial(), so 
+                the divisors, their weights, and the result of extraction 
+                do not depend on the number of threads. ]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+static void Fxch_ManDivCreatePar( Fxch_Man_t* pFxchMan )
+{
+    Fxch_ManDivCreateSerial( pFxchMan );
+}
+
+#else // pthreads are used
+
+#define FXCH_PAR_THR_MAX  100
+
+typedef struct Fxch_ParMan_t_ Fxch_ParMan_t;
+struct Fxch_ParMan_t_
+{
+    Fxch_Man_t*   pFxchMan;
+    int           nProcs;     /* the number of threads and shards */
+    int           fInsert;    /* the threads fill the table */
+    Vec_Int_t*    vStarts;    /* the first sub-cube of each cube */
+    Vec_Str_t*    vShards;    /* the shard of each sub-cube */
+    Vec_Wec_t*    vSubCubes;  /* the sub-cubes of each thread for each shard */
+    Vec_Wec_t*    vPairs;     /* the pairs of equal sub-cubes of each shard */
+    int*          pEntries;   /* the number of entries of each shard */
+};
+
+typedef struct Fxch_ParThr_t_ Fxch_ParThr_t;
+struct Fxch_ParThr_t_
+{
+    Fxch_ParMan_t* pPar;
+    int            iThread;
+    Vec_Int_t      vSubCube0;
+    Vec_Int_t      vSubCube1;
+};
+
+static inline void Fxch_ManSCCollect( Fxch_ParMan_t* pPar,
+                                      int iThread,
+                                      int Key,
+                                      unsigned int SubCubeID,
+                                      int iCube,
+                                      int iLit0,
+                                      int iLit1 )
+{
+    int iShard = Fxch_SCHashTableBinId( pPar->pFxchMan->pSCHashTable, SubCubeID ) % pPar->nProcs;
+    Vec_Int_t* vSubCubes = Vec_WecEntry( pPar->vSubCubes, iThread * pPar->nProcs + iShard );
+
+    Vec_StrWriteEntry( pPar->vShards, Key, (char)iShard );
+    Vec_IntPush( vSubCubes, Key );
+    Vec_IntPush( vSubCubes, (int)SubCubeID );
+    Vec_IntPush( vSubCubes, iCube );
+    Vec_IntPush( vSubCubes, iLit0 | ( iLit1 << 16 ) );
+}
+
+/* Enumerates the sub-cubes in the same order as Fxch_ManDivDoubleCube() */
+static inline void Fxch_ManDivDoubleCubeCollect( Fxch_ParMan_t* pPar,
+                                                 int iThread,
+                                                 int iCube )
+{
+    Vec_Int_t* vLitHashKeys = pPar->pFxchMan->vLitHashKeys,
+             * vCube = Vec_WecEntry( pPar->pFxchMan->vCubes, iCube );
+    int Key = Vec_IntEntry( pPar->vStarts, iCube ),
+        SubCubeID = 0,
+        iLit0,
+        Lit0;
+
+    Vec_IntForEachEntryStart( vCube, Lit0, iLit0, 1)
+        SubCubeID += Vec_IntEntry( vLitHashKeys, Lit0 );
+
+    Fxch_ManSCCollect( pPar, iThread, Key++, SubCubeID, iCube, 0, 0 );
+
+    Vec_IntForEachEntryStart( vCube, Lit0, iLit0, 1)
+    {
+        int Lit1,
+            iLit1;
+
+        SubCubeID -= Vec_IntEntry( vLitHashKeys, Lit0 );
+        Fxch_ManSCCollect( pPar, iThread, Key++, SubCubeID, iCube, iLit0, 0 );
+
+        Vec_IntForEachEntryStart( vCube, Lit1, iLit1, iLit0 + 1)
+        {
+            SubCubeID -= Vec_IntEntry( vLitHashKeys, Lit1 );
+            Fxch_ManSCCollect( pPar, iThread, Key++, SubCubeID, iCube, iLit0, iLit1 );
+            SubCubeID += Vec_IntEntry( vLitHashKeys, Lit1 );
+        }
+
+        SubCubeID += Vec_IntEntry( vLitHashKeys, Lit0 );
+    }
+    assert( Key == Vec_IntEntry( pPar->vStarts, iCube + 1 ) );
+}
+
+static void* Fxch_ManDivCreateWorker( void* pArg )
+{
+    Fxch_ParThr_t* pThr = (Fxch_ParThr_t*)pArg;
+    Fxch_ParMan_t* pPar = pThr->pPar;
+    Vec_Wec_t* vCubes = pPar->pFxchMan->vCubes;
+    Vec_Int_t* vSubCubes;
+    Fxch_SubCube_t SubCube;
+    int i, k;
+
+    if ( !pPar->fInsert )
+    {
+        /* distribute the sub-cubes of a range of cubes among the shards */
+        int iBeg = (int)( (word)Vec_WecSize( vCubes ) * pThr->iThread / pPar->nProcs ),
+            iEnd = (int)( (word)Vec_WecSize( vCubes ) * ( pThr->iThread + 1 ) / pPar->nProcs );
+
+        for ( i = iBeg; i < iEnd; i++ )
+            Fxch_ManDivDoubleCubeCollect( pPar, pThr->iThread, i );
+        return NULL;
+    }
+
+    /* insert the sub-cubes of the shard in the order of the cubes */
+    for ( k = 0; k < pPar->nProcs; k++ )
+    {
+        vSubCubes = Vec_WecEntry( pPar->vSubCubes, k * pPar->nProcs + pThr->iThread );
+        for ( i = 0; i + 3 < Vec_IntSize( vSubCubes ); i += 4 )
+        {
+            SubCube.Id    = (uint32_t)Vec_IntEntry( vSubCubes, i + 1 );
+            SubCube.iCube = (uint32_t)Vec_IntEntry( vSubCubes, i + 2 );
+            SubCube.iLit0 = (unsigned)Vec_IntEntry( vSubCubes, i + 3 ) & 0xFFFF;
+            SubCube.iLit1 = (unsigned)Vec_IntEntry( vSubCubes, i + 3 ) >> 16;
+            Fxch_SCHashTableInsertPar( pPar->pFxchMan->pSCHashTable, vCubes, &SubCube,
+                                       Vec_IntEntry( vSubCubes, i ),
+                                       &pThr->vSubCube0, &pThr->vSubCube1,
+                                       Vec_WecEntry( pPar->vPairs, pThr->iThread ) );
+            pPar->pEntries[pThr->iThread]++;
+        }
+        Vec_IntErase( vSubCubes );
+    }
+    return NULL;
+}
+
+static void Fxch_ManDivCreateRun( Fxch_ParMan_t* pPar, Fxch_ParThr_t* pThData )
+{
+    pthread_t WorkerThread[FXCH_PAR_THR_MAX];
+    int k, status;
+
+    /* the main thread is one of the workers */
+    for ( k = 1; k < pPar->nProcs; k++ )
+    {
+        status = pthread_create( WorkerThread + k, NULL, Fxch_ManDivCreateWorker, (void *)(pThData + k) );
+        assert( status == 0 );
+    }
+    Fxch_ManDivCreateWorker( pThData );
+    for ( k = 1; k < pPar->nProcs; k++ )
+    {
+        status = pthread_join( WorkerThread[k], NULL );
+        assert( status == 0 );
+    }
+}
+
+static void Fxch_ManDivCreatePar( Fxch_Man_t* pFxchMan )
+{
+    Fxch_ParMan_t Par, * pPar = &Par;
+    Fxch_ParThr_t ThData[FXCH_PAR_THR_MAX];
+    Fxch_SubCube_t Entry, NewEntry;
+    Vec_Int_t* vCube, * vPairs;
+    int* pPos;
+    int i, k, Key, iShard, nLits, nKeys = 0;
+
+    memset( pPar, 0, sizeof(Fxch_ParMan_t) );
+    pPar->pFxchMan = pFxchMan;
+    pPar->nProcs   = Abc_MinInt( pFxchMan->nProcs, FXCH_PAR_THR_MAX );
+
+    /* each cube has itself and its sub-cubes without one and two literals */
+    pPar->vStarts = Vec_IntAlloc( Vec_WecSize( pFxchMan->vCubes ) + 1 );
+    Vec_WecForEachLevel( pFxchMan->vCubes, vCube, i )
+    {
+        Vec_IntPush( pPar->vStarts, nKeys );
+        nLits = Vec_IntSize( vCube ) - 1;
+        nKeys += 1 + nLits + nLits * ( nLits - 1 ) / 2;
+    }
+    Vec_IntPush( pPar->vStarts, nKeys );
+    pPar->vShards   = Vec_StrStart( nKeys );
+    pPar->vSubCubes = Vec_WecStart( pPar->nProcs * pPar->nProcs );
+    pPar->vPairs    = Vec_WecStart( pPar->nProcs );
+    pPar->pEntries  = ABC_CALLOC( int, pPar->nProcs );
+    for ( k = 0; k < pPar->nProcs; k++ )
+    {
+        ThData[k].pPar    = pPar;
+        ThData[k].iThread = k;
+        Vec_IntZero( &ThData[k].vSubCube0 );
+        Vec_IntZero( &ThData[k].vSubCube1 );
+    }
+
+    /* fill the shards of the sub-cube table */
+    pPar->fInsert = 0;
+    Fxch_ManDivCreateRun( pPar, ThData );
+    pPar->fInsert = 1;
+    Fxch_ManDivCreateRun( pPar, ThData );
+    for ( k = 0; k < pPar->nProcs; k++ )
+        pFxchMan->pSCHashTable->nEntries += pPar->pEntries[k];
+
+    /* add the divisors in the order of the serial computation */
+    pPos = ABC_CALLOC( int, pPar->nProcs );
+    Vec_WecForEachLevel( pFxchMan->vCubes, vCube, i )
+    {
+        Fxch_ManDivSingleCube( pFxchMan, i, 1, 0 );
+
+        for ( Key = Vec_IntEntry( pPar->vStarts, i ); Key < Vec_IntEntry( pPar->vStarts, i + 1 ); Key++ )
+        {
+            iShard = Vec_StrEntry( pPar->vShards, Key );
+            vPairs = Vec_WecEntry( pPar->vPairs, iShard );
+            for ( ; pPos[iShard] < Vec_IntSize( vPairs ) && Vec_IntEntry( vPairs, pPos[iShard] ) == Key; pPos[iShard] += 5 )
+            {
+                int* pPair = Vec_IntEntryP( vPairs, pPos[iShard] );
+
+                Entry.Id       = NewEntry.Id = (uint32_t)pPair[1];
+                Entry.iCube    = (uint32_t)pPair[2];
+                Entry.iLit0    = (unsigned)pPair[3] & 0xFFFF;
+                Entry.iLit1    = (unsigned)pPair[3] >> 16;
+                NewEntry.iCube = (uint32_t)i;
+                NewEntry.iLit0 = (unsigned)pPair[4] & 0xFFFF;
+                NewEntry.iLit1 = (unsigned)pPair[4] >> 16;
+                pFxchMan->nPairsD += Fxch_SCHashTablePairAdd( pFxchMan->pSCHashTable, &Entry, &NewEntry, 0 );
+            }
+        }
+    }
+    for ( k = 0; k < pPar->nProcs; k++ )
+        assert( pPos[k] == Vec_IntSize( Vec_WecEntry( pPar->vPairs, k ) ) );
+    ABC_FREE( pPos );
+
+    for ( k = 0; k < pPar->nProcs; k++ )
+    {
+        Vec_IntErase( &ThData[k].vSubCube0 );
+        Vec_IntErase( &ThData[k].vSubCube1 );
+    }
+    Vec_IntFree( pPar->vStarts );
+    Vec_StrFree( pPar->vShards );
+    Vec_WecFree( pPar->vSubCubes );
+    Vec_WecFree( pPar->vPairs );
+    ABC_FREE( pPar->pEntries );
+}
+
+#endif // pthreads are used
+
+void Fxch_ManDivCreate( Fxch_Man_t* pFxchMan )
+{
+    float Weight;
+    int iCube;
+
+    if ( pFxchMan->nProcs > 1 )
+        Fxch_ManDivCreatePar( pFxchMan );
+    else
+        Fxch_ManDivCreateSerial( pFxchMan );
 
     pFxchMan->vDivPrio = Vec_QueAlloc( Vec_FltSize( pFxchMan->vDivWeights ) );
     Vec_QueSetPriority( pFxchMan->vDivPrio, Vec_FltArrayP( pFxchMan->vDivWeights ) );
@@ -124,7 +124,9 @@ static inline Fxch_SCHashTable_Entry_t* Fxch_SCHashTableBin( Fxch_SCHashTable_t*
 static inline int Fxch_SCHashTableEntryCompare( Fxch_SCHashTable_t* pSCHashTable,
                                                 Vec_Wec_t* vCubes,
                                                 Fxch_SubCube_t* pSCData0,
-                                                Fxch_SubCube_t* pSCData1 )
+                                                Fxch_SubCube_t* pSCData1,
+                                                Vec_Int_t* vSubCube0,
+                                                Vec_Int_t* vSubCube1 )
 {
     Vec_Int_t* vCube0 = Vec_WecEntry( vCubes, pSCData0->iCube ),
              * vCube1 = Vec_WecEntry( vCubes, pSCData1->iCube );
@@ -145,8 +147,8 @@ static inline int Fxch_SCHashTableEntryCompare( Fxch_SCHashTable_t* pSCHashTable
     if ( Result == 0 )
         return 0;
 
-    Vec_IntClear( &pSCHashTable->vSubCube0 );
-    Vec_IntClear( &pSCHashTable->vSubCube1 );
+    Vec_IntClear( vSubCube0 );
+    Vec_IntClear( vSubCube1 );
 
     if ( pSCData0->iLit1 > 0 && pSCData1->iLit1 > 0 &&
          ( Vec_IntEntry( vCube0, pSCData0->iLit0 ) == Vec_IntEntry( vCube1, pSCData1->iLit0 ) ||
@@ -156,43 +158,33 @@ static inline int Fxch_SCHashTableEntryCompare( Fxch_SCHashTable_t* pSCHashTable
         return 0;
 
     if ( pSCData0->iLit0 > 0 )
-        Vec_IntAppendSkip( &pSCHashTable->vSubCube0, vCube0, pSCData0->iLit0 );
+        Vec_IntAppendSkip( vSubCube0, vCube0, pSCData0->iLit0 );
     else
-        Vec_IntAppend( &pSCHashTable->vSubCube0, vCube0 );
+        Vec_IntAppend( vSubCube0, vCube0 );
 
     if ( pSCData1->iLit0 > 0 )
-        Vec_IntAppendSkip( &pSCHashTable->vSubCube1, vCube1, pSCData1->iLit0 );
+        Vec_IntAppendSkip( vSubCube1, vCube1, pSCData1->iLit0 );
     else
-        Vec_IntAppend( &pSCHashTable->vSubCube1, vCube1 );
+        Vec_IntAppend( vSubCube1, vCube1 );
 
     if ( pSCData0->iLit1 > 0)
-        Vec_IntDrop( &pSCHashTable->vSubCube0,
+        Vec_IntDrop( vSubCube0,
                        pSCData0->iLit0 < pSCData0->iLit1 ? pSCData0->iLit1 - 1 : pSCData0->iLit1 );
 
     if ( pSCData1->iLit1 > 0 )
-        Vec_IntDrop( &pSCHashTable->vSubCube1,
+        Vec_IntDrop( vSubCube1,
                        pSCData1->iLit0 < pSCData1->iLit1 ? pSCData1->iLit1 - 1 : pSCData1->iLit1 );
 
-    return Vec_IntEqual( &pSCHashTable->vSubCube0, &pSCHashTable->vSubCube1 );
+    return Vec_IntEqual( vSubCube0, vSubCube1 );
 }
 
-int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
-                            Vec_Wec_t* vCubes,
-                            uint32_t SubCubeID,
-                            uint32_t iCube,
-                            uint32_t iLit0,
-                            uint32_t iLit1,
-                            char fUpdate )
+static inline int Fxch_SCHashTableBinAppend( Fxch_SCHashTable_Entry_t* pBin,
+                                             uint32_t SubCubeID,
+                                             uint32_t iCube,
+                                             uint32_t iLit0,
+                                             uint32_t iLit1 )
 {
     int iNewEntry;
-    int Pairs = 0;
-    uint32_t BinID;
-    Fxch_SCHashTable_Entry_t* pBin;
-    Fxch_SubCube_t* pNewEntry;
-    int iEntry;
-
-    MurmurHash3_x86_32( ( void* ) &SubCubeID, sizeof( int ), 0x9747b28c, &BinID);
-    pBin = Fxch_SCHashTableBin( pSCHashTable, BinID );
 
     if ( pBin->vSCData == NULL )
     {
@@ -212,6 +204,77 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
     pBin->vSCData[iNewEntry].iCube = iCube;
     pBin->vSCData[iNewEntry].iLit0 = iLit0;
     pBin->vSCData[iNewEntry].iLit1 = iLit1;
+
+    return iNewEntry;
+}
+
+/* Adds the divisor of two equal sub-cubes or records a single-cube containment */
+int Fxch_SCHashTablePairAdd( Fxch_SCHashTable_t* pSCHashTable,
+                             Fxch_SubCube_t* pEntry,
+                             Fxch_SubCube_t* pNewEntry,
+                             char fUpdate )
+{
+    int* pOutputID0 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
+    int* pOutputID1 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pNewEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
+    int Result = 0;
+    int Base;
+    int iNewDiv = -1, i, z;
+
+    if ( ( pEntry->iLit0 == 0 ) || ( pNewEntry->iLit0 == 0 ) )
+    {
+        Vec_Int_t* vCube0 = Fxch_ManGetCube( pSCHashTable->pFxchMan, pEntry->iCube ),
+                 * vCube1 = Fxch_ManGetCube( pSCHashTable->pFxchMan, pNewEntry->iCube );
+
+        if ( Vec_IntSize( vCube0 ) > Vec_IntSize( vCube1 ) )
+        {
+            Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pEntry->iCube );
+            Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube );
+        }
+        else
+        {
+            Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube );
+            Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pEntry->iCube );
+        }
+
+        return 0;
+    }
+
+    Base = Fxch_DivCreate( pSCHashTable->pFxchMan, pEntry, pNewEntry );
+
+    if ( Base < 0 )
+        return 0;
+
+    for ( i = 0; i < pSCHashTable->pFxchMan->nSizeOutputID; i++ )
+        Result += Fxch_CountOnes( pOutputID0[i] & pOutputID1[i] );
+
+    for ( z = 0; z < Result; z++ )
+        iNewDiv = Fxch_DivAdd( pSCHashTable->pFxchMan, fUpdate, 0, Base );
+
+    Vec_WecPush( pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pEntry->iCube );
+    Vec_WecPush( pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pNewEntry->iCube );
+
+    return 1;
+}
+
+int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
+                            Vec_Wec_t* vCubes,
+                            uint32_t SubCubeID,
+                            uint32_t iCube,
+                            uint32_t iLit0,
+                            uint32_t iLit1,
+                            char fUpdate )
+{
+    int iNewEntry;
+    int Pairs = 0;
+    uint32_t BinID;
+    Fxch_SCHashTable_Entry_t* pBin;
+    Fxch_SubCube_t* pNewEntry;
+    int iEntry;
+
+    MurmurHash3_x86_32( ( void* ) &SubCubeID, sizeof( int ), 0x9747b28c, &BinID);
+    pBin = Fxch_SCHashTableBin( pSCHashTable, BinID );
+
+    iNewEntry = Fxch_SCHashTableBinAppend( pBin, SubCubeID, iCube, iLit0, iLit1 );
     pSCHashTable->nEntries++;
 
     if ( pBin->Size == 1 )
@@ -221,51 +284,92 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
     for ( iEntry = 0; iEntry < (int)pBin->Size - 1; iEntry++ )
     {
         Fxch_SubCube_t* pEntry = &( pBin->vSCData[iEntry] );
-        int* pOutputID0 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
-        int* pOutputID1 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pNewEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
-        int Result = 0;
-        int Base;
-        int iNewDiv = -1, i, z;
 
         if ( (pEntry->iLit1 != 0 && pNewEntry->iLit1 == 0) || (pEntry->iLit1 == 0 && pNewEntry->iLit1 != 0)  )
             continue;
 
-        if ( !Fxch_SCHashTableEntryCompare( pSCHashTable, vCubes, pEntry, pNewEntry ) )
+        if ( !Fxch_SCHashTableEntryCompare( pSCHashTable, vCubes, pEntry, pNewEntry, &pSCHashTable->vSubCube0, &pSCHashTable->vSubCube1 ) )
             continue;
 
-        if ( ( pEntry->iLit0 == 0 ) || ( pNewEntry->iLit0 == 0 ) )
-        {
-            Vec_Int_t* vCube0 = Fxch_ManGetCube( pSCHashTable->pFxchMan, pEntry->iCube ),
-                     * vCube1 = Fxch_ManGetCube( pSCHashTable->pFxchMan, pNewEntry->iCube );
+        Pairs += Fxch_SCHashTablePairAdd( pSCHashTable, pEntry, pNewEntry, fUpdate );
+    }
 
-            if ( Vec_IntSize( vCube0 ) > Vec_IntSize( vCube1 ) )
-            {
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pEntry->iCube );
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube );
-            }
-            else
-            {
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube );
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pEntry->iCube );
-            }
+    return Pairs;
+}
 
-            continue;
-        }
+/**Function*************************************************************
 
-        Base = Fxch_DivCreate( pSCHashTable->pFxchMan, pEntry, pNewEntry );
+  Synopsis    [ Returns the bin of the sub-cube. ]
 
-        if ( Base < 0 )
-            continue;
+  Description [ The bins are used to split the table into shards, 
+                which are filled by different threads. ]
 
-        for ( i = 0; i < pSCHashTable->pFxchMan->nSizeOutputID; i++ )
-            Result += Fxch_CountOnes( pOutputID0[i] & pOutputID1[i] );
+  SideEffects []
 
-        for ( z = 0; z < Result; z++ )
-            iNewDiv = Fxch_DivAdd( pSCHashTable->pFxchMan, fUpdate, 0, Base );
+  SeeAlso     []
+
+***********************************************************************/
+unsigned int Fxch_SCHashTableBinId( Fxch_SCHashTable_t* pSCHashTable,
+                                    uint32_t SubCubeID )
+{
+    uint32_t BinID;
 
-        Vec_WecPush( pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pEntry->iCube );
-        Vec_WecPush( pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pNewEntry->iCube );
+    MurmurHash3_x86_32( ( void* ) &SubCubeID, sizeof( int ), 0x9747b28c, &BinID);
+    return BinID & pSCHashTable->SizeMask;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [ Inserts a sub-cube without updating the divisors. ]
+
+  Description [ This function is called by the threads, each of which 
+                owns a subset of the bins, when the table is filled for 
+                the first time. It does not change the divisors and 
+                the counter of entries. Instead, for each entry of the 
+                bin that forms a pair with the new sub-cube, it saves 
+                Key, the ID and the cube of the entry, and the literals 
+                of both sub-cubes in vPairs. The pairs are added later 
+                by Fxch_SCHashTablePairAdd() in the order of the keys.
+                Returns the number of saved pairs. ]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fxch_SCHashTableInsertPar( Fxch_SCHashTable_t* pSCHashTable,
+                               Vec_Wec_t* vCubes,
+                               Fxch_SubCube_t* pSubCube,
+                               int Key,
+                               Vec_Int_t* vSubCube0,
+                               Vec_Int_t* vSubCube1,
+                               Vec_Int_t* vPairs )
+{
+    int iNewEntry;
+    int Pairs = 0;
+    Fxch_SCHashTable_Entry_t* pBin;
+    Fxch_SubCube_t* pNewEntry;
+    int iEntry;
+
+    pBin = pSCHashTable->pBins + Fxch_SCHashTableBinId( pSCHashTable, pSubCube->Id );
+    iNewEntry = Fxch_SCHashTableBinAppend( pBin, pSubCube->Id, pSubCube->iCube, pSubCube->iLit0, pSubCube->iLit1 );
+
+    pNewEntry = &( pBin->vSCData[iNewEntry] );
+    for ( iEntry = 0; iEntry < (int)pBin->Size - 1; iEntry++ )
+    {
+        Fxch_SubCube_t* pEntry = &( pBin->vSCData[iEntry] );
+
+        if ( (pEntry->iLit1 != 0 && pNewEntry->iLit1 == 0) || (pEntry->iLit1 == 0 && pNewEntry->iLit1 != 0)  )
+            continue;
+
+        if ( !Fxch_SCHashTableEntryCompare( pSCHashTable, vCubes, pEntry, pNewEntry, vSubCube0, vSubCube1 ) )
+            continue;
 
+        Vec_IntPush( vPairs, Key );
+        Vec_IntPush( vPairs, (int)pEntry->Id );
+        Vec_IntPush( vPairs, (int)pEntry->iCube );
+        Vec_IntPush( vPairs, (int)( pEntry->iLit0 | ( pEntry->iLit1 << 16 ) ) );
+        Vec_IntPush( vPairs, (int)( pNewEntry->iLit0 | ( pNewEntry->iLit1 << 16 ) ) );
         Pairs++;
     }
 
@@ -323,7 +427,7 @@ int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
         if ( (pEntry->iLit1 != 0 && pNextEntry->iLit1 == 0) || (pEntry->iLit1 == 0 && pNextEntry->iLit1 != 0)  )
             continue;
 
-        if ( !Fxch_SCHashTableEntryCompare( pSCHashTable, vCubes, pEntry, pNextEntry )
+        if ( !Fxch_SCHashTableEntryCompare( pSCHashTable, vCubes, pEntry, pNextEntry, &pSCHashTable->vSubCube0, &pSCHashTable->vSubCube1 )
              || pEntry->iLit0 == 0
              || pNextEntry->iLit0 == 0 )
             continue;
@@ -21,6 +21,16 @@
 #include "sfmInt.h"
 #include "bool/kit/kit.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -52,6 +62,7 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
     pPars->nWinSizeMax  =  300;  // the maximum window size
     pPars->nGrowthLevel =    0;  // the maximum allowed growth in level
     pPars->nBTLimit     = 5000;  // the maximum number of conflicts in one SAT run
+    pPars->nProcs       =    1;  // the number of threads
     pPars->fRrOnly      =    0;  // perform redundancy removal
     pPars->fArea        =    0;  // performs optimization for area
     pPars->fMoreEffort  =    0;  // performs high-affort minimization
@@ -74,6 +85,9 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
 void Sfm_NtkPrintStats( Sfm_Ntk_t * p )
 {
     p->timeOther = p->timeTotal - p->timeWin - p->timeDiv - p->timeCnf - p->timeSat;
+    // the runtime of the threads is added up
+    if ( p->timeOther < 0 )
+        p->timeOther = 0;
     printf( "Nodes = %d. Try = %d. Resub = %d. Div = %d (ave = %d). SAT calls = %d. Timeouts = %d. MaxDivs = %d.\n",
         Sfm_NtkNodeNum(p), p->nNodesTried, p->nRemoves + p->nResubs, p->nTotalDivs, p->nTotalDivs/Abc_MaxInt(1, p->nNodesTried), p->nSatCalls, p->nTimeOuts, p->nMaxDivs );
 
@@ -89,6 +103,9 @@ void Sfm_NtkPrintStats( Sfm_Ntk_t * p )
     printf( "Edges  %6d out of %6d (%6.2f %%)   ", p->nTotalEdgesBeg-p->nTotalEdgesEnd, p->nTotalEdgesBeg, 100.0*(p->nTotalEdgesBeg-p->nTotalEdgesEnd)/Abc_MaxInt(1, p->nTotalEdgesBeg) );
     printf( "\n" );
 
+    if ( p->pPars->nProcs > 1 )
+        printf( "Threads = %d. Batches = %d. Nodes tried again by the main thread = %d.\n", p->pPars->nProcs, p->nBatches, p->nRetried );
+
     ABC_PRTP( "Win", p->timeWin  ,  p->timeTotal );
     ABC_PRTP( "Div", p->timeDiv  ,  p->timeTotal );
     ABC_PRTP( "Cnf", p->timeCnf  ,  p->timeTotal );
@@ -98,6 +115,49 @@ void Sfm_NtkPrintStats( Sfm_Ntk_t * p )
 //    ABC_PRTP( "   ", p->time1    ,  p->timeTotal );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Records and performs the updates found by the threads.]
+
+  Description [The fanin index is -1 if only the function of the node 
+  is simplified. When the update found by a thread is discarded, its 
+  statistics are discounted.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Sfm_NodeRecordUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth )
+{
+    p->pUpdate->iNode     = iNode;
+    p->pUpdate->iFanin    = f;
+    p->pUpdate->iFaninNew = iFaninNew;
+    p->pUpdate->uTruth    = uTruth;
+    Abc_TtCopy( p->pUpdate->pTruth, p->pTruth, SFM_WORDS_MAX, 0 );
+}
+static void Sfm_NodeApplyUpdate( Sfm_Ntk_t * p, Sfm_Upd_t * pUpd )
+{
+    if ( pUpd->iFanin == -1 )
+    {
+        if ( p->vUpdated )
+            Vec_IntPush( p->vUpdated, Abc_Var2Lit(pUpd->iNode, 0) );
+        Vec_WrdWriteEntry( p->vTruths, pUpd->iNode, pUpd->uTruth );
+        Sfm_TruthToCnf( pUpd->uTruth, NULL, Sfm_ObjFaninNum(p, pUpd->iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, pUpd->iNode) );
+        return;
+    }
+    Sfm_NtkUpdate( p, pUpd->iNode, pUpd->iFanin, pUpd->iFaninNew, pUpd->uTruth, pUpd->pTruth );
+}
+static void Sfm_NodeDiscardUpdate( Sfm_Ntk_t * p, Sfm_Upd_t * pUpd )
+{
+    if ( pUpd->iFanin == -1 )
+        p->nImproves--;
+    else if ( pUpd->iFaninNew == -1 )
+        p->nRemoves--;
+    else
+        p->nResubs--;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs resubstitution for the node.]
@@ -214,6 +274,12 @@ finish:
         p->nResubs++;
     if ( fSkipUpdate )
         return 0;
+    // record the update if the network is read by several threads
+    if ( p->pUpdate )
+    {
+        Sfm_NodeRecordUpdate( p, iNode, f, (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar)), uTruth );
+        return 1;
+    }
     // update the network
     Sfm_NtkUpdate( p, iNode, f, (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar)), uTruth, p->pTruth );
     // the number of fanins cannot increase
@@ -280,7 +346,15 @@ p->timeSat += Abc_Clock() - clk;
     p->nImproves++;
     if ( fSkipUpdate )
         return 0;
+    // record the update if the network is read by several threads
+    if ( p->pUpdate )
+    {
+        Sfm_NodeRecordUpdate( p, iNode, -1, -1, uTruth );
+        return 1;
+    }
     // update truth table
+    if ( p->vUpdated )
+        Vec_IntPush( p->vUpdated, Abc_Var2Lit(iNode, 0) );
     Vec_WrdWriteEntry( p->vTruths, iNode, uTruth );
     Sfm_TruthToCnf( uTruth, NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
     return 1;
@@ -353,11 +427,263 @@ void Sfm_NtkPrint( Sfm_Ntk_t * p )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution for the nodes in the order.]
+
+  Description [Returns the number of updated nodes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Sfm_NtkNodeIsCandidate( Sfm_Ntk_t * p, int i, int * pCounterLarge )
+{
+    if ( Sfm_ObjIsFixed( p, i ) )
+        return 0;
+    if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax )
+        return 0;
+    //if ( Sfm_ObjFaninNum(p, i) < 2 )
+    //    return 0;
+    if ( Sfm_ObjFaninNum(p, i) > SFM_SUPP_MAX )
+    {
+        (*pCounterLarge)++;
+        return 0;
+    }
+    return 1;
+}
+static int Sfm_NtkPerformSerial( Sfm_Ntk_t * p, int * pCounterLarge )
+{
+    int i, k, Counter = 0;
+    Sfm_NtkForEachNode( p, i )
+    {
+        if ( !Sfm_NtkNodeIsCandidate( p, i, pCounterLarge ) )
+            continue;
+        for ( k = 0; Sfm_NodeResub(p, i); k++ )
+        {
+//            Counter++;
+//            break;
+        }
+        Counter += (k > 0);
+        if ( p->pPars->nNodesMax && Counter >= p->pPars->nNodesMax )
+            break;
+    }
+    return Counter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution for the nodes using several threads.]
+
+  Description [The nodes are divided into chunks of consecutive nodes and 
+  a batch contains the next node of each chunk, so that the windows of the 
+  nodes in a batch rarely overlap. Each thread computes the windows of its 
+  nodes in the batch and finds their updates using its own SAT solver, 
+  without changing the network. The main thread then performs the updates 
+  in the order of the batch. An update is valid if the window of the node 
+  does not contain objects changed by the earlier updates in the batch, and 
+  if the node and its TFO in the window did not get new fanouts. Because 
+  the window includes the complete TFI of its objects, such an update is 
+  correct in the updated network. Otherwise, the main thread tries the node 
+  again in the updated network. The updated nodes are tried again in the 
+  next batch, as in the serial loop. The nodes are assigned to the threads 
+  statically, so the result does not depend on the timing of the threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+static int Sfm_NtkPerformPar( Sfm_Ntk_t * p, int * pCounterLarge )
+{
+    return Sfm_NtkPerformSerial( p, pCounterLarge );
+}
+
+#else // pthreads are used
+
+#define SFM_PAR_THR_MAX  100
+#define SFM_PAR_NODES      8  // the number of chunks for one thread
+
+typedef struct Sfm_ParMan_t_ Sfm_ParMan_t;
+struct Sfm_ParMan_t_
+{
+    int              nProcs;         // the number of threads
+    Vec_Int_t *      vBatch;         // the nodes of the batch
+    Vec_Int_t *      vStatus;        // 1 if the update of the node is found
+    Vec_Int_t *      vLevelsR;       // the reverse levels of the nodes
+    Vec_Wec_t *      vWins;          // the objects of the windows of the nodes
+    Vec_Wec_t *      vTfos;          // the nodes and their TFO in the windows
+    Sfm_Upd_t *      pUpds;          // the updates of the nodes
+};
+
+typedef struct Sfm_ParThr_t_ Sfm_ParThr_t;
+struct Sfm_ParThr_t_
+{
+    Sfm_ParMan_t *   pPar;           // the shared data
+    Sfm_Ntk_t *      pNtk;           // the network of the thread
+    int              iThread;        // the thread number
+};
+
+static void * Sfm_NtkPerformWorker( void * pArg )
+{
+    Sfm_ParThr_t * pThr = (Sfm_ParThr_t *)pArg;
+    Sfm_ParMan_t * pPar = pThr->pPar;
+    Sfm_Ntk_t * p = pThr->pNtk;
+    Vec_Int_t * vWin;
+    int k, iNode;
+    for ( k = pThr->iThread; k < Vec_IntSize(pPar->vBatch); k += pPar->nProcs )
+    {
+        iNode = Vec_IntEntry( pPar->vBatch, k );
+        p->pUpdate = pPar->pUpds + k;
+        Vec_IntWriteEntry( pPar->vStatus, k, 0 );
+        Vec_IntWriteEntry( pPar->vLevelsR, k, Sfm_ObjLevelR(p, iNode) );
+        if ( !Sfm_NodeResub(p, iNode) )
+            continue;
+        Vec_IntWriteEntry( pPar->vStatus, k, 1 );
+        vWin = Vec_WecEntry( pPar->vWins, k );
+        Vec_IntClear( vWin );
+        Vec_IntAppend( vWin, p->vOrder );
+        vWin = Vec_WecEntry( pPar->vTfos, k );
+        Vec_IntFill( vWin, 1, iNode );
+        Vec_IntAppend( vWin, p->vTfo );
+    }
+    p->pUpdate = NULL;
+    return NULL;
+}
+static int Sfm_NtkUpdateIsValid( Sfm_Ntk_t * p, Sfm_ParMan_t * pPar, int k, Vec_Int_t * vStamps, Vec_Int_t * vStampsFo )
+{
+    int i, iObj;
+    if ( Sfm_ObjLevelR(p, Vec_IntEntry(pPar->vBatch, k)) != Vec_IntEntry(pPar->vLevelsR, k) )
+        return 0;
+    // the objects of the window should have the same functions
+    Vec_IntForEachEntry( Vec_WecEntry(pPar->vWins, k), iObj, i )
+        if ( Vec_IntEntry(vStamps, iObj) == p->nBatches )
+            return 0;
+    // the node and its TFO should not have new fanouts
+    Vec_IntForEachEntry( Vec_WecEntry(pPar->vTfos, k), iObj, i )
+        if ( Vec_IntEntry(vStampsFo, iObj) == p->nBatches )
+            return 0;
+    return 1;
+}
+static int Sfm_NtkPerformPar( Sfm_Ntk_t * p, int * pCounterLarge )
+{
+    Sfm_ParMan_t Par, * pPar = &Par;
+    Sfm_ParThr_t ThData[SFM_PAR_THR_MAX];
+    pthread_t WorkerThread[SFM_PAR_THR_MAX];
+    Vec_Int_t * vRetry, * vStamps, * vStampsFo;
+    Vec_Str_t * vChanged;
+    int nProcs = Abc_MinInt( p->pPars->nProcs, SFM_PAR_THR_MAX );
+    int nChunks = nProcs * SFM_PAR_NODES;
+    int nChunkSize = (p->nNodes + nChunks - 1) / nChunks;
+    int i, k, c, status, iNode, iLit, iStep, Counter = 0;
+    // start the threads' data (a batch has a node of each chunk and the updated nodes)
+    pPar->nProcs   = nProcs;
+    pPar->vBatch   = Vec_IntAlloc( 2 * nChunks );
+    pPar->vStatus  = Vec_IntStart( 2 * nChunks );
+    pPar->vLevelsR = Vec_IntStart( 2 * nChunks );
+    pPar->vWins    = Vec_WecStart( 2 * nChunks );
+    pPar->vTfos    = Vec_WecStart( 2 * nChunks );
+    pPar->pUpds    = ABC_CALLOC( Sfm_Upd_t, 2 * nChunks );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pPar    = pPar;
+        ThData[i].pNtk    = Sfm_NtkCreateThread( p );
+        ThData[i].iThread = i;
+    }
+    p->vUpdated = Vec_IntAlloc( 100 );
+    vRetry    = Vec_IntAlloc( 2 * nChunks );
+    vStamps   = Vec_IntStart( p->nObjs );
+    vStampsFo = Vec_IntStart( p->nObjs );
+    vChanged  = Vec_StrStart( p->nObjs );
+    for ( iStep = 0; iStep < nChunkSize || Vec_IntSize(vRetry) > 0; iStep++ )
+    {
+        // the updated nodes come before the next nodes of the chunks
+        Vec_IntClear( pPar->vBatch );
+        Vec_IntForEachEntry( vRetry, iNode, k )
+            if ( k >= nChunks )
+                Vec_IntWriteEntry( vRetry, k - nChunks, iNode );
+            else if ( Sfm_ObjFanoutNum(p, iNode) > 0 )
+                Vec_IntPush( pPar->vBatch, iNode );
+        Vec_IntShrink( vRetry, Abc_MaxInt(Vec_IntSize(vRetry) - nChunks, 0) );
+        // the nodes removed by the earlier updates are skipped
+        for ( c = 0; c < nChunks && iStep < nChunkSize; c++ )
+        {
+            iNode = p->nPis + c * nChunkSize + iStep;
+            if ( iNode + p->nPos < p->nObjs && Sfm_ObjFanoutNum(p, iNode) > 0 && Sfm_NtkNodeIsCandidate( p, iNode, pCounterLarge ) )
+                Vec_IntPush( pPar->vBatch, iNode );
+        }
+        if ( Vec_IntSize(pPar->vBatch) == 0 )
+            continue;
+        // find the updates (the main thread is one of the workers)
+        for ( k = 1; k < nProcs; k++ )
+        {
+            status = pthread_create( WorkerThread + k, NULL, Sfm_NtkPerformWorker, (void *)(ThData + k) );  
+            assert( status == 0 );
+        }
+        Sfm_NtkPerformWorker( ThData );
+        for ( k = 1; k < nProcs; k++ )
+        {
+            status = pthread_join( WorkerThread[k], NULL );  
+            assert( status == 0 );
+        }
+        p->nBatches++;
+        // perform the updates in the order of the nodes
+        Vec_IntForEachEntry( pPar->vBatch, iNode, k )
+        {
+            if ( !Vec_IntEntry(pPar->vStatus, k) )
+                continue;
+            if ( Sfm_NtkUpdateIsValid( p, pPar, k, vStamps, vStampsFo ) )
+                Sfm_NodeApplyUpdate( p, pPar->pUpds + k );
+            else 
+            {
+                // try the node again in the updated network
+                Sfm_NodeDiscardUpdate( p, pPar->pUpds + k );
+                p->nRetried++;
+                if ( !Sfm_NodeResub( p, iNode ) )
+                    continue;
+            }
+            Vec_IntForEachEntry( p->vUpdated, iLit, i )
+                Vec_IntWriteEntry( Abc_LitIsCompl(iLit) ? vStampsFo : vStamps, Abc_Lit2Var(iLit), p->nBatches );
+            Vec_IntClear( p->vUpdated );
+            Vec_IntPush( vRetry, iNode );
+            if ( Vec_StrEntry(vChanged, iNode) )
+                continue;
+            Vec_StrWriteEntry( vChanged, iNode, 1 );
+            if ( ++Counter == p->pPars->nNodesMax )
+                break;
+        }
+        if ( p->pPars->nNodesMax && Counter >= p->pPars->nNodesMax )
+            break;
+    }
+    // stop the threads' data
+    for ( i = 0; i < nProcs; i++ )
+        Sfm_NtkStopThread( p, ThData[i].pNtk );
+    Vec_IntFree( pPar->vBatch );
+    Vec_IntFree( pPar->vStatus );
+    Vec_IntFree( pPar->vLevelsR );
+    Vec_WecFree( pPar->vWins );
+    Vec_WecFree( pPar->vTfos );
+    ABC_FREE( pPar->pUpds );
+    Vec_IntFreeP( &p->vUpdated );
+    Vec_IntFree( vRetry );
+    Vec_IntFree( vStamps );
+    Vec_IntFree( vStampsFo );
+    Vec_StrFree( vChanged );
+    return Counter;
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    []
 
-  Description []
+  Description [With several threads (pPars->nProcs), the nodes are 
+  processed in a different order, so the result is close but not always 
+  identical to the serial run.]
                
   SideEffects []
 
@@ -366,7 +692,7 @@ void Sfm_NtkPrint( Sfm_Ntk_t * p )
 ***********************************************************************/
 int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 {
-    int i, k, Counter = 0, CounterLarge = 0;
+    int Counter = 0, CounterLarge = 0;
     //Sfm_NtkPrint( p );
     p->timeTotal = Abc_Clock();
     if ( pPars->fVerbose )
@@ -382,28 +708,10 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 //    return 0;
     p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
-    Sfm_NtkForEachNode( p, i )
-    {
-        if ( Sfm_ObjIsFixed( p, i ) )
-            continue;
-        if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax )
-            continue;
-        //if ( Sfm_ObjFaninNum(p, i) < 2 )
-        //    continue;
-        if ( Sfm_ObjFaninNum(p, i) > SFM_SUPP_MAX )
-        {
-            CounterLarge++;
-            continue;
-        }
-        for ( k = 0; Sfm_NodeResub(p, i); k++ )
-        {
-//            Counter++;
-//            break;
-        }
-        Counter += (k > 0);
-        if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
-            break;
-    }
+    if ( pPars->nProcs > 1 )
+        Counter = Sfm_NtkPerformPar( p, &CounterLarge );
+    else
+        Counter = Sfm_NtkPerformSerial( p, &CounterLarge );
     p->nTotalNodesEnd = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesEnd = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
     p->timeTotal = Abc_Clock() - p->timeTotal;
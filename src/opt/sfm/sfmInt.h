@@ -67,6 +67,17 @@ typedef struct Sfm_Fun_t_ Sfm_Fun_t;
 typedef struct Sfm_Lib_t_ Sfm_Lib_t; 
 typedef struct Sfm_Tim_t_ Sfm_Tim_t;
 typedef struct Sfm_Mit_t_ Sfm_Mit_t;
+typedef struct Sfm_Upd_t_ Sfm_Upd_t;
+
+// the update of a node found by a thread
+struct Sfm_Upd_t_
+{
+    int               iNode;       // the node
+    int               iFanin;      // the fanin index (-1 if the function is simplified)
+    int               iFaninNew;   // the new fanin (-1 if the fanin is removed)
+    word              uTruth;      // the new function
+    word              pTruth[SFM_WORDS_MAX];
+};
 
 struct Sfm_Ntk_t_
 {
@@ -94,6 +105,8 @@ struct Sfm_Ntk_t_
     Vec_Int_t         vVar2Id;     // SatVar -> ObjId
     Vec_Wec_t *       vCnfs;       // CNFs
     Vec_Int_t *       vCover;      // temporary
+    Vec_Int_t *       vUpdated;    // changed objects (complemented if only a fanout is added) or NULL
+    Sfm_Upd_t *       pUpdate;     // the update recorded instead of performed (or NULL)
     // traversal IDs
     Vec_Int_t         vTravIds;    // traversal IDs
     Vec_Int_t         vTravIds2;   // traversal IDs
@@ -138,7 +151,9 @@ struct Sfm_Ntk_t_
     int               nTotalDivs;
     int               nSatCalls;
     int               nTimeOuts;
-    int               nMaxDivs;
+    int               nMaxDivs;    // the number of windows whose divisors reached the limit
+    int               nBatches;    // the number of batches solved by the threads
+    int               nRetried;    // the number of nodes tried again by the main thread
     // runtime
     abctime           timeWin;
     abctime           timeDiv;
@@ -222,6 +237,8 @@ extern int          Sfm_LibImplementGatesDelay( Sfm_Lib_t * p, int * pFanins, Mi
 /*=== sfmNtk.c ==========================================================*/
 extern Sfm_Ntk_t *  Sfm_ConstructNetwork( Vec_Wec_t * vFanins, int nPis, int nPos );
 extern void         Sfm_NtkPrepare( Sfm_Ntk_t * p );
+extern Sfm_Ntk_t *  Sfm_NtkCreateThread( Sfm_Ntk_t * p );
+extern void         Sfm_NtkStopThread( Sfm_Ntk_t * p, Sfm_Ntk_t * pThr );
 extern void         Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth, word * pTruth );
 /*=== sfmSat.c ==========================================================*/
 extern int          Sfm_NtkWindowToSolver( Sfm_Ntk_t * p );
@@ -253,6 +253,99 @@ void Sfm_NtkFree( Sfm_Ntk_t * p )
     ABC_FREE( p );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the network of a thread.]
+
+  Description [The network of a thread shares the logic (fanins, fanouts, 
+  levels, truth tables and CNFs) with the main network and has its own 
+  traversal IDs, SAT solver, window data and statistics. The thread only 
+  reads the shared logic, which is updated by the main thread. When the 
+  thread is stopped, its statistics are added to the main network.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sfm_Ntk_t * Sfm_NtkCreateThread( Sfm_Ntk_t * p )
+{
+    Sfm_Ntk_t * pThr; int i;
+    pThr = ABC_CALLOC( Sfm_Ntk_t, 1 );
+    // the parameters are temporarily changed when computing the window
+    pThr->pPars = ABC_ALLOC( Sfm_Par_t, 1 );
+    memcpy( pThr->pPars, p->pPars, sizeof(Sfm_Par_t) );
+    pThr->pPars->fVeryVerbose = 0;
+    pThr->nPis     = p->nPis;
+    pThr->nPos     = p->nPos;
+    pThr->nNodes   = p->nNodes;
+    pThr->nObjs    = p->nObjs;
+    // shared data
+    pThr->vFixed   = p->vFixed;
+    pThr->vEmpty   = p->vEmpty;
+    pThr->vTruths  = p->vTruths;
+    pThr->vFanins  = p->vFanins;
+    pThr->vStarts  = p->vStarts;
+    pThr->vTruths2 = p->vTruths2;
+    pThr->vFanouts = p->vFanouts;
+    pThr->vLevels  = p->vLevels;
+    pThr->vLevelsR = p->vLevelsR;
+    pThr->vCnfs    = p->vCnfs;
+    // private data
+    Vec_IntFill( &pThr->vCounts,   pThr->nObjs,  0 );
+    Vec_IntFill( &pThr->vTravIds,  pThr->nObjs,  0 );
+    Vec_IntFill( &pThr->vTravIds2, pThr->nObjs,  0 );
+    Vec_IntFill( &pThr->vId2Var,   2*pThr->nObjs, -1 );
+    Vec_IntFill( &pThr->vVar2Id,   2*pThr->nObjs, -1 );
+    pThr->vCover   = Vec_IntAlloc( 1 << 16 );
+    for ( i = 0; i < SFM_FANIN_MAX; i++ )
+        pThr->pTtElems[i] = pThr->TtElems[i];
+    Abc_TtElemInit( pThr->pTtElems, SFM_FANIN_MAX );
+    Sfm_NtkPrepare( pThr );
+    return pThr;
+}
+void Sfm_NtkStopThread( Sfm_Ntk_t * p, Sfm_Ntk_t * pThr )
+{
+    // statistics
+    p->nTryRemoves  += pThr->nTryRemoves;
+    p->nTryImproves += pThr->nTryImproves;
+    p->nTryResubs   += pThr->nTryResubs;
+    p->nRemoves     += pThr->nRemoves;
+    p->nImproves    += pThr->nImproves;
+    p->nResubs      += pThr->nResubs;
+    p->nNodesTried  += pThr->nNodesTried;
+    p->nTotalDivs   += pThr->nTotalDivs;
+    p->nSatCalls    += pThr->nSatCalls;
+    p->nTimeOuts    += pThr->nTimeOuts;
+    p->nMaxDivs     += pThr->nMaxDivs;
+    p->timeWin      += pThr->timeWin;
+    p->timeDiv      += pThr->timeDiv;
+    p->timeCnf      += pThr->timeCnf;
+    p->timeSat      += pThr->timeSat;
+    // private data
+    ABC_FREE( pThr->vCounts.pArray );
+    ABC_FREE( pThr->vTravIds.pArray );
+    ABC_FREE( pThr->vTravIds2.pArray );
+    ABC_FREE( pThr->vId2Var.pArray );
+    ABC_FREE( pThr->vVar2Id.pArray );
+    Vec_IntFree( pThr->vCover );
+    Vec_IntFreeP( &pThr->vNodes );
+    Vec_IntFreeP( &pThr->vDivs  );
+    Vec_IntFreeP( &pThr->vRoots );
+    Vec_IntFreeP( &pThr->vTfo   );
+    Vec_WrdFreeP( &pThr->vDivCexes );
+    Vec_IntFreeP( &pThr->vOrder );
+    Vec_IntFreeP( &pThr->vDivVars );
+    Vec_IntFreeP( &pThr->vDivIds );
+    Vec_IntFreeP( &pThr->vLits  );
+    Vec_IntFreeP( &pThr->vValues );
+    Vec_WecFreeP( &pThr->vClauses );
+    Vec_IntFreeP( &pThr->vFaninMap );
+    if ( pThr->pSat ) sat_solver_delete( pThr->pSat );
+    ABC_FREE( pThr->pPars );
+    ABC_FREE( pThr );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs resubstitution for the node.]
@@ -291,6 +384,8 @@ void Sfm_NtkDeleteObj_rec( Sfm_Ntk_t * p, int iNode )
     if ( Sfm_ObjFanoutNum(p, iNode) > 0 || Sfm_ObjIsPi(p, iNode) || Sfm_ObjIsFixed(p, iNode) )
         return;
     assert( Sfm_ObjIsNode(p, iNode) );
+    if ( p->vUpdated )
+        Vec_IntPush( p->vUpdated, Abc_Var2Lit(iNode, 0) );
     Sfm_ObjForEachFanin( p, iNode, iFanin, i )
     {
         int RetValue = Vec_IntRemove( Sfm_ObjFoArray(p, iFanin), iNode );  assert( RetValue );
@@ -326,6 +421,13 @@ void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth,
     assert( Sfm_ObjIsNode(p, iNode) );
     assert( iFanin != iFaninNew );
     assert( Sfm_ObjFaninNum(p, iNode) <= SFM_FANIN_MAX );
+    // remember the changed node and the new fanout of the new fanin
+    if ( p->vUpdated )
+    {
+        Vec_IntPush( p->vUpdated, Abc_Var2Lit(iNode, 0) );
+        if ( iFaninNew != -1 )
+            Vec_IntPush( p->vUpdated, Abc_Var2Lit(iFaninNew, 1) );
+    }
     if ( Abc_TtIsConst0(pTruth, nWords) || Abc_TtIsConst1(pTruth, nWords) )
     {
         Sfm_ObjForEachFanin( p, iNode, iFanin, f )
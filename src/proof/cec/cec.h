@@ -108,6 +108,7 @@ struct Cec_ParFra_t_
     int              nCallsRecycle; // calls to perform before recycling SAT solver
     int              nSatVarMax;    // the max number of SAT variables
     int              nGenIters;     // pattern generation iterations
+    int              nProcs;        // the number of threads
     int              fRewriting;    // enables AIG rewriting
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
@@ -135,6 +136,7 @@ struct Cec_ParCec_t_
     int              fUseSmartCnf;  // use smart CNF computation
     int              fRewriting;    // enables AIG rewriting
     int              fNaive;        // performs naive SAT-based checking
+    int              nProcs;        // the number of threads
     int              fSilent;       // print no messages
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
@@ -155,6 +157,7 @@ struct Cec_ParCor_t_
     int              nLevelMax;     // (scorr only) the max number of levels
     int              nStepsMax;     // (scorr only) the max number of induction steps
     int              nLimitMax;     // (scorr only) stop after this many iterations if little or no improvement
+    int              nBatchSize;    // (scorr only) the number of outputs solved together by the batched solver
     int              fLatchCorr;    // consider only latch outputs
     int              fConstCorr;    // consider only constants
     int              fUseRings;     // use rings
@@ -222,6 +225,9 @@ struct Cec_ParSimGen_t_
     char *           pFileName;         // file name to dump simulation vectors
 };
 
+// batched SAT solver comparing pairs of AIG literals (see Cec4_BatSolve)
+typedef struct Cec4_Bat_t_ Cec4_Bat_t;
+
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
@@ -251,6 +257,13 @@ extern void          Cec_ManChcSetDefaultParams( Cec_ParChc_t * p );
 extern Gia_Man_t *   Cec_ManSatSweeping( Gia_Man_t * pAig, Cec_ParFra_t * pPars, int fSilent );
 extern Gia_Man_t *   Cec_ManSatSolving( Gia_Man_t * pAig, Cec_ParSat_t * pPars, int f0Proved );
 extern void          Cec_ManSimulation( Gia_Man_t * pAig, Cec_ParSim_t * pPars );
+/*=== cecSatG2.c ==========================================================*/
+extern Cec4_Bat_t *  Cec4_BatStart( Gia_Man_t * pAig, int jType, int nBTLimit, int nBTLimitPo, int nCallsRecycle, int nSatVarMax );
+extern void          Cec4_BatStop( Cec4_Bat_t * p );
+extern void          Cec4_BatSolve( Cec4_Bat_t * p, int * pLits, int nPairs, int * pfEffort, int * pStatus, int * pCexPos );
+extern Vec_Int_t *   Cec4_BatReadCexes( Cec4_Bat_t * p );
+extern void          Cec4_BatPrintStats( Cec4_Bat_t * p );
+extern Vec_Int_t *   Cec4_ManSolveMiterBatch( Gia_Man_t * pAig, int nBTLimit, int nBatch, Vec_Str_t ** pvStatus, int fVerbose );
 /*=== cecSeq.c ==========================================================*/
 extern int           Cec_ManSeqResimulateCounter( Gia_Man_t * pAig, Cec_ParSim_t * pPars, Abc_Cex_t * pCex );
 extern int           Cec_ManSeqSemiformal( Gia_Man_t * pAig, Cec_ParSmf_t * pPars );
@@ -818,7 +818,9 @@ void Cec_ManLSCorrespondenceBmc( Gia_Man_t * pAig, Cec_ParCor_t * pPars, int nPr
             break;
         } 
         pParsSat->nBTLimit *= 10;
-        if ( pPars->fUseCSat )
+        if ( pPars->nBatchSize )
+            vCexStore = Cec4_ManSolveMiterBatch( pSrm, pPars->nBTLimit, pPars->nBatchSize, &vStatus, pPars->fVerbose );
+        else if ( pPars->fUseCSat )
             vCexStore = Tas_ManSolveMiterNc( pSrm, pPars->nBTLimit, &vStatus, 0 );
         else
             vCexStore = Cec_ManSatSolveMiter( pSrm, pParsSat, &vStatus );
@@ -1010,7 +1012,9 @@ int Cec_ManLSCorrespondenceClasses( Gia_Man_t * pAig, Cec_ParCor_t * pPars )
 //Gia_DumpAiger( pSrm, "corrsrm", r, 2 );
         // found counter-examples to speculation
         clk2 = Abc_Clock();
-        if ( pPars->fUseCSat )
+        if ( pPars->nBatchSize )
+            vCexStore = Cec4_ManSolveMiterBatch( pSrm, pPars->nBTLimit, pPars->nBatchSize, &vStatus, pPars->fVerbose );
+        else if ( pPars->fUseCSat )
             vCexStore = Cbs_ManSolveMiterNc( pSrm, pPars->nBTLimit, &vStatus, 0, 0 );
         else
             vCexStore = Cec_ManSatSolveMiter( pSrm, pParsSat, &vStatus );
@@ -55,6 +55,29 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
 
 #else // pthreads are used
 
+#define PAR_THR_MAX    8
+#define PAR_STAGE_MAX  3
+
+// the facts shared by the engines of one call
+typedef struct Par_Share_t_ Par_Share_t;
+struct Par_Share_t_
+{
+    pthread_mutex_t  Mutex;       // protects the fields below
+    volatile int     nRunId;      // the current run id
+    int              Result;      // the verdict (-1 = undecided; 0 = SAT; 1 = UNSAT)
+    int              iEngine;     // the engine that produced the verdict (-1 = scorr)
+    int              iStage;      // the miter where the verdict was produced
+    int              nSafeFrames; // the number of frames without a counter-example
+    int              iEngineSafe; // the engine that established these frames
+    Abc_Cex_t *      pCex;        // the shortest verified counter-example
+};
+
+// the store of the call served by this worker thread
+static ABC_THREAD_LOCAL Par_Share_t * s_pProveShare = NULL;
+
+// the engines of the current run stop as soon as the run id is incremented
+int Cec_GiaProveCallBackToStop( int RunId ) { return s_pProveShare && RunId < s_pProveShare->nRunId; }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -70,7 +93,7 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
   SeeAlso     []
 
 ***********************************************************************/
-int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
+int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int nStart, int RunId, int * pnSafe, int fVerbose )
 {
     abctime clk = Abc_Clock();   
     int RetValue = -1;
@@ -78,55 +101,71 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
     if ( fVerbose )
     printf( "Calling engine %d with timeout %d sec.\n", iEngine, nTimeOut );
     Abc_CexFreeP( &p->pCexSeq );
+    *pnSafe = 0;
     if ( iEngine == 0 )
     {
         Ssw_RarPars_t Pars, * pPars = &Pars;
         Ssw_RarSetDefaultParams( pPars );
-        pPars->TimeOut = nTimeOut;
-        pPars->fSilent = 1;
+        pPars->TimeOut   = nTimeOut;
+        pPars->fSilent   = 1;
+        pPars->RunId     = RunId;
+        pPars->pFuncStop = Cec_GiaProveCallBackToStop;
         RetValue = Ssw_RarSimulateGia( p, pPars );
     }
     else if ( iEngine == 1 )
     {
         Saig_ParBmc_t Pars, * pPars = &Pars;
         Saig_ParBmcSetDefaultParams( pPars );
-        pPars->nTimeOut = nTimeOut;
-        pPars->fSilent  = 1;
+        pPars->nStart    = nStart;
+        pPars->nTimeOut  = nTimeOut;
+        pPars->fSilent   = 1;
+        pPars->RunId     = RunId;
+        pPars->pFuncStop = Cec_GiaProveCallBackToStop;
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         RetValue = Saig_ManBmcScalable( pAig, pPars );
         p->pCexSeq = pAig->pSeqModel; pAig->pSeqModel = NULL;
         Aig_ManStop( pAig );                 
+        *pnSafe = Abc_MaxInt( nStart, pPars->iFrame + 1 );
     }
     else if ( iEngine == 2 )
     {
         Pdr_Par_t Pars, * pPars = &Pars;
         Pdr_ManSetDefaultParams( pPars );
-        pPars->nTimeOut = nTimeOut;
-        pPars->fSilent  = 1;
+        pPars->nTimeOut  = nTimeOut;
+        pPars->fSilent   = 1;
+        pPars->RunId     = RunId;
+        pPars->pFuncStop = Cec_GiaProveCallBackToStop;
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         RetValue = Pdr_ManSolve( pAig, pPars );
         p->pCexSeq = pAig->pSeqModel; pAig->pSeqModel = NULL;
         Aig_ManStop( pAig );                
+        *pnSafe = Abc_MaxInt( 0, pPars->iFrame + 1 );
     }        
     else if ( iEngine == 3 )
     {
         Saig_ParBmc_t Pars, * pPars = &Pars;
         Saig_ParBmcSetDefaultParams( pPars );
         pPars->fUseGlucose = 1;
+        pPars->nStart      = nStart;
         pPars->nTimeOut    = nTimeOut;
         pPars->fSilent     = 1;
+        pPars->RunId       = RunId;
+        pPars->pFuncStop   = Cec_GiaProveCallBackToStop;
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         RetValue = Saig_ManBmcScalable( pAig, pPars );
         p->pCexSeq = pAig->pSeqModel; pAig->pSeqModel = NULL;
         Aig_ManStop( pAig );                
+        *pnSafe = Abc_MaxInt( nStart, pPars->iFrame + 1 );
     }
     else if ( iEngine == 4 )
     {
         Pdr_Par_t Pars, * pPars = &Pars;
         Pdr_ManSetDefaultParams( pPars );
-        pPars->fUseAbs  = 1;
-        pPars->nTimeOut = nTimeOut;
-        pPars->fSilent  = 1;
+        pPars->fUseAbs   = 1;
+        pPars->nTimeOut  = nTimeOut;
+        pPars->fSilent   = 1;
+        pPars->RunId     = RunId;
+        pPars->pFuncStop = Cec_GiaProveCallBackToStop;
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         RetValue = Pdr_ManSolve( pAig, pPars );
         p->pCexSeq = pAig->pSeqModel; pAig->pSeqModel = NULL;
@@ -140,6 +179,8 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
         pPars->nFramesAdd    =        1;  // the number of additional frames
         pPars->fNotVerbose   =        1;  // silent
         pPars->nTimeOut      = nTimeOut;  // timeout in seconds
+        pPars->RunId         =    RunId;  // the id of this run
+        pPars->pFuncStop     = Cec_GiaProveCallBackToStop;
         RetValue = Bmcg_ManPerform( p, pPars );
     }
     else assert( 0 );
@@ -172,6 +213,69 @@ Gia_Man_t * Cec_GiaScorrNew( Gia_Man_t * p )
     return Cec_ManLSCorrespondence( p, pPars ); 
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Shared store of the facts learned by the engines.]
+
+  Description [The engines of the portfolio publish their results here 
+  as soon as they finish. A verdict (a verified counter-example or a proof) 
+  stops all running engines through the callback. The number of frames 
+  without a counter-example, established by BMC or PDR, is used as the 
+  starting frame of BMC engines launched later on the reduced miters, 
+  which are sequentially equivalent to the original one. The store
+  belongs to one call of Cec_GiaProveTest(), so that several calls can 
+  run at the same time.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_GiaProveShareStart( Par_Share_t * pShare )
+{
+    pthread_mutex_init( &pShare->Mutex, NULL );
+    pShare->nRunId      =  0;
+    pShare->Result      = -1;
+    pShare->iEngine     = -2;
+    pShare->iStage      = -1;
+    pShare->nSafeFrames =  0;
+    pShare->iEngineSafe = -1;
+    pShare->pCex        = NULL;
+}
+void Cec_GiaProveShareStop( Par_Share_t * pShare )
+{
+    Abc_CexFreeP( &pShare->pCex );
+    pthread_mutex_destroy( &pShare->Mutex );
+}
+void Cec_GiaProveSharePublish( Par_Share_t * pShare, int Result, int iEngine, int iStage, Abc_Cex_t * pCex, int nSafeFrames )
+{
+    pthread_mutex_lock( &pShare->Mutex );
+    if ( Result == 0 && pCex && (pShare->pCex == NULL || pCex->iFrame < pShare->pCex->iFrame) )
+    {
+        Abc_CexFreeP( &pShare->pCex );
+        pShare->pCex = Abc_CexDup( pCex, -1 );
+    }
+    if ( Result != -1 && pShare->Result == -1 )
+    {
+        pShare->Result  = Result;
+        pShare->iEngine = iEngine;
+        pShare->iStage  = iStage;
+        pShare->nRunId++; // stop the other engines
+    }
+    if ( Result == -1 && nSafeFrames > pShare->nSafeFrames )
+    {
+        pShare->nSafeFrames = nSafeFrames;
+        pShare->iEngineSafe = iEngine;
+    }
+    pthread_mutex_unlock( &pShare->Mutex );
+}
+void Cec_GiaProveSharePreempt( Par_Share_t * pShare )
+{
+    pthread_mutex_lock( &pShare->Mutex );
+    pShare->nRunId++;
+    pthread_mutex_unlock( &pShare->Mutex );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -183,20 +287,29 @@ Gia_Man_t * Cec_GiaScorrNew( Gia_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-#define PAR_THR_MAX 8
 typedef struct Par_ThData_t_
 {
     Gia_Man_t * p;
+    Par_Share_t * pShare;
     int         iEngine;
+    int         iStage;
     int         fWorking;
     int         nTimeOut;
+    int         nStart;
+    int         RunId;
     int         Result;
     int         fVerbose;
+    int         pResults[PAR_STAGE_MAX];
+    int         pSafe[PAR_STAGE_MAX];
+    abctime     pTimes[PAR_STAGE_MAX];
 } Par_ThData_t;
 void * Cec_GiaProveWorkerThread( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
     volatile int * pPlace = &pThData->fWorking;
+    abctime clk;
+    int nSafe;
+    s_pProveShare = pThData->pShare;
     while ( 1 )
     {
         while ( *pPlace == 0 );
@@ -207,24 +320,48 @@ void * Cec_GiaProveWorkerThread( void * pArg )
             assert( 0 );
             return NULL;
         }
-        pThData->Result = Cec_GiaProveOne( pThData->p, pThData->iEngine, pThData->nTimeOut, pThData->fVerbose );
+        clk = Abc_Clock();
+        pThData->Result = Cec_GiaProveOne( pThData->p, pThData->iEngine, pThData->nTimeOut, pThData->nStart, pThData->RunId, &nSafe, pThData->fVerbose );
+        if ( pThData->Result == 0 && (pThData->p->pCexSeq == NULL || !Gia_ManVerifyCex(pThData->p, pThData->p->pCexSeq, 0)) )
+        {
+            if ( pThData->fVerbose )
+                printf( "Engine %d produced a counter-example that does not verify.\n", pThData->iEngine );
+            pThData->Result = -1;
+        }
+        Cec_GiaProveSharePublish( pThData->pShare, pThData->Result, pThData->iEngine, pThData->iStage, pThData->p->pCexSeq, nSafe );
+        pThData->pResults[pThData->iStage] = pThData->Result;
+        pThData->pSafe[pThData->iStage]    = nSafe;
+        pThData->pTimes[pThData->iStage]   = Abc_Clock() - clk;
         pThData->fWorking = 0;
     }
     assert( 0 );
     return NULL;
 }
-void Cec_GiaInitThreads( Par_ThData_t * ThData, int nProcs, Gia_Man_t * p, int nTimeOut, int fVerbose, pthread_t * WorkerThread )
+void Cec_GiaInitThreads( Par_ThData_t * ThData, int nProcs, int iStage, Gia_Man_t * p, Par_Share_t * pShare, int nTimeOut, int fVerbose, pthread_t * WorkerThread )
 {
     int i, status;
     assert( nProcs <= PAR_THR_MAX );
+    assert( iStage < PAR_STAGE_MAX );
     for ( i = 0; i < nProcs; i++ )
     {
+        if ( WorkerThread )
+        {
+            memset( ThData + i, 0, sizeof(Par_ThData_t) );
+            memset( ThData[i].pResults, 0xFF, sizeof(int) * PAR_STAGE_MAX );
+        }
+        else if ( ThData[i].p )
+            Gia_ManStop( ThData[i].p );
         ThData[i].p        = Gia_ManDup(p);
+        ThData[i].pShare   = pShare;
         ThData[i].iEngine  = i;
+        ThData[i].iStage   = iStage;
         ThData[i].nTimeOut = nTimeOut;
+        ThData[i].nStart   = pShare->nSafeFrames;
+        ThData[i].RunId    = pShare->nRunId;
         ThData[i].fWorking = 0;
         ThData[i].Result   = -1;
         ThData[i].fVerbose = fVerbose;
+        ThData[i].pResults[iStage] = -2;
         if ( !WorkerThread )
             continue;
         status = pthread_create( WorkerThread + i, NULL,Cec_GiaProveWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
@@ -232,29 +369,53 @@ void Cec_GiaInitThreads( Par_ThData_t * ThData, int nProcs, Gia_Man_t * p, int n
     for ( i = 0; i < nProcs; i++ )
         ThData[i].fWorking = 1;
 }
-int Cec_GiaWaitThreads( Par_ThData_t * ThData, int nProcs, Gia_Man_t * p, int RetValue, int * pRetEngine )
+int Cec_GiaWaitThreads( Par_ThData_t * ThData, int nProcs, Gia_Man_t * p, Par_Share_t * pShare, int RetValue, int * pRetEngine )
 {
     int i;
     for ( i = 0; i < nProcs; i++ )
-    {
-        if ( RetValue == -1 && !ThData[i].fWorking && ThData[i].Result != -1 ) {
-            RetValue = ThData[i].Result;
-            *pRetEngine = i;
-            if ( !p->pCexSeq && ThData[i].p->pCexSeq )
-                p->pCexSeq = Abc_CexDup( ThData[i].p->pCexSeq, -1 );
-        }
         if ( ThData[i].fWorking )
             i = -1;
+    if ( RetValue == -1 && pShare->Result != -1 )
+    {
+        RetValue = pShare->Result;
+        *pRetEngine = pShare->iEngine;
+        if ( !p->pCexSeq && pShare->pCex )
+            p->pCexSeq = Abc_CexDup( pShare->pCex, Gia_ManRegNum(p) );
     }
     return RetValue;
 }
+void Cec_GiaPrintReport( Par_ThData_t * ThData, int nProcs, int nStages, Par_Share_t * pShare )
+{
+    char * pEngines[6] = { "rarity", "bmc3", "pdr", "bmc3-glucose", "pdr-abs", "bmcg" };
+    char * pStages[PAR_STAGE_MAX] = { "original", "scorr", "scorr-old" };
+    int i, k;
+    printf( "Engine report:\n" );
+    for ( i = 0; i < nProcs; i++ )
+    for ( k = 0; k < nStages; k++ )
+    {
+        if ( ThData[i].pResults[k] == -2 )
+            continue;
+        printf( "Engine %d (%-12s)  Miter = %-9s  ", i, pEngines[i], pStages[k] );
+        if ( ThData[i].pResults[k] == 0 )
+            printf( "Result = SAT     " );
+        else if ( ThData[i].pResults[k] == 1 )
+            printf( "Result = UNSAT   " );
+        else
+            printf( "Result = undec   " );
+        printf( "Frames = %4d  ", ThData[i].pSafe[k] );
+        Abc_PrintTime( 1, "Time", ThData[i].pTimes[k] );
+    }
+    if ( pShare->iEngineSafe >= 0 )
+        printf( "Established %d frames without a counter-example (engine %d).\n", pShare->nSafeFrames, pShare->iEngineSafe );
+}
     
 int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, int nTimeOut3, int fVerbose, int fVeryVerbose, int fSilent )
 {
     abctime clkScorr = 0, clkTotal = Abc_Clock();
     Par_ThData_t ThData[PAR_THR_MAX];
     pthread_t WorkerThread[PAR_THR_MAX];
-    int i, RetValue = -1, RetEngine = -2;
+    Par_Share_t Share, * pShare = &Share;
+    int i, nStages = 1, RetValue = -1, RetEngine = -2;
     Abc_CexFreeP( &p->pCexComb );
     Abc_CexFreeP( &p->pCexSeq );        
     if ( !fSilent && fVerbose )
@@ -264,15 +425,18 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
     fflush( stdout );
 
     assert( nProcs == 3 || nProcs == 5 );
-    Cec_GiaInitThreads( ThData, nProcs, p, nTimeOut, fVerbose, WorkerThread );
+    Cec_GiaProveShareStart( pShare );
+    Cec_GiaInitThreads( ThData, nProcs, 0, p, pShare, nTimeOut, fVerbose, WorkerThread );
 
     // meanwhile, perform scorr
     Gia_Man_t * pScorr = Cec_GiaScorrNew( p );
     clkScorr = Abc_Clock() - clkTotal;
     if ( Gia_ManAndNum(pScorr) == 0 )
-        RetValue = 1, RetEngine = -1;
+        Cec_GiaProveSharePublish( pShare, 1, -1, 0, NULL, 0 );
+    else if ( Gia_ManAndNum(pScorr) < Gia_ManAndNum(p) || Gia_ManRegNum(pScorr) < Gia_ManRegNum(p) )
+        Cec_GiaProveSharePreempt( pShare ); // the engines continue on the reduced miter
     
-    RetValue = Cec_GiaWaitThreads( ThData, nProcs, p, RetValue, &RetEngine );
+    RetValue = Cec_GiaWaitThreads( ThData, nProcs, p, pShare, RetValue, &RetEngine );
     if ( RetValue == -1 )
     {
         abctime clkScorr2, clkStart = Abc_Clock();
@@ -280,7 +444,7 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
             printf( "Reduced the miter from %d to %d nodes. ", Gia_ManAndNum(p), Gia_ManAndNum(pScorr) );
             Abc_PrintTime( 1, "Time", clkScorr );
         }
-        Cec_GiaInitThreads( ThData, nProcs, pScorr, nTimeOut2, fVerbose, NULL );
+        Cec_GiaInitThreads( ThData, nProcs, nStages++, pScorr, pShare, nTimeOut2, fVerbose, NULL );
 
         // meanwhile, perform scorr
         if ( Gia_ManAndNum(pScorr) < 100000 )
@@ -288,31 +452,41 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
             Gia_Man_t * pScorr2 = Cec_GiaScorrOld( pScorr );
             clkScorr2 = Abc_Clock() - clkStart;
             if ( Gia_ManAndNum(pScorr2) == 0 )
-                RetValue = 1;
+                Cec_GiaProveSharePublish( pShare, 1, -1, 1, NULL, 0 );
+            else if ( Gia_ManAndNum(pScorr2) < Gia_ManAndNum(pScorr) || Gia_ManRegNum(pScorr2) < Gia_ManRegNum(pScorr) )
+                Cec_GiaProveSharePreempt( pShare );
         
-            RetValue = Cec_GiaWaitThreads( ThData, nProcs, p, RetValue, &RetEngine );      
+            RetValue = Cec_GiaWaitThreads( ThData, nProcs, p, pShare, RetValue, &RetEngine );      
             if ( RetValue == -1 )
             {
                 if ( !fSilent && fVerbose ) {
                     printf( "Reduced the miter from %d to %d nodes. ", Gia_ManAndNum(pScorr), Gia_ManAndNum(pScorr2) );
                     Abc_PrintTime( 1, "Time", clkScorr2 );
                 }
-                Cec_GiaInitThreads( ThData, nProcs, pScorr2, nTimeOut3, fVerbose, NULL );
+                Cec_GiaInitThreads( ThData, nProcs, nStages++, pScorr2, pShare, nTimeOut3, fVerbose, NULL );
 
-                RetValue = Cec_GiaWaitThreads( ThData, nProcs, p, RetValue, &RetEngine );
+                RetValue = Cec_GiaWaitThreads( ThData, nProcs, p, pShare, RetValue, &RetEngine );
                 // do something else      
             }
             Gia_ManStop( pScorr2 );   
         }
+        else
+            RetValue = Cec_GiaWaitThreads( ThData, nProcs, p, pShare, RetValue, &RetEngine );
     }
     Gia_ManStop( pScorr );    
+    if ( !fSilent && fVerbose )
+        Cec_GiaPrintReport( ThData, nProcs, nStages, pShare );
 
     // stop threads
     for ( i = 0; i < nProcs; i++ )
     {
+        Gia_ManStop( ThData[i].p );
         ThData[i].p = NULL;
         ThData[i].fWorking = 1;
     }
+    for ( i = 0; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    Cec_GiaProveShareStop( pShare );
     if ( !fSilent )
     {
         printf( "Problem \"%s\" is ", p->pSpec );
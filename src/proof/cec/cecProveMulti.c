@@ -0,0 +1,626 @@
+/**CFile****************************************************************
+
+  FileName    [cecProveMulti.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Combinational equivalence checking.]
+
+  Synopsis    [Scheduling multi-output properties on several threads.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+
+#include "sat/bmc/bmc.h"
+#include "proof/pdr/pdr.h"
+#include "proof/cec/cec.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+int Cec_GiaProveMulti( Gia_Man_t * p, int nProcs, int nGroupMax, int nOverlap, int nTimeOut, int fVerbose, int fVeryVerbose, Vec_Int_t ** pvStatus, Vec_Ptr_t ** pvCexes, Vec_Wec_t ** pvInvs ) { return -1; }
+
+#else // pthreads are used
+
+#define PAR_THR_MAX 100
+
+typedef struct Cec_MulMan_t_ Cec_MulMan_t;
+struct Cec_MulMan_t_
+{
+    Gia_Man_t *      p;           // the design
+    Vec_Wec_t *      vGroups;     // the groups of outputs
+    int              nTimeOut;    // the runtime limit per group
+    int              fVerbose;    // verbose
+    int              fVeryVerbose;// very verbose
+    int              iNext;       // the next group to solve
+    int              nSolved[2];  // the number of SAT/UNSAT outputs
+    Vec_Int_t *      vStatus;     // the status of each output (-1 = undecided; 0 = SAT; 1 = UNSAT)
+    Vec_Ptr_t *      vCexes;      // the counter-example of each output
+    Vec_Wec_t *      vInvs;       // the inductive invariant of each proved output
+    abctime          clkStart;    // the starting time
+    pthread_mutex_t  Mutex;       // protects the design and the results
+};
+
+typedef struct Cec_MulRun_t_ Cec_MulRun_t;
+struct Cec_MulRun_t_
+{
+    Cec_MulMan_t *   p;           // the manager
+    int              iGroup;      // the group being solved
+    Gia_Man_t *      pCone;       // the cone given to the engine
+    Vec_Int_t *      vOuts;       // the design outputs of the cone outputs
+    char *           pEngine;     // the engine name
+};
+
+// the engine run of this thread, used to report the outputs as they fail
+static ABC_THREAD_LOCAL Cec_MulRun_t * s_pMulRun = NULL;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the support of each output.]
+
+  Description [The support of an output is the set of CIs (given by
+  their CIO IDs) in its sequential cone of influence.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_GiaMultiSupp_rec( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vSupp )
+{
+    if ( Gia_ObjIsTravIdCurrent(p, pObj) )
+        return;
+    Gia_ObjSetTravIdCurrent(p, pObj);
+    if ( Gia_ObjIsCi(pObj) )
+    {
+        Vec_IntPush( vSupp, Gia_ObjCioId(pObj) );
+        if ( Gia_ObjIsRo(p, pObj) )
+            Cec_GiaMultiSupp_rec( p, Gia_ObjFanin0(Gia_ObjRoToRi(p, pObj)), vSupp );
+        return;
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    Cec_GiaMultiSupp_rec( p, Gia_ObjFanin0(pObj), vSupp );
+    Cec_GiaMultiSupp_rec( p, Gia_ObjFanin1(pObj), vSupp );
+}
+Vec_Wec_t * Cec_GiaMultiSupps( Gia_Man_t * p )
+{
+    Vec_Wec_t * vSupps = Vec_WecStart( Gia_ManPoNum(p) );
+    Gia_Obj_t * pObj; int i;
+    Gia_ManForEachPo( p, pObj, i )
+    {
+        Vec_Int_t * vSupp = Vec_WecEntry( vSupps, i );
+        Gia_ManIncrementTravId( p );
+        Gia_ObjSetTravIdCurrent( p, Gia_ManConst0(p) );
+        Cec_GiaMultiSupp_rec( p, Gia_ObjFanin0(pObj), vSupp );
+        Vec_IntSort( vSupp, 0 );
+    }
+    return vSupps;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Groups the outputs with overlapping supports.]
+
+  Description [The outputs are considered in the order of decreasing
+  support size. An output is added to the group sharing the largest
+  number of CIs with it, if these CIs make up at least nOverlap percent
+  of its support and the group has less than nGroupMax outputs.
+  Otherwise, the output starts a new group. The groups are returned
+  in the order of increasing support size, so that the small ones,
+  which are likely to be easy, are solved first.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Cec_GiaMultiGroups( Gia_Man_t * p, Vec_Wec_t * vSupps, int nGroupMax, int nOverlap )
+{
+    Vec_Wec_t * vGroups   = Vec_WecAlloc( 100 );
+    Vec_Wec_t * vCi2Group = Vec_WecStart( Gia_ManCiNum(p) );
+    Vec_Int_t * vGroupSup = Vec_IntAlloc( 100 ); // the support size of each group
+    Vec_Int_t * vCounts   = Vec_IntAlloc( 100 ); // the overlap with each group
+    Vec_Int_t * vTouched  = Vec_IntAlloc( 100 );
+    Vec_Wec_t * vRes;
+    Vec_Int_t * vSupp, * vLevel;
+    int i, k, j, g, iOut, iCi, iBest, nBest, * pOrder, * pCosts;
+    pCosts = ABC_ALLOC( int, Gia_ManPoNum(p) );
+    Vec_WecForEachLevel( vSupps, vSupp, i )
+        pCosts[i] = -Vec_IntSize(vSupp);
+    pOrder = Abc_MergeSortCost( pCosts, Gia_ManPoNum(p) );
+    ABC_FREE( pCosts );
+    for ( i = 0; i < Gia_ManPoNum(p); i++ )
+    {
+        iOut  = pOrder[i];
+        vSupp = Vec_WecEntry( vSupps, iOut );
+        // count the overlap with the groups
+        Vec_IntForEachEntry( vSupp, iCi, k )
+            Vec_IntForEachEntry( Vec_WecEntry(vCi2Group, iCi), g, j )
+            {
+                if ( Vec_IntEntry(vCounts, g) == 0 )
+                    Vec_IntPush( vTouched, g );
+                Vec_IntAddToEntry( vCounts, g, 1 );
+            }
+        // find the best group
+        iBest = -1, nBest = 0;
+        Vec_IntForEachEntry( vTouched, g, k )
+            if ( Vec_IntSize(Vec_WecEntry(vGroups, g)) < nGroupMax && nBest < Vec_IntEntry(vCounts, g) )
+                iBest = g, nBest = Vec_IntEntry(vCounts, g);
+        Vec_IntForEachEntry( vTouched, g, k )
+            Vec_IntWriteEntry( vCounts, g, 0 );
+        Vec_IntClear( vTouched );
+        if ( Vec_IntSize(vSupp) == 0 && Vec_WecSize(vGroups) > 0 && Vec_IntSize(Vec_WecEntryLast(vGroups)) < nGroupMax )
+            iBest = Vec_WecSize(vGroups) - 1;
+        else if ( iBest == -1 || 100 * nBest < nOverlap * Vec_IntSize(vSupp) )
+        {
+            iBest = Vec_WecSize(vGroups);
+            Vec_WecPushLevel( vGroups );
+            Vec_IntPush( vGroupSup, 0 );
+            Vec_IntPush( vCounts, 0 );
+        }
+        // add the output to the group
+        Vec_WecPush( vGroups, iBest, iOut );
+        Vec_IntForEachEntry( vSupp, iCi, k )
+            if ( Vec_IntPushUnique( Vec_WecEntry(vCi2Group, iCi), iBest ) == 0 )
+                Vec_IntAddToEntry( vGroupSup, iBest, 1 );
+    }
+    ABC_FREE( pOrder );
+    // order the groups by support size
+    pOrder = Abc_MergeSortCost( Vec_IntArray(vGroupSup), Vec_IntSize(vGroupSup) );
+    vRes = Vec_WecStart( Vec_WecSize(vGroups) );
+    for ( i = 0; i < Vec_WecSize(vGroups); i++ )
+    {
+        vLevel = Vec_WecEntry( vGroups, pOrder[i] );
+        Vec_IntSort( vLevel, 0 );
+        Vec_IntAppend( Vec_WecEntry(vRes, i), vLevel );
+    }
+    ABC_FREE( pOrder );
+    Vec_WecFree( vGroups );
+    Vec_WecFree( vCi2Group );
+    Vec_IntFree( vGroupSup );
+    Vec_IntFree( vCounts );
+    Vec_IntFree( vTouched );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the results produced by one engine for one group.]
+
+  Description [Records the result for output i of the cone pRun->pCone:
+  the counter-example pCex (if not NULL) or the proof (if fProved is set)
+  with the invariant vInv over the design flops (if not NULL). Each
+  counter-example is verified, converted to the design, and reported as
+  soon as it is recorded. The outputs recorded earlier (for example,
+  by the callback of the engine) are not recorded again. Should be called
+  with the mutex locked. Returns the status of the output.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaMultiRecordOne( Cec_MulRun_t * pRun, int i, Abc_Cex_t * pCex, int fProved, Vec_Int_t * vInv )
+{
+    Cec_MulMan_t * p = pRun->p;
+    int iOut = Vec_IntEntry( pRun->vOuts, i ), Status = -1;
+    if ( Vec_IntEntry(p->vStatus, iOut) != -1 )
+        return Vec_IntEntry( p->vStatus, iOut );
+    if ( pCex && pCex != (Abc_Cex_t *)(ABC_PTRINT_T)1 )
+    {
+        pCex->iPo = i;
+        if ( Gia_ManVerifyCex(pRun->pCone, pCex, 0) )
+            Status = 0;
+        else if ( p->fVerbose )
+            printf( "Engine %s produced a counter-example for output %d that does not verify.\n", pRun->pEngine, iOut );
+    }
+    else if ( fProved )
+        Status = 1;
+    if ( Status == -1 )
+        return -1;
+    Vec_IntWriteEntry( p->vStatus, iOut, Status );
+    p->nSolved[Status]++;
+    if ( Status == 0 )
+    {
+        pCex = Abc_CexDup( pCex, Gia_ManRegNum(p->p) );
+        pCex->iPo = iOut;
+        Vec_PtrWriteEntry( p->vCexes, iOut, pCex );
+    }
+    else if ( vInv )
+        Vec_IntAppend( Vec_WecEntry(p->vInvs, iOut), vInv );
+    printf( "Output %6d : %-5s  ", iOut, Status ? "UNSAT" : "SAT" );
+    if ( Status == 0 )
+        printf( "Frame = %4d  ", pCex->iFrame );
+    else
+        printf( "              " );
+    printf( "Engine = %-7s  Group = %5d  ", pRun->pEngine, pRun->iGroup );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - p->clkStart );
+    return Status;
+}
+int Cec_GiaMultiCallBackOnFail( int i, Abc_Cex_t * pCex )
+{
+    Cec_MulRun_t * pRun = s_pMulRun;
+    if ( pRun == NULL )
+        return 0;
+    pthread_mutex_lock( &pRun->p->Mutex );
+    Cec_GiaMultiRecordOne( pRun, i, pCex, 0, NULL );
+    fflush( stdout );
+    pthread_mutex_unlock( &pRun->p->Mutex );
+    return 0;
+}
+Vec_Int_t * Cec_GiaMultiRecord( Cec_MulRun_t * pRun, Vec_Ptr_t * vCexes, Vec_Int_t * vOutMap, Vec_Int_t * vInv )
+{
+    Vec_Int_t * vLeft = Vec_IntAlloc( Vec_IntSize(pRun->vOuts) );
+    Abc_Cex_t * pCex;
+    int i, iOut;
+    pthread_mutex_lock( &pRun->p->Mutex );
+    Vec_IntForEachEntry( pRun->vOuts, iOut, i )
+    {
+        pCex = vCexes ? (Abc_Cex_t *)Vec_PtrEntry(vCexes, i) : NULL;
+        if ( Cec_GiaMultiRecordOne(pRun, i, pCex, vOutMap && Vec_IntEntry(vOutMap, i) == 1, vInv) == -1 )
+            Vec_IntPush( vLeft, iOut );
+    }
+    fflush( stdout );
+    pthread_mutex_unlock( &pRun->p->Mutex );
+    return vLeft;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the invariant of a cone to the design flops.]
+
+  Description [The invariant is in the format of Abc_FrameSetInv().
+  Entry k of vFlops is the design flop of flop k of the cone, or -1 for
+  the constant flop added to a combinational cone. Since such a cone has
+  no other flops, the cubes of this flop are dropped, which leaves
+  the invariant true, as it should be for a combinational property.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cec_GiaMultiInvRemap( Vec_Int_t * vInv, Vec_Int_t * vFlops, int nRegs )
+{
+    Vec_Int_t * vRes = Vec_IntAlloc( Vec_IntSize(vInv) );
+    int i, k, nLits, Lit, fSkip, * pList = Vec_IntArray(vInv);
+    Vec_IntPush( vRes, 0 );
+    for ( i = 0, pList++; i < Vec_IntEntry(vInv, 0); i++, pList += nLits + 1 )
+    {
+        nLits = pList[0];
+        for ( fSkip = k = 0; k < nLits; k++ )
+            fSkip |= Vec_IntEntry(vFlops, Abc_Lit2Var(pList[k+1])) == -1;
+        if ( fSkip )
+            continue;
+        Vec_IntAddToEntry( vRes, 0, 1 );
+        Vec_IntPush( vRes, nLits );
+        for ( k = 0; k < nLits; k++ )
+        {
+            Lit = pList[k+1];
+            Vec_IntPush( vRes, Abc_Var2Lit(Vec_IntEntry(vFlops, Abc_Lit2Var(Lit)), Abc_LitIsCompl(Lit)) );
+        }
+    }
+    Vec_IntPush( vRes, nRegs );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one group of outputs.]
+
+  Description [Runs a portfolio of engines on the cone of the group,
+  each time on the outputs left undecided by the previous engines:
+  BMC looking for counter-examples of all outputs (a quarter of the
+  runtime limit), PDR proving or disproving all outputs (a half of
+  the runtime limit), and finally, PDR with abstraction on each output
+  separately (the remaining runtime, divided among the outputs). The
+  outputs failed by BMC and PDR are reported by the callback as soon
+  as they fail, while the invariants derived by PDR are recorded for
+  each output they prove.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Cec_GiaMultiAddFlop( Gia_Man_t * p )
+{
+    // the engines expect a sequential design; add a constant flop to a combinational cone
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj; int i;
+    assert( Gia_ManRegNum(p) == 0 );
+    pNew = Gia_ManStart( Gia_ManObjNum(p) + 2 );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManAppendCi( pNew );
+    Gia_ManForEachAnd( p, pObj, i )
+        pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManAppendCo( pNew, 0 );
+    Gia_ManSetRegNum( pNew, 1 );
+    return pNew;
+}
+Gia_Man_t * Cec_GiaMultiCone( Cec_MulMan_t * p, Gia_Man_t * pGia, Vec_Int_t * vFlopsGia, Vec_Int_t * vPos, Vec_Int_t ** pvFlops )
+{
+    // the cone flops are mapped into the design flops using the flop map vFlopsGia of pGia
+    Gia_Man_t * pCone, * pTemp;
+    Gia_Obj_t * pObj; int i, iFlop;
+    if ( pGia == p->p )  pthread_mutex_lock( &p->Mutex );
+    Gia_ManFillValue( pGia );
+    pCone = Gia_ManDupCones( pGia, Vec_IntArray(vPos), Vec_IntSize(vPos), 0 );
+    *pvFlops = Vec_IntStartFull( Gia_ManRegNum(pCone) );
+    Gia_ManForEachRo( pGia, pObj, i )
+        if ( ~pObj->Value )
+        {
+            iFlop = Gia_ObjCioId( Gia_ManObj(pCone, Abc_Lit2Var(pObj->Value)) ) - Gia_ManPiNum(pCone);
+            Vec_IntWriteEntry( *pvFlops, iFlop, vFlopsGia ? Vec_IntEntry(vFlopsGia, i) : i );
+        }
+    if ( pGia == p->p )  pthread_mutex_unlock( &p->Mutex );
+    if ( Gia_ManRegNum(pCone) == 0 )
+    {
+        pCone = Cec_GiaMultiAddFlop( pTemp = pCone );
+        Gia_ManStop( pTemp );
+        Vec_IntPush( *pvFlops, -1 );
+    }
+    return pCone;
+}
+int Cec_GiaMultiSolvePdr( Cec_MulRun_t * pRun, Vec_Int_t * vFlops, Pdr_Par_t * pPars, Aig_Man_t ** ppAig, Vec_Int_t ** pvInv )
+{
+    // runs PDR on the cone and derives its invariant over the design flops (if any)
+    int RetValue;
+    pPars->fStoreCex   = 1;
+    pPars->fStoreInv   = 1;
+    pPars->fNotVerbose = 1;
+    pPars->fSilent     = 1;
+    pPars->pFuncOnFail = Cec_GiaMultiCallBackOnFail;
+    *ppAig = Gia_ManToAigSimple( pRun->pCone );
+    s_pMulRun = pRun;
+    RetValue = Pdr_ManSolve( *ppAig, pPars );
+    s_pMulRun = NULL;
+    *pvInv = pPars->vInv ? Cec_GiaMultiInvRemap( pPars->vInv, vFlops, Gia_ManRegNum(pRun->p->p) ) : NULL;
+    Vec_IntFreeP( &pPars->vInv );
+    return RetValue;
+}
+void Cec_GiaMultiSolveGroup( Cec_MulMan_t * p, int iGroup )
+{
+    abctime clk = Abc_Clock();
+    abctime clkStop = clk + (abctime)p->nTimeOut * CLOCKS_PER_SEC;
+    Vec_Int_t * vOuts = Vec_IntDup( Vec_WecEntry(p->vGroups, iGroup) ), * vLeft, * vPos, * vInv;
+    Vec_Int_t * vFlops, * vFlopsOne;
+    Gia_Man_t * pCone = Cec_GiaMultiCone( p, p->p, NULL, vOuts, &vFlops ), * pTemp;
+    Cec_MulRun_t Run = { p, iGroup, pCone, vOuts, (char *)"bmc3" }, * pRun = &Run;
+    Aig_Man_t * pAig;
+    int i, iOut, nTimeOut, nOuts = Vec_IntSize(vOuts);
+    if ( p->fVeryVerbose )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        printf( "Started group %5d with %4d outputs:  ", iGroup, nOuts );
+        Gia_ManPrintStats( pCone, NULL );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    // BMC finds counter-examples of all outputs
+    {
+        Saig_ParBmc_t Pars, * pPars = &Pars;
+        Saig_ParBmcSetDefaultParams( pPars );
+        pPars->nTimeOut    = Abc_MaxInt( 1, p->nTimeOut / 4 );
+        pPars->fSolveAll   = 1;
+        pPars->fStoreCex   = 1;
+        pPars->fNotVerbose = 1;
+        pPars->fSilent     = 1;
+        pPars->pFuncOnFail = Cec_GiaMultiCallBackOnFail;
+        pAig = Gia_ManToAigSimple( pCone );
+        s_pMulRun = pRun;
+        Saig_ManBmcScalable( pAig, pPars );
+        s_pMulRun = NULL;
+        vLeft = Cec_GiaMultiRecord( pRun, pAig->vSeqModelVec, NULL, NULL );
+        if ( pAig->vSeqModelVec )
+            Vec_PtrFreeFree( pAig->vSeqModelVec ), pAig->vSeqModelVec = NULL;
+        Aig_ManStop( pAig );
+    }
+    // PDR proves or disproves the remaining outputs
+    if ( Vec_IntSize(vLeft) > 0 && Abc_Clock() < clkStop )
+    {
+        Pdr_Par_t Pars, * pPars = &Pars;
+        vPos  = Vec_IntAlloc( Vec_IntSize(vLeft) );
+        Vec_IntForEachEntry( vLeft, iOut, i )
+            Vec_IntPush( vPos, Vec_IntFind(vOuts, iOut) );
+        pCone = Cec_GiaMultiCone( p, pTemp = pCone, vFlopsOne = vFlops, vPos, &vFlops );
+        Gia_ManStop( pTemp );
+        Vec_IntFree( vFlopsOne );
+        Vec_IntFree( vPos );
+        Vec_IntFree( vOuts );
+        vOuts = vLeft;
+        pRun->pCone   = pCone;
+        pRun->vOuts   = vOuts;
+        pRun->pEngine = (char *)"pdr";
+        Pdr_ManSetDefaultParams( pPars );
+        pPars->nTimeOut    = Abc_MaxInt( 1, (int)((clkStop - Abc_Clock()) / CLOCKS_PER_SEC) * 2 / 3 );
+        pPars->fSolveAll   = 1;
+        Cec_GiaMultiSolvePdr( pRun, vFlops, pPars, &pAig, &vInv );
+        vLeft = Cec_GiaMultiRecord( pRun, pAig->vSeqModelVec, pPars->vOutMap, vInv );
+        if ( pAig->vSeqModelVec )
+            Vec_PtrFreeFree( pAig->vSeqModelVec ), pAig->vSeqModelVec = NULL;
+        Vec_IntFreeP( &pPars->vOutMap );
+        Vec_IntFreeP( &vInv );
+        Aig_ManStop( pAig );
+    }
+    // PDR with abstraction solves each remaining output separately
+    Vec_IntForEachEntry( vLeft, iOut, i )
+    {
+        Pdr_Par_t Pars, * pPars = &Pars;
+        Cec_MulRun_t RunOne = { p, iGroup, NULL, NULL, (char *)"pdr-abs" };
+        Vec_Int_t * vOne = Vec_IntAlloc( 1 ), * vRes;
+        Vec_Ptr_t * vCexOne = Vec_PtrStart( 1 );
+        Vec_Int_t * vMapOne = Vec_IntAlloc( 1 );
+        int RetValue;
+        nTimeOut = (int)((clkStop - Abc_Clock()) / CLOCKS_PER_SEC) / (Vec_IntSize(vLeft) - i);
+        if ( nTimeOut <= 0 )
+        {
+            Vec_IntFree( vOne ); Vec_PtrFree( vCexOne ); Vec_IntFree( vMapOne );
+            break;
+        }
+        Vec_IntPush( vOne, Vec_IntFind(vOuts, iOut) );
+        RunOne.pCone = Cec_GiaMultiCone( p, pCone, vFlops, vOne, &vFlopsOne );
+        Vec_IntFill( vOne, 1, iOut );
+        RunOne.vOuts = vOne;
+        Pdr_ManSetDefaultParams( pPars );
+        pPars->fUseAbs     = 1;
+        pPars->nTimeOut    = nTimeOut;
+        RetValue = Cec_GiaMultiSolvePdr( &RunOne, vFlopsOne, pPars, &pAig, &vInv );
+        Vec_PtrWriteEntry( vCexOne, 0, RetValue == 0 ? pAig->pSeqModel : NULL );
+        Vec_IntPush( vMapOne, RetValue );
+        vRes = Cec_GiaMultiRecord( &RunOne, vCexOne, vMapOne, vInv );
+        Vec_IntFree( vRes );
+        Vec_IntFree( vOne );
+        Vec_PtrFree( vCexOne );
+        Vec_IntFree( vMapOne );
+        Vec_IntFree( vFlopsOne );
+        Vec_IntFreeP( &vInv );
+        Aig_ManStop( pAig );
+        Gia_ManStop( RunOne.pCone );
+    }
+    if ( p->fVeryVerbose )
+    {
+        int nUndec = 0;
+        pthread_mutex_lock( &p->Mutex );
+        Vec_IntForEachEntry( Vec_WecEntry(p->vGroups, iGroup), iOut, i )
+            nUndec += Vec_IntEntry(p->vStatus, iOut) == -1;
+        printf( "Finished group %5d with %4d outputs (%4d undecided).  ", iGroup, nOuts, nUndec );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    Vec_IntFree( vLeft );
+    Vec_IntFree( vOuts );
+    Vec_IntFree( vFlops );
+    Gia_ManStop( pCone );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves multi-output properties using many threads.]
+
+  Description [Partitions the outputs into groups with overlapping
+  sequential cones of influence and lets nProcs threads solve the
+  groups (see Cec_GiaMultiSolveGroup), starting with the smaller ones.
+  The outputs are reported as soon as they are solved. Returns the status
+  of each output (-1 = undecided; 0 = SAT; 1 = UNSAT) in *pvStatus,
+  the counter-examples of the failed outputs in *pvCexes, and the
+  inductive invariants of the proved outputs over the design flops
+  in *pvInvs (an empty level if PDR did not derive one). The return
+  value is 0 if some output failed, 1 if all outputs are proved, and
+  -1 otherwise.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Cec_GiaMultiWorkerThread( void * pArg )
+{
+    Cec_MulMan_t * p = (Cec_MulMan_t *)pArg;
+    int iGroup;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        iGroup = p->iNext++;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( iGroup >= Vec_WecSize(p->vGroups) )
+            break;
+        Cec_GiaMultiSolveGroup( p, iGroup );
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+int Cec_GiaProveMulti( Gia_Man_t * pGia, int nProcs, int nGroupMax, int nOverlap, int nTimeOut, int fVerbose, int fVeryVerbose, Vec_Int_t ** pvStatus, Vec_Ptr_t ** pvCexes, Vec_Wec_t ** pvInvs )
+{
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Cec_MulMan_t Man, * p = &Man;
+    Vec_Wec_t * vSupps;
+    int i, status, RetValue;
+    memset( p, 0, sizeof(Cec_MulMan_t) );
+    p->p            = pGia;
+    p->nTimeOut     = nTimeOut;
+    p->fVerbose     = fVerbose;
+    p->fVeryVerbose = fVeryVerbose;
+    p->vStatus      = Vec_IntStartFull( Gia_ManPoNum(pGia) );
+    p->vCexes       = Vec_PtrStart( Gia_ManPoNum(pGia) );
+    p->vInvs        = Vec_WecStart( Gia_ManPoNum(pGia) );
+    p->clkStart     = Abc_Clock();
+    // group the outputs
+    vSupps     = Cec_GiaMultiSupps( pGia );
+    p->vGroups = Cec_GiaMultiGroups( pGia, vSupps, nGroupMax, nOverlap );
+    Vec_WecFree( vSupps );
+    nProcs = Abc_MaxInt( 1, Abc_MinInt(Abc_MinInt(nProcs, Vec_WecSize(p->vGroups)), PAR_THR_MAX) );
+    if ( fVerbose )
+    {
+        printf( "Solving %d outputs divided into %d groups (at most %d outputs with %d %% overlap) using %d threads.  ",
+            Gia_ManPoNum(pGia), Vec_WecSize(p->vGroups), nGroupMax, nOverlap, nProcs );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - p->clkStart );
+    }
+    fflush( stdout );
+    // solve the groups
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Cec_GiaMultiWorkerThread, (void *)p );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    pthread_mutex_destroy( &p->Mutex );
+    // report the results
+    printf( "Outputs = %d.  Groups = %d.  SAT = %d.  UNSAT = %d.  Undecided = %d.  ", Gia_ManPoNum(pGia), Vec_WecSize(p->vGroups),
+        p->nSolved[0], p->nSolved[1], Gia_ManPoNum(pGia) - p->nSolved[0] - p->nSolved[1] );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - p->clkStart );
+    RetValue = p->nSolved[0] ? 0 : (p->nSolved[1] == Gia_ManPoNum(pGia) ? 1 : -1);
+    Vec_WecFree( p->vGroups );
+    *pvStatus = p->vStatus;
+    *pvCexes  = p->vCexes;
+    *pvInvs   = p->vInvs;
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -20,11 +20,30 @@
 
 #include "aig/gia/gia.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilSimd.h"
 #include "cec.h"
 #include "bdd/extrab/extraBdd.h"
 #include "base/abc/abc.h"
 #include "map/if/if.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#include <stdbool.h>
+#endif
+
+#endif
+
 #define USE_GLUCOSE2
 
 #ifdef USE_GLUCOSE2
@@ -105,6 +124,7 @@ struct Cec4_Man_t_
     Vec_Bit_t *      vFails;
     Vec_Bit_t *      vCoDrivers;
     Vec_Int_t *      vPairs;   
+    Vec_Int_t *      vProvedMt;      // representatives proved by the parallel sweep
     int              iPosRead;       // candidate reading position
     int              iPosWrite;      // candidate writing position
     int              iLastConst;     // last const node proved
@@ -341,6 +361,7 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     Vec_IntFreeP( &p->vDisprPairs );
     Vec_BitFreeP( &p->vFails );
     Vec_IntFreeP( &p->vPairs );
+    Vec_IntFreeP( &p->vProvedMt );
     Vec_BitFreeP( &p->vCoDrivers );
     Vec_IntFreeP( &p->vRefClasses );
     Vec_IntFreeP( &p->vRefNodes );
@@ -880,7 +901,9 @@ static inline void Cec4_ObjSimAnd( Gia_Man_t * p, int iObj )
     word * pSim  = Cec4_ObjSim( p, iObj );
     word * pSim0 = Cec4_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec4_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
+    if ( p->nSimWords >= ABC_SIMD_MIN_WORDS )
+        Abc_SimdAnd( pSim, pSim0, pSim1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), p->nSimWords );
+    else if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
         for ( w = 0; w < p->nSimWords; w++ )
             pSim[w] = ~pSim0[w] & ~pSim1[w];
     else if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) )
@@ -900,7 +923,9 @@ static inline void Cec4_ObjSimXor( Gia_Man_t * p, int iObj )
     word * pSim  = Cec4_ObjSim( p, iObj );
     word * pSim0 = Cec4_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec4_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj) )
+    if ( p->nSimWords >= ABC_SIMD_MIN_WORDS )
+        Abc_SimdXor( pSim, pSim0, pSim1, Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj), p->nSimWords );
+    else if ( Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj) )
         for ( w = 0; w < p->nSimWords; w++ )
             pSim[w] = ~pSim0[w] ^ pSim1[w];
     else
@@ -1010,7 +1035,7 @@ void Cec4_ManSimAlloc( Gia_Man_t * p, int nWords )
 {
     Vec_WrdFreeP( &p->vSims );
     Vec_WrdFreeP( &p->vSimsPi );
-    p->vSims     = Vec_WrdStart( Gia_ManObjNum(p) * nWords );
+    p->vSims     = Vec_WrdStartAligned( Gia_ManObjNum(p) * nWords );
     p->vSimsPi   = Vec_WrdStart( (Gia_ManCiNum(p) + 1) * nWords );
     p->nSimWords = nWords;
 }
@@ -1858,6 +1883,670 @@ void Cec4_ManSimulateDumpInfo( Cec4_Man_t * pMan )
     Vec_WrdFree( vSims );
     Vec_WrdFree( vSimsPi );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Batched SAT solving of node pairs.]
+
+  Description [The batched solver compares pairs of literals of an AIG. 
+  It owns a SAT solver, into which the CNF of the AIG is loaded lazily. 
+  The pairs are solved in batches: the union of the cones of a batch is 
+  loaded at once and the pairs are solved one after another under 
+  assumptions, so that the clauses learned for one pair are reused for 
+  the following ones. The solver is recycled only before a batch. The 
+  counter-examples are stored in the solver as the number of literals 
+  followed by the literals, each of which is the CI index complemented 
+  if the CI value is 1.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+struct Cec4_Bat_t_
+{
+    Gia_Man_t *      pAig;           // the AIG whose nodes are compared
+    int              jType;          // the solver type (0 = CNF, 1 = CNF and J-frontier, 2 = J-frontier)
+    int              nBTLimit;       // conflict limit at a pair
+    int              nBTLimitPo;     // conflict limit at a pair requiring more effort
+    int              nCallsRecycle;  // calls to perform before recycling SAT solver
+    int              nSatVarMax;     // the max number of SAT variables before recycling SAT solver
+    sat_solver *     pSat;           // SAT solver
+    Vec_Int_t *      vSatIds;        // mapping of AigIds into SatIds
+    Vec_Int_t *      vSuppVars;      // AigIds for which SatId is defined
+    Vec_Int_t *      vCopiesTwo;     // pairs (CiAigId, SatId)
+    Vec_Int_t *      vVarMap;        // mapping of SatId into AigId
+    Vec_Int_t *      vCexes;         // counter-examples (the number of literals followed by literals)
+    int              nCallsSince;    // calls since the last recycling
+    int              nCalls;         // the number of SAT calls
+    int              nBatches;       // the number of batches
+    int              nCexReused;     // the pairs disproved by the counter-examples of other pairs
+};
+
+static inline int Cec4_BatObjSatId( Cec4_Bat_t * p, int iObj ) { return Vec_IntEntry(p->vSatIds, iObj); }
+static inline int Cec4_BatObjSetSatId( Cec4_Bat_t * p, int iObj )
+{
+    int iVar = sat_solver_addvar( p->pSat );
+    assert( Cec4_BatObjSatId(p, iObj) == -1 );
+    assert( Vec_IntSize(p->vVarMap) == iVar );
+    Vec_IntWriteEntry( p->vSatIds, iObj, iVar );
+    Vec_IntPush( p->vSuppVars, iObj );
+    if ( Gia_ObjIsCi(Gia_ManObj(p->pAig, iObj)) )
+        Vec_IntPushTwo( p->vCopiesTwo, iObj, iVar );
+    Vec_IntPush( p->vVarMap, iObj );
+    return iVar;
+}
+int Cec4_BatObjGetCnfVar( Cec4_Bat_t * p, int iObj )
+{
+    Gia_Man_t * pAig = p->pAig;
+    Gia_Obj_t * pObj = Gia_ManObj( pAig, iObj ), * pFan0, * pFan1;
+    int iVar, iVar0, iVar1;
+    if ( Cec4_BatObjSatId(p, iObj) >= 0 )
+        return Cec4_BatObjSatId(p, iObj);
+    assert( iObj > 0 );
+    if ( Gia_ObjIsCi(pObj) )
+        return Cec4_BatObjSetSatId( p, iObj );
+    assert( Gia_ObjIsAnd(pObj) );
+    // this is the same as the simple CNF in Cec4_ObjGetCnfVar()
+    if ( !Gia_ObjIsXor(pObj) && Gia_ObjRecognizeExor(pObj, &pFan0, &pFan1) && Gia_IsComplement(pFan0) == Gia_IsComplement(pFan1) )
+    {
+        iVar0 = Cec4_BatObjGetCnfVar( p, Gia_ObjId(pAig, Gia_Regular(pFan0)) );
+        iVar1 = Cec4_BatObjGetCnfVar( p, Gia_ObjId(pAig, Gia_Regular(pFan1)) );
+        iVar  = Cec4_BatObjSetSatId( p, iObj );
+        if ( p->jType < 2 )
+            sat_solver_add_xor( p->pSat, iVar, iVar0, iVar1, 0 );
+        if ( p->jType > 0 )
+        {
+            int Lit0 = Abc_Var2Lit( iVar0, 0 );
+            int Lit1 = Abc_Var2Lit( iVar1, 0 );
+            if ( Lit0 < Lit1 )
+                 Lit1 ^= Lit0, Lit0 ^= Lit1, Lit1 ^= Lit0;
+            sat_solver_set_var_fanin_lit( p->pSat, iVar, Lit0, Lit1 );
+        }
+    }
+    else
+    {
+        iVar0 = Cec4_BatObjGetCnfVar( p, Gia_ObjFaninId0(pObj, iObj) );
+        iVar1 = Cec4_BatObjGetCnfVar( p, Gia_ObjFaninId1(pObj, iObj) );
+        iVar  = Cec4_BatObjSetSatId( p, iObj );
+        if ( p->jType < 2 )
+        {
+            if ( Gia_ObjIsXor(pObj) )
+                sat_solver_add_xor( p->pSat, iVar, iVar0, iVar1, Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj) );
+            else
+                sat_solver_add_and( p->pSat, iVar, iVar0, iVar1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), 0 );
+        }
+        if ( p->jType > 0 )
+        {
+            int Lit0 = Abc_Var2Lit( iVar0, Gia_ObjFaninC0(pObj) );
+            int Lit1 = Abc_Var2Lit( iVar1, Gia_ObjFaninC1(pObj) );
+            if ( (Lit0 > Lit1) ^ Gia_ObjIsXor(pObj) )
+                 Lit1 ^= Lit0, Lit0 ^= Lit1, Lit1 ^= Lit0;
+            sat_solver_set_var_fanin_lit( p->pSat, iVar, Lit0, Lit1 );
+        }
+    }
+    return iVar;
+}
+void Cec4_BatSolverRecycle( Cec4_Bat_t * p )
+{
+    int i, iObj;
+    p->nCallsSince = 0;
+    sat_solver_reset( p->pSat );
+    Vec_IntForEachEntry( p->vSuppVars, iObj, i )
+        Vec_IntWriteEntry( p->vSatIds, iObj, -1 );
+    Vec_IntClear( p->vSuppVars );
+    Vec_IntClear( p->vCopiesTwo );
+    Vec_IntClear( p->vVarMap );
+}
+static inline int Cec4_BatPairNodes( int * pLits, int * piObj0, int * piObj1 )
+{
+    *piObj0 = Abc_Lit2Var(pLits[0]);
+    *piObj1 = Abc_Lit2Var(pLits[1]);
+    if ( *piObj1 < *piObj0 ) 
+         *piObj1 ^= *piObj0, *piObj0 ^= *piObj1, *piObj1 ^= *piObj0;
+    return Abc_LitIsCompl(pLits[0]) ^ Abc_LitIsCompl(pLits[1]);
+}
+int Cec4_BatSaveCex( Cec4_Bat_t * p )
+{
+    int i, IdAig, IdSat, iStart = Vec_IntSize( p->vCexes );
+    Vec_IntPush( p->vCexes, 0 );
+    if ( p->jType == 0 )
+    {
+        Vec_IntForEachEntryDouble( p->vCopiesTwo, IdAig, IdSat, i )
+            Vec_IntPush( p->vCexes, Abc_Var2Lit(Gia_ObjCioId(Gia_ManObj(p->pAig, IdAig)), sat_solver_read_cex_varvalue(p->pSat, IdSat)) );
+    }
+    else
+    {
+        int * pCex = sat_solver_read_cex( p->pSat );
+        int * pMap = Vec_IntArray( p->vVarMap );
+        for ( i = 0; i < pCex[0]; )
+        {
+            int iLit = Abc_Lit2LitV( pMap, Abc_LitNot(pCex[++i]) );
+            Gia_Obj_t * pCi = Gia_ManObj( p->pAig, Abc_Lit2Var(iLit) );
+            if ( Gia_ObjIsCi(pCi) )
+                Vec_IntPush( p->vCexes, Abc_Var2Lit(Gia_ObjCioId(pCi), Abc_LitIsCompl(iLit)) );
+        }
+    }
+    Vec_IntWriteEntry( p->vCexes, iStart, Vec_IntSize(p->vCexes) - iStart - 1 );
+    return iStart;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the batched solver.]
+
+  Description [The AIG may grow while the solver is used (the mapping 
+  of its nodes is extended in Cec4_BatSolve), but the nodes loaded 
+  into the solver should not change.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cec4_Bat_t * Cec4_BatStart( Gia_Man_t * pAig, int jType, int nBTLimit, int nBTLimitPo, int nCallsRecycle, int nSatVarMax )
+{
+    Cec4_Bat_t * p = ABC_CALLOC( Cec4_Bat_t, 1 );
+    p->pAig          = pAig;
+    p->jType         = jType;
+    p->nBTLimit      = nBTLimit;
+    p->nBTLimitPo    = nBTLimitPo;
+    p->nCallsRecycle = nCallsRecycle;
+    p->nSatVarMax    = nSatVarMax;
+    p->pSat          = sat_solver_start();
+    sat_solver_set_jftr( p->pSat, jType );
+    p->vSatIds       = Vec_IntStartFull( Gia_ManObjNum(pAig) );
+    p->vSuppVars     = Vec_IntAlloc( 1000 );
+    p->vCopiesTwo    = Vec_IntAlloc( 1000 );
+    p->vVarMap       = Vec_IntAlloc( 1000 );
+    p->vCexes        = Vec_IntAlloc( 1000 );
+    return p;
+}
+void Cec4_BatStop( Cec4_Bat_t * p )
+{
+    sat_solver_stop( p->pSat );
+    Vec_IntFree( p->vSatIds );
+    Vec_IntFree( p->vSuppVars );
+    Vec_IntFree( p->vCopiesTwo );
+    Vec_IntFree( p->vVarMap );
+    Vec_IntFree( p->vCexes );
+    ABC_FREE( p );
+}
+Vec_Int_t * Cec4_BatReadCexes( Cec4_Bat_t * p )
+{
+    return p->vCexes;
+}
+void Cec4_BatPrintStats( Cec4_Bat_t * p )
+{
+    printf( "SAT calls = %8d.  Batches = %6d.  Reused CEXes = %6d.  ", p->nCalls, p->nBatches, p->nCexReused );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves a batch of pairs.]
+
+  Description [Takes nPairs pairs of literals of the AIG listed in pLits
+  and checks the equivalence of the two literals of each pair. Loads the 
+  union of their cones into the solver at once and solves the pairs one 
+  after another under assumptions. When a pair is disproved, the 
+  satisfying assignment is checked against the pairs left in the batch, 
+  and those it distinguishes are disproved by the same counter-example 
+  without calling the solver (this is done only for jType == 0, because 
+  otherwise the assignment is partial). A pair of literals of the same 
+  node is proved, or disproved by the empty counter-example (the pattern 
+  of all zeros) if the literals are complemented. The pairs with non-zero 
+  entries in pfEffort (if given) are solved with the larger conflict 
+  limit. Writes the status of each pair into pStatus (GLUCOSE_UNSAT if 
+  the literals are equivalent, GLUCOSE_SAT if they are not, GLUCOSE_UNDEC 
+  if the conflict limit is reached) and the position of its counter-example 
+  in the storage of the solver into pCexPos, which should be initialized 
+  to -1.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec4_BatSolve( Cec4_Bat_t * p, int * pLits, int nPairs, int * pfEffort, int * pStatus, int * pCexPos )
+{
+    int i, k, status, fCompl, iObj0, iObj1, iVar0, iVar1, Val0, Val1, Lits[2];
+    p->nBatches++;
+    p->nCallsSince += nPairs;
+    if ( p->nCallsSince > p->nCallsRecycle && 
+         Vec_IntSize(p->vSuppVars) > p->nSatVarMax && p->nSatVarMax )
+        Cec4_BatSolverRecycle( p );
+    Vec_IntFillExtra( p->vSatIds, Gia_ManObjNum(p->pAig), -1 );
+    // load the union of the cones
+    for ( k = 0; k < nPairs; k++ )
+    {
+        Cec4_BatPairNodes( pLits + 2*k, &iObj0, &iObj1 );
+        if ( iObj0 == iObj1 )
+            continue;
+        // the constant node has a variable assumed to be 0
+        if ( !iObj0 && Cec4_BatObjSatId(p, 0) == -1 )
+            Cec4_BatObjSetSatId( p, 0 );
+        Cec4_BatObjGetCnfVar( p, iObj0 );
+        Cec4_BatObjGetCnfVar( p, iObj1 );
+    }
+    // solve the pairs
+    for ( k = 0; k < nPairs; k++ )
+    {
+        if ( pCexPos[k] >= 0 ) // disproved by the counter-example of another pair
+            continue;
+        fCompl = Cec4_BatPairNodes( pLits + 2*k, &iObj0, &iObj1 );
+        if ( iObj0 == iObj1 )
+        {
+            pStatus[k] = fCompl ? GLUCOSE_SAT : GLUCOSE_UNSAT;
+            if ( fCompl )
+            {
+                pCexPos[k] = Vec_IntSize( p->vCexes );
+                Vec_IntPush( p->vCexes, 0 );
+            }
+            continue;
+        }
+        p->nCalls++;
+        iVar0 = Cec4_BatObjSatId( p, iObj0 );
+        iVar1 = Cec4_BatObjSatId( p, iObj1 );
+        if ( p->jType > 0 )
+        {
+            sat_solver_start_new_round( p->pSat );
+            sat_solver_mark_cone( p->pSat, iVar0 );
+            sat_solver_mark_cone( p->pSat, iVar1 );
+        }
+        Lits[0] = Abc_Var2Lit(iVar0, 1);
+        Lits[1] = Abc_Var2Lit(iVar1, fCompl);
+        sat_solver_set_conflict_budget( p->pSat, (pfEffort && pfEffort[k]) ? p->nBTLimitPo : p->nBTLimit );
+        status = sat_solver_solve( p->pSat, Lits, 2 );
+        if ( status == GLUCOSE_UNSAT && iObj0 > 0 )
+        {
+            Lits[0] = Abc_Var2Lit(iVar0, 0);
+            Lits[1] = Abc_Var2Lit(iVar1, !fCompl);
+            sat_solver_set_conflict_budget( p->pSat, (pfEffort && pfEffort[k]) ? p->nBTLimitPo : p->nBTLimit );
+            status = sat_solver_solve( p->pSat, Lits, 2 );
+        }
+        pStatus[k] = status;
+        if ( status != GLUCOSE_SAT )
+            continue;
+        pCexPos[k] = Cec4_BatSaveCex( p );
+        // with J-frontier the assignment is partial and cannot be reused
+        if ( p->jType > 0 )
+            continue;
+        for ( i = k + 1; i < nPairs; i++ )
+        {
+            if ( pCexPos[i] >= 0 )
+                continue;
+            fCompl = Cec4_BatPairNodes( pLits + 2*i, &iObj0, &iObj1 );
+            if ( iObj0 == iObj1 )
+                continue;
+            Val0 = iObj0 ? sat_solver_read_cex_varvalue( p->pSat, Cec4_BatObjSatId(p, iObj0) ) : 0;
+            Val1 = sat_solver_read_cex_varvalue( p->pSat, Cec4_BatObjSatId(p, iObj1) );
+            if ( Val0 == (Val1 ^ fCompl) )
+                continue;
+            pStatus[i] = GLUCOSE_SAT;
+            pCexPos[i] = pCexPos[k];
+            p->nCexReused++;
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of the miter using the batched solver.]
+
+  Description [Has the same interface as Cec_ManSatSolveMiter(): returns 
+  the counter-examples in the format of Cec_ManSatAddToStore() and sets 
+  the status of each output (1 = constant 0, 0 = not constant 0, -1 = 
+  undecided). The outputs are solved in batches of nBatch by one solver.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cec4_ManSolveMiterBatch( Gia_Man_t * pAig, int nBTLimit, int nBatch, Vec_Str_t ** pvStatus, int fVerbose )
+{
+    // the J-frontier limits the satisfying assignments to the cones of the pair, 
+    // which is faster than the complete assignments needed to reuse them
+    Cec4_Bat_t * p = Cec4_BatStart( pAig, 1, nBTLimit, nBTLimit, 500, 1000 );
+    Vec_Int_t * vCexStore = Vec_IntAlloc( 10000 );
+    Vec_Str_t * vStatus = Vec_StrAlloc( Gia_ManPoNum(pAig) );
+    int nPos = Gia_ManPoNum(pAig), * pLits = ABC_ALLOC( int, 2 * nPos + 2 );
+    int * pStatus = ABC_ALLOC( int, nPos + 1 ), * pCexPos = ABC_FALLOC( int, nPos + 1 );
+    int i, k, iPos, nLits, nStats[3] = {0};
+    Gia_Obj_t * pObj;
+    abctime clk = Abc_Clock();
+    assert( nBatch > 0 );
+    // each output is compared with constant 0
+    Gia_ManForEachPo( pAig, pObj, i )
+    {
+        pLits[2*i]   = 0;
+        pLits[2*i+1] = Gia_ObjFaninLit0p( pAig, pObj );
+    }
+    for ( k = 0; k < nPos; k += nBatch )
+        Cec4_BatSolve( p, pLits + 2*k, Abc_MinInt(nBatch, nPos - k), NULL, pStatus + k, pCexPos + k );
+    for ( i = 0; i < nPos; i++ )
+    {
+        if ( pStatus[i] == GLUCOSE_UNSAT )
+        {
+            Vec_StrPush( vStatus, 1 );
+            nStats[0]++;
+            continue;
+        }
+        Vec_IntPush( vCexStore, i );
+        if ( pStatus[i] != GLUCOSE_SAT ) // timeout
+        {
+            Vec_StrPush( vStatus, -1 );
+            Vec_IntPush( vCexStore, -1 );
+            nStats[2]++;
+            continue;
+        }
+        Vec_StrPush( vStatus, 0 );
+        nStats[1]++;
+        // the literals of Cec_ManSatAddToStore() are complemented if the value is 0
+        iPos  = pCexPos[i];
+        nLits = Vec_IntEntry( p->vCexes, iPos );
+        Vec_IntPush( vCexStore, nLits );
+        for ( k = 1; k <= nLits; k++ )
+            Vec_IntPush( vCexStore, Abc_LitNot(Vec_IntEntry(p->vCexes, iPos + k)) );
+    }
+    if ( fVerbose )
+    {
+        printf( "Batched solving of %d outputs:  P = %d.  D = %d.  F = %d.  ", nPos, nStats[0], nStats[1], nStats[2] );
+        Cec4_BatPrintStats( p );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Cec4_BatStop( p );
+    ABC_FREE( pLits );
+    ABC_FREE( pStatus );
+    ABC_FREE( pCexPos );
+    *pvStatus = vStatus;
+    return vCexStore;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded SAT sweeping of the candidate pairs.]
+
+  Description [Proves or disproves the pairs (representative, node) of 
+  the current equivalence classes concurrently, before the sequential 
+  sweeping builds the final AIG. The AND nodes are visited in topological 
+  order in waves. Before each wave, the main thread adds the nodes of the 
+  wave to the internal AIG, in which the nodes proved in the previous 
+  waves are merged. The candidate pairs are then split into batches 
+  (see Cec4_BatSolve), which are assigned to the threads in a round-
+  robin order. Each thread owns a SAT solver loaded with the CNF of the 
+  internal AIG, which does not change while the threads run. After 
+  the wave, the main thread adds the counter-examples to the simulation 
+  patterns and refines the classes in the order of the pairs. Since each 
+  thread solves the same batches in the same order, the result is 
+  reproducible for a fixed number of threads, but it may change with the 
+  number of threads (the solvers, and hence the counter-examples and the 
+  pairs left undecided by the conflict limit, differ). The pairs proved 
+  equivalent are recorded, so that the sequential sweeping merges them 
+  without calling the SAT solver again.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void Cec4_ManSweepMt( Gia_Man_t * p, Cec4_Man_t * pMan ) {}
+
+#else // pthreads are used
+
+#define CEC4_THR_MAX    100
+#define CEC4_BATCH_SIZE  16  // the max number of pairs solved together by a thread
+
+typedef struct Cec4_ThQueue_t_
+{
+    Gia_Man_t *      pAig;           // user's AIG
+    Gia_Man_t *      pNew;           // internal AIG
+    Cec4_Man_t *     pMan;           // SAT sweeping manager
+    Vec_Int_t *      vPairs;         // candidate pairs (iRepr, iObj)
+    int *            pStatus;        // the outcome for each pair
+    int *            pCexThread;     // the thread that disproved the pair
+    int *            pCexPos;        // the CEX position in the storage of this thread
+    int              nBatch;         // the number of pairs in a batch
+    int              nProcs;         // the number of threads
+} Cec4_ThQueue_t;
+typedef struct Cec4_ThData_t_
+{
+    Cec4_ThQueue_t * pQueue;         // the shared queue
+    Cec4_Bat_t *     pBat;           // batched solver of this thread working on the internal AIG
+    Vec_Int_t *      vLits;          // the pairs of the current batch as literals of the internal AIG
+    Vec_Int_t *      vEffort;        // the pairs of the current batch requiring more effort
+    abctime          clkUsed;        // runtime of this thread
+    int              iThread;        // the thread number
+    int              fStop;          // stop the thread
+    atomic_bool      fWorking;
+} Cec4_ThData_t;
+
+void Cec4_ThProcessPairs( Cec4_ThData_t * pTh )
+{
+    Cec4_ThQueue_t * pQueue = pTh->pQueue;
+    Gia_Man_t * p = pQueue->pAig;
+    Vec_Bit_t * vCoDrivers = pQueue->pMan->vCoDrivers;
+    Gia_Obj_t * pObj, * pRepr;
+    int i, k, iObj, iRepr, nBatch, nPairs = Vec_IntSize(pQueue->vPairs) / 2;
+    abctime clk = Abc_Clock();
+    // the batches are assigned statically, so that the result does not depend on the thread timing
+    for ( k = pTh->iThread * pQueue->nBatch; k < nPairs; k += pQueue->nProcs * pQueue->nBatch )
+    {
+        nBatch = Abc_MinInt( pQueue->nBatch, nPairs - k );
+        // the nodes of the pair are equivalent if their literals in the internal AIG 
+        // are equivalent after the complementation by the phases
+        Vec_IntClear( pTh->vLits );
+        Vec_IntClear( pTh->vEffort );
+        for ( i = 0; i < nBatch; i++ )
+        {
+            iRepr = Vec_IntEntry( pQueue->vPairs, 2*(k+i) );
+            iObj  = Vec_IntEntry( pQueue->vPairs, 2*(k+i)+1 );
+            pRepr = Gia_ManObj( p, iRepr );
+            pObj  = Gia_ManObj( p, iObj );
+            Vec_IntPushTwo( pTh->vLits, Abc_LitNotCond(pRepr->Value, pRepr->fPhase), Abc_LitNotCond(pObj->Value, pObj->fPhase) );
+            Vec_IntPush( pTh->vEffort, vCoDrivers ? Vec_BitEntry(vCoDrivers, iRepr) || Vec_BitEntry(vCoDrivers, iObj) : 0 );
+        }
+        Cec4_BatSolve( pTh->pBat, Vec_IntArray(pTh->vLits), nBatch, Vec_IntArray(pTh->vEffort), pQueue->pStatus + k, pQueue->pCexPos + k );
+        for ( i = 0; i < nBatch; i++ )
+            pQueue->pCexThread[k+i] = pTh->iThread;
+    }
+    pTh->clkUsed += Abc_Clock() - clk;
+}
+void * Cec4_WorkerThread( void * pArg )
+{
+    Cec4_ThData_t * pTh = (Cec4_ThData_t *)pArg;
+    while ( 1 )
+    {
+        while ( !atomic_load_explicit( &pTh->fWorking, memory_order_acquire ) );
+        if ( pTh->fStop )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        Cec4_ThProcessPairs( pTh );
+        atomic_store_explicit( &pTh->fWorking, false, memory_order_release );
+    }
+    assert( 0 );
+    return NULL;
+}
+void Cec4_ManSweepMt( Gia_Man_t * p, Cec4_Man_t * pMan )
+{
+    Cec_ParFra_t * pPars = pMan->pPars;
+    Cec4_ThData_t ThData[CEC4_THR_MAX];
+    pthread_t WorkerThread[CEC4_THR_MAX];
+    Cec4_ThQueue_t Queue, * pQueue = &Queue;
+    Vec_Int_t * vPairs = Vec_IntAlloc( 1000 );
+    Vec_Bit_t * vUndec = Vec_BitStart( Gia_ManObjNum(p) );
+    Gia_Obj_t * pObj, * pRepr;
+    int i, k, iRepr, status, nProcs = Abc_MinInt( pPars->nProcs, CEC4_THR_MAX );
+    int nPairsMin = 64 * nProcs, iLimit = 0, nWaves = 0, nProved = 0, nDisproved = 0, nUndec = 0;
+    abctime clk = Abc_Clock();
+    assert( nProcs > 1 && p->pMuxes == NULL );
+    assert( pMan->vProvedMt == NULL );
+    pMan->vProvedMt = Vec_IntStartFull( Gia_ManObjNum(p) );
+    // start the internal AIG
+    memset( pQueue, 0, sizeof(Cec4_ThQueue_t) );
+    pQueue->pAig   = p;
+    pQueue->pNew   = Cec4_ManStartNew( p );
+    pQueue->pMan   = pMan;
+    pQueue->vPairs = vPairs;
+    pQueue->nProcs = nProcs;
+    // start the threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Cec4_ThData_t * pTh = ThData + i;
+        memset( pTh, 0, sizeof(Cec4_ThData_t) );
+        pTh->pQueue     = pQueue;
+        pTh->pBat       = Cec4_BatStart( pQueue->pNew, pPars->jType, pPars->nBTLimit, pPars->nBTLimitPo, pPars->nCallsRecycle, pPars->nSatVarMax );
+        pTh->vLits      = Vec_IntAlloc( 2 * CEC4_BATCH_SIZE );
+        pTh->vEffort    = Vec_IntAlloc( CEC4_BATCH_SIZE );
+        pTh->iThread    = i;
+        atomic_store_explicit( &pTh->fWorking, false, memory_order_release );
+        if ( i == 0 )
+            continue;
+        status = pthread_create( WorkerThread + i, NULL, Cec4_WorkerThread, (void *)pTh );  assert( status == 0 );
+    }
+    // start with the empty set of patterns
+    p->iPatsPi = 0;
+    Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
+    Vec_IntFill( pMan->vCexStamps, Gia_ManObjNum(p), 0 );
+    while ( 1 )
+    {
+        // collect the pairs left after the previous waves
+        Vec_IntClear( vPairs );
+        Gia_ManForEachAnd( p, pObj, i )
+        {
+            if ( i >= iLimit )
+                break;
+            if ( (iRepr = Gia_ObjRepr(p, i)) == GIA_VOID )
+                continue;
+            if ( Vec_IntEntry(pMan->vProvedMt, i) == iRepr || Vec_BitEntry(vUndec, i) )
+                continue;
+            if ( pPars->nLevelMax && Gia_ObjLevel(p, pObj) > pPars->nLevelMax )
+                continue;
+            Vec_IntPushTwo( vPairs, iRepr, i );
+        }
+        // add the nodes of the next wave to the internal AIG
+        for ( ; iLimit < Gia_ManObjNum(p) && Vec_IntSize(vPairs) < 2 * nPairsMin; iLimit++ )
+        {
+            pObj = Gia_ManObj( p, iLimit );
+            if ( !Gia_ObjIsAnd(pObj) )
+                continue;
+            if ( Gia_ObjIsXor(pObj) )
+                pObj->Value = Gia_ManHashXorReal( pQueue->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+            else
+                pObj->Value = Gia_ManHashAnd( pQueue->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+            if ( (iRepr = Gia_ObjRepr(p, iLimit)) == GIA_VOID )
+                continue;
+            if ( pPars->nLevelMax && Gia_ObjLevel(p, pObj) > pPars->nLevelMax )
+                continue;
+            Vec_IntPushTwo( vPairs, iRepr, iLimit );
+        }
+        if ( Vec_IntSize(vPairs) == 0 )
+            break;
+        nWaves++;
+        for ( i = 0; i < nProcs; i++ )
+            Vec_IntClear( Cec4_BatReadCexes(ThData[i].pBat) );
+        pQueue->pStatus    = ABC_ALLOC( int, Vec_IntSize(vPairs)/2 );
+        pQueue->pCexThread = ABC_ALLOC( int, Vec_IntSize(vPairs)/2 );
+        pQueue->pCexPos    = ABC_FALLOC( int, Vec_IntSize(vPairs)/2 );
+        // leave several batches to each thread for load balancing
+        pQueue->nBatch = Abc_MaxInt( 1, Abc_MinInt(CEC4_BATCH_SIZE, Vec_IntSize(vPairs) / 2 / (8 * nProcs)) );
+        // solve the pairs
+        for ( i = 1; i < nProcs; i++ )
+            atomic_store_explicit( &ThData[i].fWorking, true, memory_order_release );
+        Cec4_ThProcessPairs( ThData );
+        for ( i = 1; i < nProcs; i++ )
+            while ( atomic_load_explicit( &ThData[i].fWorking, memory_order_acquire ) );
+        // record the results in the order of the pairs
+        for ( k = 0; k < Vec_IntSize(vPairs)/2; k++ )
+        {
+            iRepr = Vec_IntEntry( vPairs, 2*k );
+            pRepr = Gia_ManObj( p, iRepr );
+            pObj  = Gia_ManObj( p, Vec_IntEntry(vPairs, 2*k+1) );
+            if ( pQueue->pStatus[k] == GLUCOSE_UNSAT )
+            {
+                // merge the node in the internal AIG for the next waves
+                pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+                Vec_IntWriteEntry( pMan->vProvedMt, Gia_ObjId(p, pObj), iRepr );
+                nProved++;
+            }
+            else if ( pQueue->pStatus[k] == GLUCOSE_SAT )
+            {
+                Vec_Int_t * vCexes = Cec4_BatReadCexes( ThData[pQueue->pCexThread[k]].pBat );
+                int iPos = pQueue->pCexPos[k], nLits = Vec_IntEntry(vCexes, iPos), iLit;
+                nDisproved++;
+                if ( nLits < 0 ) // the counter-example shared with a previous pair is already added
+                    continue;
+                Vec_IntWriteEntry( vCexes, iPos, -1 - nLits );
+                assert( p->iPatsPi >= 0 && p->iPatsPi < 64 * p->nSimWords - 1 );
+                p->iPatsPi++;
+                for ( i = 1; i <= nLits; i++ )
+                {
+                    iLit = Vec_IntEntry( vCexes, iPos + i );
+                    Cec4_ObjSimSetInputBit( p, Gia_ManCiIdToId(p, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit) );
+                }
+                // resimulate when the patterns are used up
+                if ( p->iPatsPi == 64 * p->nSimWords - 2 )
+                {
+                    Cec4_ManSimulate( p, pMan );
+                    p->iPatsPi = 0;
+                    Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
+                }
+            }
+            else
+            {
+                Vec_BitWriteEntry( vUndec, Gia_ObjId(p, pObj), 1 );
+                nUndec++;
+            }
+        }
+        if ( p->iPatsPi > 0 )
+        {
+            Cec4_ManSimulate( p, pMan );
+            p->iPatsPi = 0;
+            Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
+        }
+        Vec_IntFill( pMan->vCexStamps, Gia_ManObjNum(p), 0 );
+        ABC_FREE( pQueue->pStatus );
+        ABC_FREE( pQueue->pCexThread );
+        ABC_FREE( pQueue->pCexPos );
+    }
+    // stop the threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Cec4_ThData_t * pTh = ThData + i;
+        if ( i > 0 )
+        {
+            pTh->fStop = 1;
+            atomic_store_explicit( &pTh->fWorking, true, memory_order_release );
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+        if ( pPars->fVerbose )
+        {
+            printf( "Thread %2d : ", i );
+            Cec4_BatPrintStats( pTh->pBat );
+            printf( "Time = %9.2f sec\n", 1.0*((double)(pTh->clkUsed))/((double)CLOCKS_PER_SEC) );
+        }
+        Cec4_BatStop( pTh->pBat );
+        Vec_IntFree( pTh->vLits );
+        Vec_IntFree( pTh->vEffort );
+    }
+    if ( pPars->fVerbose )
+    {
+        printf( "Parallel sweeping with %d threads in %d waves:  P = %d.  D = %d.  F = %d.  ", nProcs, nWaves, nProved, nDisproved, nUndec );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Gia_ManStop( pQueue->pNew );
+    Vec_IntFree( vPairs );
+    Vec_BitFree( vUndec );
+}
+
+#endif // pthreads are used
+
+
 int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** ppNew, int fSimOnly )
 {
 
@@ -1941,6 +2630,8 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     execute_sat:
     if ( i && i % 5 && pPars->fVerbose )
         Cec4_ManPrintStats( p, pPars, pMan, 1 );
+    if ( pPars->nProcs > 1 && !pPars->fUseCones && !pPars->fBMiterInfo && p->pMuxes == NULL )
+        Cec4_ManSweepMt( p, pMan );
 
     p->iPatsPi = 0;
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
@@ -1989,6 +2680,14 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
                 pMan->iLastConst = i;
             continue;
         }
+        if ( pMan->vProvedMt && Vec_IntEntry(pMan->vProvedMt, i) == id_repr ) // proved by the parallel sweep
+        {
+            pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+            Gia_ObjSetProved( p, i );
+            if ( id_repr == 0 )
+                pMan->iLastConst = i;
+            continue;
+        }
         if ( Cec4_ManSweepNode(pMan, i, Gia_ObjId(p, pRepr)) && Gia_ObjProved(p, i) )
         {
             if (pPars->fBMiterInfo){
@@ -2084,6 +2783,17 @@ Gia_Man_t * Cec4_ManSimulateTest3( Gia_Man_t * p, int nBTLimit, int fVerbose )
     Cec4_ManPerformSweeping( p, pPars, &pNew, 0 );
     return pNew;
 }
+Gia_Man_t * Cec4_ManSimulateTestMt( Gia_Man_t * p, int nBTLimit, int nProcs, int fVerbose )
+{
+    Gia_Man_t * pNew = NULL;
+    Cec_ParFra_t ParsFra, * pPars = &ParsFra;
+    Cec4_ManSetParams( pPars );
+    pPars->fVerbose = fVerbose;
+    pPars->nBTLimit = nBTLimit;
+    pPars->nProcs   = nProcs;
+    Cec4_ManPerformSweeping( p, pPars, &pNew, 0 );
+    return pNew;
+}
 Gia_Man_t * Cec4_ManSimulateTest4( Gia_Man_t * p, int nBTLimit, int nBTLimitPo, int fVerbose )
 {
     Gia_Man_t * pNew = NULL;
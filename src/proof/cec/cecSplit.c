@@ -528,57 +528,400 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Dynamic cube-and-conquer.]
+
+  Description [Each worker owns a queue of cubes (cofactored miters).
+  A worker solves its cube in slices of conflicts. Between the slices,
+  it checks whether some other worker is idle (or whether the cube has
+  been solved longer than the timeout). If so, the cube is split on
+  the next cofactoring variable and the two halves are pushed into
+  the worker's queue, from which the idle workers steal the shallowest
+  cube, while the owner continues with the deepest one. Top-level
+  implications on the primary inputs, learned while solving a cube,
+  are shared with other workers as short clauses (the unit, plus the
+  negation of the cube literals), which are added to the solvers of
+  all cubes compatible with them.]
 
-  Description []
-               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-#define PAR_THR_MAX 100
+#define PAR_THR_MAX          100
+#define CEC_SPLIT_CONF      1000  // the number of conflicts in one slice
+#define CEC_SPLIT_SHARE       10  // the max depth of cubes sharing implications
+
+typedef struct Cec_SplMan_t_ Cec_SplMan_t;
 typedef struct Par_ThData_t_
 {
-    Gia_Man_t * p;
-    Cnf_Dat_t * pCnf;
-    int         iThread;
-    int         nTimeOut;
-    int         fWorking;
-    int         Result;
-    int         nVars;
-    int         nConfs;
+    Cec_SplMan_t * pMan;
+    Vec_Ptr_t *  vQueue;        // cubes owned by this worker
+    Cnf_Man_t *  pCnfMan;       // CNF manager of this worker
+    int          iThread;
+    int          nCubes;        // cubes solved
+    int          nSplits;       // cubes split
+    int          nSteals;       // cubes stolen from other workers
+    int          nShareOut;     // implications exported
+    int          nShareIn;      // clauses imported
+    ABC_INT64_T  nConfs;        // conflicts
+    abctime      clkBusy;       // solving time
 } Par_ThData_t;
+struct Cec_SplMan_t_
+{
+    int          nProcs;
+    int          nTimeOut;
+    int          nIterMax;
+    int          LookAhead;
+    int          fVerbose;
+    int          fVeryVerbose;
+    Par_ThData_t ThData[PAR_THR_MAX];
+    Vec_Int_t *  vShared;       // shared clauses over the PIs: (nLits, Lit0, Lit1, ...)
+    pthread_mutex_t Mutex;      // protects everything below
+    pthread_cond_t Cond;        // signaled when a cube is queued or a worker is done
+    volatile int nQueued;       // the number of cubes in all queues
+    volatile int nBusy;         // the number of workers with a cube
+    volatile int fStop;         // the problem is solved or the limit is reached
+    int          nSplits;       // total case-splits
+    int          nCubes;        // total solved cubes
+    int          RetValue;      // -1 = undecided; 0 = SAT; 1 = UNSAT
+    double       Progress;      // the fraction of the space proved UNSAT
+    Abc_Cex_t *  pCex;
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Takes the next cube for the worker.]
+
+  Description [Takes the deepest cube from the worker's own queue. If
+  the queue is empty, steals the shallowest cube from the longest queue
+  of another worker. Returns NULL if there is nothing to take. Should
+  be called with the mutex locked.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_Man_t * Cec_SplManTakeCube( Cec_SplMan_t * pMan, Par_ThData_t * pThData )
+{
+    Par_ThData_t * pVictim = NULL;
+    Gia_Man_t * pCube;
+    int i;
+    if ( Vec_PtrSize(pThData->vQueue) > 0 )
+        pCube = (Gia_Man_t *)Vec_PtrPop( pThData->vQueue );
+    else
+    {
+        for ( i = 0; i < pMan->nProcs; i++ )
+            if ( Vec_PtrSize(pMan->ThData[i].vQueue) > 0 && (pVictim == NULL || Vec_PtrSize(pVictim->vQueue) < Vec_PtrSize(pMan->ThData[i].vQueue)) )
+                pVictim = pMan->ThData + i;
+        if ( pVictim == NULL )
+            return NULL;
+        pCube = (Gia_Man_t *)Vec_PtrEntry( pVictim->vQueue, 0 );
+        Vec_PtrRemove( pVictim->vQueue, pCube );
+        pThData->nSteals++;
+    }
+    pMan->nQueued--;
+    pMan->nBusy++;
+    return pCube;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Exchanges implications between the cube and other workers.]
+
+  Description [Exports the new top-level assignments of the PIs, starting
+  from the trail position *piTrail. Imports the shared clauses, starting
+  from the position *piShare, after simplifying them using the cube
+  literals (pCubeVals gives the value of each PI fixed by the cube,
+  or -1). Returns 0 if the cube is proved UNSAT by the imported clauses.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_SplManShare( Cec_SplMan_t * pMan, Par_ThData_t * pThData, Gia_Man_t * pCube, Cnf_Dat_t * pCnf, sat_solver * pSat,
+                            Vec_Int_t * vPiVars, int * pCubeVals, int * piTrail, int * piShare, Vec_Int_t * vExport, Vec_Int_t * vImport )
+{
+    Vec_Int_t * vCofVars = pCube->vCofVars;
+    int fShare = Vec_IntSize(vCofVars) <= CEC_SPLIT_SHARE;
+    int i, k, Lit, iPi, nLits, RetValue = 1;
+    // collect the new top-level assignments of the PIs
+    Vec_IntClear( vExport );
+    if ( fShare )
+    for ( ; *piTrail < pSat->qtail; (*piTrail)++ )
+    {
+        Lit = pSat->trail[*piTrail];
+        iPi = Vec_IntEntry( vPiVars, Abc_Lit2Var(Lit) );
+        if ( iPi == -1 )
+            continue;
+        Vec_IntPush( vExport, 1 + Vec_IntSize(vCofVars) );
+        Vec_IntPush( vExport, Abc_Var2Lit(iPi, Abc_LitIsCompl(Lit)) );
+        Vec_IntForEachEntry( vCofVars, Lit, k )
+            Vec_IntPush( vExport, Abc_LitNot(Lit) );
+        pThData->nShareOut++;
+    }
+    // copy the clauses published by others and publish the new ones
+    Vec_IntClear( vImport );
+    pthread_mutex_lock( &pMan->Mutex );
+    for ( i = *piShare; i < Vec_IntSize(pMan->vShared); i++ )
+        Vec_IntPush( vImport, Vec_IntEntry(pMan->vShared, i) );
+    Vec_IntAppend( pMan->vShared, vExport );
+    *piShare = Vec_IntSize(pMan->vShared);
+    pthread_mutex_unlock( &pMan->Mutex );
+    // add the clauses relevant to this cube
+    for ( i = 0; i < Vec_IntSize(vImport); i += nLits + 1 )
+    {
+        int * pLits = Vec_IntEntryP( vImport, i + 1 ), nLitsNew = 0;
+        nLits = Vec_IntEntry( vImport, i );
+        for ( k = 0; k < nLits; k++ )
+        {
+            iPi = Abc_Lit2Var(pLits[k]);
+            if ( pCubeVals[iPi] == -1 )
+            {
+                int iVar = pCnf->pVarNums[Gia_ObjId(pCube, Gia_ManPi(pCube, iPi))];
+                if ( iVar < 0 )
+                    break;
+                pLits[nLitsNew++] = Abc_Var2Lit( iVar, Abc_LitIsCompl(pLits[k]) );
+            }
+            else if ( pCubeVals[iPi] != Abc_LitIsCompl(pLits[k]) ) // the literal is true
+                break;
+        }
+        if ( k < nLits ) // satisfied or not expressible in this cube
+            continue;
+        pThData->nShareIn++;
+        if ( nLitsNew == 0 || !sat_solver_addclause( pSat, pLits, pLits + nLitsNew ) )
+        {
+            RetValue = 0;
+            break;
+        }
+    }
+    if ( RetValue )
+        *piTrail = pSat->qtail;
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the cube into two and queues the halves.]
+
+  Description [Returns 0 if the cube cannot be split.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_SplManSplitCube( Cec_SplMan_t * pMan, Par_ThData_t * pThData, Gia_Man_t * pCube )
+{
+    Gia_Man_t * pParts[2];
+    int i, nFanouts, Cost, iVar;
+    if ( pMan->nIterMax && pMan->nSplits >= pMan->nIterMax )
+        return 0;
+    iVar = Gia_SplitCofVar( pCube, pMan->LookAhead, &nFanouts, &Cost );
+    if ( nFanouts == 0 )
+        return 0;
+    for ( i = 0; i < 2; i++ )
+    {
+        pParts[i] = Gia_ManDupCofactorVar( pCube, iVar, i );
+        pParts[i]->vCofVars = Vec_IntAlloc( Vec_IntSize(pCube->vCofVars) + 1 );
+        Vec_IntAppend( pParts[i]->vCofVars, pCube->vCofVars );
+        Vec_IntPush( pParts[i]->vCofVars, Abc_Var2Lit(iVar, !i) );
+    }
+    pthread_mutex_lock( &pMan->Mutex );
+    if ( pMan->fVeryVerbose )
+        printf( "Thr %2d : Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.  AndAfter = %6d.\n",
+            pThData->iThread, iVar, nFanouts, Cost, Gia_ManAndNum(pCube), Gia_ManAndNum(pParts[0]) );
+    Vec_PtrPush( pThData->vQueue, pParts[0] );
+    Vec_PtrPush( pThData->vQueue, pParts[1] );
+    pMan->nQueued += 2;
+    pMan->nSplits++;
+    pThData->nSplits++;
+    pthread_cond_broadcast( &pMan->Cond );
+    pthread_mutex_unlock( &pMan->Mutex );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one cube.]
+
+  Description [Returns 0 (SAT), 1 (UNSAT), 2 (the cube is split), or
+  -1 (undecided because the computation is stopped).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_SplManSolveCube( Cec_SplMan_t * pMan, Par_ThData_t * pThData, Gia_Man_t * pCube, int * pnVars, int * pnConfs )
+{
+    abctime clk = Abc_Clock();
+    Aig_Man_t * pAig;
+    Cnf_Dat_t * pCnf;
+    sat_solver * pSat;
+    Vec_Int_t * vPiVars, * vExport, * vImport;
+    Gia_Obj_t * pObj;
+    int * pCubeVals;
+    int i, Lit, iVar, fTimeOut, fCanSplit = 1, fSplit = 0, status = l_False, iTrail = 0, iShare = 0;
+    // derive the CNF using the CNF manager of this thread
+    pAig = Gia_ManToAigSimple( pCube );
+    pAig->nRegs = 0;
+    pCnf = Cnf_DeriveWithMan( pThData->pCnfMan, pAig, 0 );
+    Aig_ManStop( pAig );
+    pSat = Cec_GiaDeriveSolver( pCube, pCnf, 0 );
+    *pnVars = *pnConfs = 0;
+    if ( pSat == NULL )
+    {
+        Cnf_DataFree( pCnf );
+        pThData->clkBusy += Abc_Clock() - clk;
+        return 1;
+    }
+    // map the SAT variables into the PIs
+    vPiVars = Vec_IntStartFull( pCnf->nVars );
+    Gia_ManForEachPi( pCube, pObj, i )
+        if ( (iVar = pCnf->pVarNums[Gia_ObjId(pCube, pObj)]) >= 0 )
+            Vec_IntWriteEntry( vPiVars, iVar, i );
+    pCubeVals = ABC_FALLOC( int, Gia_ManPiNum(pCube) );
+    Vec_IntForEachEntry( pCube->vCofVars, Lit, i )
+        pCubeVals[Abc_Lit2Var(Lit)] = !Abc_LitIsCompl(Lit);
+    vExport = Vec_IntAlloc( 100 );
+    vImport = Vec_IntAlloc( 100 );
+    // solve in slices until the cube is solved or split
+    while ( 1 )
+    {
+        if ( !Cec_SplManShare( pMan, pThData, pCube, pCnf, pSat, vPiVars, pCubeVals, &iTrail, &iShare, vExport, vImport ) )
+        {
+            status = l_False;
+            break;
+        }
+        status = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)CEC_SPLIT_CONF, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+        if ( status != l_Undef || pMan->fStop )
+            break;
+        // split when another worker is idle or when the cube takes too long
+        fTimeOut = pMan->nTimeOut && Abc_Clock() - clk >= (abctime)pMan->nTimeOut * CLOCKS_PER_SEC;
+        if ( !fTimeOut && !(pMan->nQueued == 0 && pMan->nBusy < pMan->nProcs) )
+            continue;
+        if ( fCanSplit && (fSplit = Cec_SplManSplitCube( pMan, pThData, pCube )) )
+            break;
+        fCanSplit = 0;
+        if ( fTimeOut && pMan->nIterMax && pMan->nSplits >= pMan->nIterMax )
+        {
+            pthread_mutex_lock( &pMan->Mutex );
+            pMan->fStop = 1;
+            pthread_cond_broadcast( &pMan->Cond );
+            pthread_mutex_unlock( &pMan->Mutex );
+            break;
+        }
+    }
+    *pnVars  = sat_solver_nvars( pSat );
+    *pnConfs = sat_solver_nconflicts( pSat );
+    pThData->nConfs += *pnConfs;
+    if ( status == l_True )
+        pCube->pCexComb = Cec_SplitDeriveModel( pCube, pCnf, pSat );
+    sat_solver_delete( pSat );
+    Cnf_DataFree( pCnf );
+    Vec_IntFree( vPiVars );
+    Vec_IntFree( vExport );
+    Vec_IntFree( vImport );
+    ABC_FREE( pCubeVals );
+    pThData->clkBusy += Abc_Clock() - clk;
+    if ( status == l_Undef )
+        return fSplit ? 2 : -1;
+    if ( status == l_False )
+        return 1;
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 void * Cec_GiaSplitWorkerThread( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
+    Cec_SplMan_t * pMan = pThData->pMan;
+    char * pResults[4] = { "UNDECIDED", "SAT      ", "UNSAT    ", "SPLIT    " };
+    Gia_Man_t * pCube;
+    int Depth, Result, nVars, nConfs;
+    abctime clk;
     while ( 1 )
     {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->p == NULL )
+        pCube = NULL;
+        pthread_mutex_lock( &pMan->Mutex );
+        // wait until another worker splits its cube or all workers are done
+        while ( !pMan->fStop && (pMan->nQueued > 0 || pMan->nBusy > 0) && (pCube = Cec_SplManTakeCube( pMan, pThData )) == NULL )
+            pthread_cond_wait( &pMan->Cond, &pMan->Mutex );
+        if ( pMan->fStop || (pMan->nQueued == 0 && pMan->nBusy == 0) )
         {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
+            pthread_mutex_unlock( &pMan->Mutex );
+            break;
+        }
+        pthread_mutex_unlock( &pMan->Mutex );
+        clk = Abc_Clock();
+        Depth = Vec_IntSize(pCube->vCofVars);
+        Result = Cec_SplManSolveCube( pMan, pThData, pCube, &nVars, &nConfs );
+        pthread_mutex_lock( &pMan->Mutex );
+        if ( Result == 0 || Result == 1 )
+        {
+            pThData->nCubes++;
+            pMan->nCubes++;
         }
-        pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->nVars, &pThData->nConfs );
-        pThData->fWorking = 0;
+        if ( Result == 1 )
+            pMan->Progress += 1.0 / pow((double)2, (double)Depth);
+        if ( pMan->fVerbose )
+        {
+            printf( "Thr %2d : ",         pThData->iThread );
+            printf( "Depth =%3d  ",       Depth );
+            printf( "SatVar =%7d  ",      nVars );
+            printf( "SatConf =%8d   ",    nConfs );
+            printf( "%s   ",              pResults[Result + 1] );
+            printf( "Solved %8.4f %%   ", 100*pMan->Progress );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+            fflush( stdout );
+        }
+        if ( Result == 0 && pMan->pCex == NULL )
+        {
+            pMan->pCex = pCube->pCexComb;  pCube->pCexComb = NULL;
+            pMan->RetValue = 0;
+            pMan->fStop = 1;
+        }
+        pMan->nBusy--;
+        pthread_cond_broadcast( &pMan->Cond );
+        pthread_mutex_unlock( &pMan->Mutex );
+        Gia_ManStop( pCube );
     }
+    pthread_exit( NULL );
     assert( 0 );
     return NULL;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the miter with one output by cube-and-conquer.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
 {
     abctime clkTotal = Abc_Clock();
-    Par_ThData_t ThData[PAR_THR_MAX];
     pthread_t WorkerThread[PAR_THR_MAX];
-    Vec_Ptr_t * vStack;
-    Cnf_Dat_t * pCnf;
-    double Progress = 0;
-    int i, status, nSatVars, nSatConfs;
-    int nIter = 0, RetValue = -1, fWorkToDo = 1;
+    Cec_SplMan_t * pMan;
+    Par_ThData_t * pThData;
+    Gia_Man_t * pCube;
+    int i, k, status, RetValue;
     Abc_CexFreeP( &p->pCexComb );
     if ( fVerbose )
         printf( "Solving CEC problem by cofactoring with the following parameters:\n" );
@@ -587,141 +930,65 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
     fflush( stdout );
     if ( nProcs == 1 )
         return Cec_GiaSplitTest2( p, nProcs, nTimeOut, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
-    // subtract manager thread
-    nProcs--;
     assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
-    // check the problem
-    pCnf = Cec_GiaDeriveGiaRemapped( p );
-    status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, &nSatVars, &nSatConfs );
-    Cnf_DataFree( pCnf );
-    if ( fVerbose && status != -1 )
-        Cec_GiaSplitPrint( 0, 0, nSatVars, nSatConfs, status, Progress, Abc_Clock() - clkTotal );
-    if ( status == 0 )
+    // start the manager
+    pMan = ABC_CALLOC( Cec_SplMan_t, 1 );
+    pMan->nProcs       = nProcs;
+    pMan->nTimeOut     = nTimeOut;
+    pMan->nIterMax     = nIterMax;
+    pMan->LookAhead    = LookAhead;
+    pMan->fVerbose     = fVerbose;
+    pMan->fVeryVerbose = fVeryVerbose;
+    pMan->vShared      = Vec_IntAlloc( 1000 );
+    pMan->RetValue     = -1;
+    status = pthread_mutex_init( &pMan->Mutex, NULL );  assert( status == 0 );
+    status = pthread_cond_init( &pMan->Cond, NULL );    assert( status == 0 );
+    // start the workers' data; the first worker starts with the whole problem
+    for ( i = 0; i < nProcs; i++ )
     {
-        if ( !fSilent )
-        printf( "The problem is SAT without cofactoring.\n" );
-        return 0;
+        pMan->ThData[i].pMan    = pMan;
+        pMan->ThData[i].vQueue  = Vec_PtrAlloc( 100 );
+        pMan->ThData[i].pCnfMan = Cnf_ManStart();
+        pMan->ThData[i].iThread = i;
     }
-    if ( status == 1 )
-    {
-        if ( !fSilent )
-        printf( "The problem is UNSAT without cofactoring.\n" );
-        return 1;
-    }
-    assert( status == -1 );
-    // create local copy
-    vStack = Vec_PtrAlloc( 1000 );
-    Vec_PtrPush( vStack, Gia_ManDup(p) );
-    // start threads
+    pCube = Gia_ManDup( p );
+    pCube->vCofVars = Vec_IntAlloc( 100 );
+    Vec_PtrPush( pMan->ThData[0].vQueue, pCube );
+    pMan->nQueued = 1;
+    // start the workers and wait till they finish
     for ( i = 0; i < nProcs; i++ )
     {
-        ThData[i].p        = NULL;
-        ThData[i].pCnf     = NULL;
-        ThData[i].iThread  = i;
-        ThData[i].nTimeOut = nTimeOut;
-        ThData[i].fWorking = 0;
-        ThData[i].Result   = -1;
-        ThData[i].nVars    = -1;
-        ThData[i].nConfs   = -1;
-        status = pthread_create( WorkerThread + i, NULL,Cec_GiaSplitWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        status = pthread_create( WorkerThread + i, NULL, Cec_GiaSplitWorkerThread, (void *)(pMan->ThData + i) );
+        assert( status == 0 );
     }
-    // look at the threads
-    while ( fWorkToDo )
+    for ( i = 0; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    // collect the result
+    RetValue = pMan->RetValue;
+    if ( RetValue == -1 && pMan->nQueued == 0 && !pMan->fStop )
+        RetValue = 1;
+    p->pCexComb = pMan->pCex;
+    if ( fVerbose )
     {
-        fWorkToDo = (int)(Vec_PtrSize(vStack) > 0);
+        printf( "Thread  Cubes  Splits  Steals  ShareOut  ShareIn     Conflicts    Busy\n" );
         for ( i = 0; i < nProcs; i++ )
         {
-            // check if this thread is working
-            if ( ThData[i].fWorking )
-            {
-                fWorkToDo = 1;
-                continue;
-            }
-            // check if this thread has recently finished
-            if ( ThData[i].p != NULL )
-            {
-                Gia_Man_t * pLast = ThData[i].p;
-                int Depth = pLast->vCofVars ? Vec_IntSize(pLast->vCofVars) : 0;
-                if ( pLast->vCofVars == NULL )
-                    pLast->vCofVars = Vec_IntAlloc( 100 );
-                if ( fVerbose )
-                    Cec_GiaSplitPrint( i+1, Depth, ThData[i].nVars, ThData[i].nConfs, ThData[i].Result, Progress, Abc_Clock() - clkTotal );
-                if ( ThData[i].Result == 0 ) // SAT
-                {
-                    p->pCexComb = pLast->pCexComb;  pLast->pCexComb = NULL;
-                    RetValue = 0;
-                    goto finish;
-                }
-                if ( ThData[i].Result == -1 ) // UNDEC
-                {
-                    // determine cofactoring variable
-                    int nFanouts, Cost, iVar = Gia_SplitCofVar( pLast, LookAhead, &nFanouts, &Cost );
-                    // cofactor
-                    Gia_Man_t * pPart = Gia_ManDupCofactorVar( pLast, iVar, 0 );
-                    pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
-                    Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
-                    Vec_PtrPush( vStack, pPart );
-                    // print results
-                    if ( fVeryVerbose )
-                    {
-//                        Cec_GiaSplitPrintRefs( pLast );
-                        printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.  AndAfter = %6d.\n", 
-                            iVar, nFanouts, Cost, Gia_ManAndNum(pLast), Gia_ManAndNum(pPart) );
-//                        Cec_GiaSplitPrintRefs( pPart );
-                    }
-                    // cofactor
-                    pPart = Gia_ManDupCofactorVar( pLast, iVar, 1 );
-                    pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
-                    Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
-                    Vec_PtrPush( vStack, pPart );
-                    // keep working
-                    fWorkToDo = 1;
-                    nIter++;
-                }
-                else
-                    Progress += 1.0 / pow((double)2, (double)Depth);
-                Gia_ManStopP( &ThData[i].p );
-                if ( ThData[i].pCnf == NULL )
-                    continue;
-                Cnf_DataFree( ThData[i].pCnf );
-                ThData[i].pCnf = NULL;
-            }
-            if ( Vec_PtrSize(vStack) == 0 )
-                continue;
-            // start a new thread
-            assert( ThData[i].p == NULL );
-            ThData[i].p = (Gia_Man_t*)Vec_PtrPop( vStack );
-            ThData[i].pCnf = Cec_GiaDeriveGiaRemapped( ThData[i].p );
-            ThData[i].fWorking = 1;
+            pThData = pMan->ThData + i;
+            printf( "%6d %6d %7d %7d %9d %8d %13.0f %6.2f %%\n", i, pThData->nCubes, pThData->nSplits, pThData->nSteals,
+                pThData->nShareOut, pThData->nShareIn, (double)pThData->nConfs, 100.0 * pThData->clkBusy / Abc_MaxInt(1, Abc_Clock() - clkTotal) );
         }
-        if ( nIterMax && nIter >= nIterMax )
-            break;
     }
-    if ( !fWorkToDo )
-        RetValue = 1;
-finish:
-    // wait till threads finish
-    for ( i = 0; i < nProcs; i++ )
-        if ( ThData[i].fWorking )
-            i = -1;
-    // stop threads
+    // cleanup
     for ( i = 0; i < nProcs; i++ )
     {
-        assert( !ThData[i].fWorking );
-        // cleanup
-        Gia_ManStopP( &ThData[i].p );
-        if ( ThData[i].pCnf == NULL )
-            continue;
-        Cnf_DataFree( ThData[i].pCnf );
-        ThData[i].pCnf = NULL;
-        // stop
-        ThData[i].p = NULL;
-        ThData[i].fWorking = 1;
+        Vec_PtrForEachEntry( Gia_Man_t *, pMan->ThData[i].vQueue, pCube, k )
+            Gia_ManStop( pCube );
+        Vec_PtrFree( pMan->ThData[i].vQueue );
+        Cnf_ManStop( pMan->ThData[i].pCnfMan );
     }
-    // finish
-    Cec_GiaSplitClean( vStack );
+    pthread_cond_destroy( &pMan->Cond );
+    pthread_mutex_destroy( &pMan->Mutex );
+    Vec_IntFree( pMan->vShared );
     if ( !fSilent )
     {
         if ( RetValue == 0 )
@@ -731,10 +998,11 @@ finish:
         else if ( RetValue == -1 )
             printf( "Problem is UNDECIDED " );
         else assert( 0 );
-        printf( "after %d case-splits.  ", nIter );
+        printf( "after %d case-splits.  ", pMan->nSplits );
         Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
         fflush( stdout );
     }
+    ABC_FREE( pMan );
     return RetValue;
 }
 int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
@@ -750,7 +1018,6 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
         if ( fVerbose )
             printf( "\nSolving output %d:\n", i );
         RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead,  fVerbose, fVeryVerbose, fSilent );
-        Gia_ManStop( pOne );
         // collect the result
         if ( RetValue1 == 0 && RetValue == -1 )
         {
@@ -758,6 +1025,7 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
             pCex->iPo = i;
             RetValue = 0;
         }
+        Gia_ManStop( pOne );
         if ( RetValue1 == -1 )
             fOneUndef = 1;
     }
@@ -56,6 +56,7 @@ struct Dch_Pars_t_
     int              fUseNew2;      // uses new implementation
     int              fLightSynth;   // uses lighter version of synthesis
     int              fSkipRedSupp;  // skip choices with redundant support vars
+    int              nProcs;        // the number of threads
     int              fVerbose;      // verbose stats
     abctime          timeSynth;     // synthesis runtime
     int              nNodesAhead;   // the lookahead in terms of nodes
@@ -54,6 +54,7 @@ void Dch_ManSetDefaultParams( Dch_Pars_t * p )
     p->fPower         =     0;  // power-aware rewriting
     p->fLightSynth    =     0;  // uses lighter version of synthesis
     p->fSkipRedSupp   =     0;  // skips choices with redundant structural support
+    p->nProcs         =     1;  // the number of threads
     p->fVerbose       =     0;  // verbose stats
     p->nNodesAhead    =  1000;  // the lookahead in terms of nodes
     p->nCallsRecycle  =   100;  // calls to perform before recycling SAT solver
@@ -97,12 +98,15 @@ Aig_Man_t * Dch_ComputeChoices( Aig_Man_t * pAig, Dch_Pars_t * pPars )
     p = Dch_ManCreate( pAig, pPars );
     // compute candidate equivalence classes
 clk = Abc_Clock(); 
-    p->ppClasses = Dch_CreateCandEquivClasses( pAig, pPars->nWords, pPars->fVerbose );
+    p->ppClasses = Dch_CreateCandEquivClasses( pAig, pPars->nWords, pPars->nProcs, pPars->fVerbose );
 p->timeSimInit = Abc_Clock() - clk;
 //    Dch_ClassesPrint( p->ppClasses, 0 );
     p->nLits = Dch_ClassesLitNum( p->ppClasses );
     // perform SAT sweeping
-    Dch_ManSweep( p );
+    if ( pPars->nProcs > 1 )
+        Dch_ManSweepPar( p );
+    else
+        Dch_ManSweep( p );
     // free memory ahead of time
 p->timeTotal = Abc_Clock() - clkTotal;
     Dch_ManStop( p );
@@ -143,12 +147,15 @@ void Dch_ComputeEquivalences( Aig_Man_t * pAig, Dch_Pars_t * pPars )
     p = Dch_ManCreate( pAig, pPars );
     // compute candidate equivalence classes
 clk = Abc_Clock(); 
-    p->ppClasses = Dch_CreateCandEquivClasses( pAig, pPars->nWords, pPars->fVerbose );
+    p->ppClasses = Dch_CreateCandEquivClasses( pAig, pPars->nWords, pPars->nProcs, pPars->fVerbose );
 p->timeSimInit = Abc_Clock() - clk;
 //    Dch_ClassesPrint( p->ppClasses, 0 );
     p->nLits = Dch_ClassesLitNum( p->ppClasses );
     // perform SAT sweeping
-    Dch_ManSweep( p );
+    if ( pPars->nProcs > 1 )
+        Dch_ManSweepPar( p );
+    else
+        Dch_ManSweep( p );
     // free memory ahead of time
 p->timeTotal = Abc_Clock() - clkTotal;
     Dch_ManStop( p );
@@ -69,6 +69,7 @@ struct Dch_Man_t_
     Vec_Ptr_t *      vFanins;        // fanins of the CNF node
     Vec_Ptr_t *      vSimRoots;      // the roots of cand const 1 nodes to simulate
     Vec_Ptr_t *      vSimClasses;    // the roots of cand equiv classes to simulate
+    Vec_Int_t *      vCexVals;       // CI values of the counter-example being replayed (or NULL)
     // solver cone size
     int              nConeThis;
     int              nConeMax;
@@ -78,6 +79,8 @@ struct Dch_Man_t_
     int              nSatFailsReal;  // the number of timeouts
     int              nSatCallsUnsat; // the number of unsat SAT calls
     int              nSatCallsSat;   // the number of sat SAT calls
+    int              nBatches;       // the number of node batches solved by the threads
+    int              nResolved;      // the number of pairs solved again by the main thread
     // choice node statistics
     int              nLits;          // the number of lits in the cand equiv classes
     int              nReprs;         // the number of proved equivalent pairs
@@ -146,15 +149,19 @@ extern void          Dch_CnfNodeAddToSolver( Dch_Man_t * p, Aig_Obj_t * pObj );
 extern Dch_Man_t *   Dch_ManCreate( Aig_Man_t * pAig, Dch_Pars_t * pPars );
 extern void          Dch_ManStop( Dch_Man_t * p );
 extern void          Dch_ManSatSolverRecycle( Dch_Man_t * p );
+extern Dch_Man_t *   Dch_ManCreateThread( Dch_Man_t * p );
+extern void          Dch_ManStopThread( Dch_Man_t * p, Dch_Man_t * pThr );
 /*=== dchSat.c ===================================================*/
 extern int           Dch_NodesAreEquiv( Dch_Man_t * p, Aig_Obj_t * pObj1, Aig_Obj_t * pObj2 );
+extern void          Dch_ManSaveCex( Dch_Man_t * p, Vec_Int_t * vCex );
 /*=== dchSim.c ===================================================*/
-extern Dch_Cla_t *   Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, int fVerbose );
+extern Dch_Cla_t *   Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, int nProcs, int fVerbose );
 /*=== dchSimSat.c ===================================================*/
 extern void          Dch_ManResimulateCex( Dch_Man_t * p, Aig_Obj_t * pObj, Aig_Obj_t * pRepr );
 extern void          Dch_ManResimulateCex2( Dch_Man_t * p, Aig_Obj_t * pObj, Aig_Obj_t * pRepr );
 /*=== dchSweep.c ===================================================*/
 extern void          Dch_ManSweep( Dch_Man_t * p );
+extern void          Dch_ManSweepPar( Dch_Man_t * p );
 
 
 
@@ -53,7 +53,8 @@ Dch_Man_t * Dch_ManCreate( Aig_Man_t * pAig, Dch_Pars_t * pPars )
     Aig_ManFanoutStart( p->pAigTotal );
     // SAT solving
     p->nSatVars     = 1;
-    p->pSatVars     = ABC_CALLOC( int, Aig_ManObjNumMax(p->pAigTotal) );
+    // (with several threads, a fraiged node can be derived before and after merging)
+    p->pSatVars     = ABC_CALLOC( int, (pPars->nProcs > 1 ? 2 : 1) * Aig_ManObjNumMax(p->pAigTotal) );
     p->vUsedNodes   = Vec_PtrAlloc( 1000 );
     p->vFanins      = Vec_PtrAlloc( 100 );
     p->vSimRoots    = Vec_PtrAlloc( 1000 );
@@ -89,6 +90,9 @@ void Dch_ManPrintStats( Dch_Man_t * p )
     Abc_Print( 1, "SAT calls : All = %6d. Unsat = %6d. Sat = %6d. Fail = %6d.\n", 
         p->nSatCalls, p->nSatCalls-p->nSatCallsSat-p->nSatFailsReal, 
         p->nSatCallsSat, p->nSatFailsReal );
+    if ( p->pPars->nProcs > 1 )
+    Abc_Print( 1, "Threads   : Procs = %6d. Batches = %6d. Solved again = %6d.\n", 
+        p->pPars->nProcs, p->nBatches, p->nResolved );
     Abc_Print( 1, "Choices   : Lits = %6d. Reprs = %5d. Equivs = %5d. Choices = %5d.\n", 
         p->nLits, p->nReprs, p->nEquivs, p->nChoices );
     Abc_Print( 1, "Choicing runtime statistics:\n" );
@@ -139,6 +143,64 @@ void Dch_ManStop( Dch_Man_t * p )
     ABC_FREE( p );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Creates the manager of a worker thread.]
+
+  Description [The thread manager shares the AIGs and the parameters 
+  with the main manager and owns the SAT solver and its variable map.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Dch_Man_t * Dch_ManCreateThread( Dch_Man_t * p )
+{
+    Dch_Man_t * pThr;
+    pThr = ABC_ALLOC( Dch_Man_t, 1 );
+    memset( pThr, 0, sizeof(Dch_Man_t) );
+    pThr->pPars      = p->pPars;
+    pThr->pAigTotal  = p->pAigTotal;
+    pThr->pAigFraig  = p->pAigFraig;
+    pThr->nSatVars   = 1;
+    pThr->pSatVars   = ABC_CALLOC( int, 2 * Aig_ManObjNumMax(p->pAigTotal) );
+    pThr->vUsedNodes = Vec_PtrAlloc( 1000 );
+    pThr->vFanins    = Vec_PtrAlloc( 100 );
+    return pThr;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Frees the manager of a worker thread.]
+
+  Description [Adds the SAT statistics of the thread to the main manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ManStopThread( Dch_Man_t * p, Dch_Man_t * pThr )
+{
+    p->nSatCalls      += pThr->nSatCalls;
+    p->nSatProof      += pThr->nSatProof;
+    p->nSatFailsReal  += pThr->nSatFailsReal;
+    p->nSatCallsUnsat += pThr->nSatCallsUnsat;
+    p->nSatCallsSat   += pThr->nSatCallsSat;
+    p->nRecycles      += pThr->nRecycles;
+    p->timeSat        += pThr->timeSat;
+    p->timeSatSat     += pThr->timeSatSat;
+    p->timeSatUnsat   += pThr->timeSatUnsat;
+    p->timeSatUndec   += pThr->timeSatUndec;
+    if ( pThr->pSat )
+        sat_solver_delete( pThr->pSat );
+    Vec_PtrFree( pThr->vUsedNodes );
+    Vec_PtrFree( pThr->vFanins );
+    ABC_FREE( pThr->pSatVars );
+    ABC_FREE( pThr );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Recycles the SAT solver.]
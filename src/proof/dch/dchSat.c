@@ -157,6 +157,30 @@ p->timeSatUndec += Abc_Clock() - clk;
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Saves the counter-example after a satisfiable call.]
+
+  Description [Collects the CI numbers of the combinational inputs that 
+  have SAT variables and are assigned to 1 by the current satisfying 
+  assignment. The remaining inputs are assumed to be 0, which is how 
+  Dch_ManResimulateCex() treats the inputs without SAT variables.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ManSaveCex( Dch_Man_t * p, Vec_Int_t * vCex )
+{
+    Aig_Obj_t * pObj;
+    int i;
+    Vec_IntClear( vCex );
+    Vec_PtrForEachEntry( Aig_Obj_t *, p->vUsedNodes, pObj, i )
+        if ( Aig_ObjIsCi(pObj) && sat_solver_var_value( p->pSat, Dch_ObjSatNum(p, pObj) ) )
+            Vec_IntPush( vCex, Aig_ObjCioId(pObj) );
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
@@ -20,6 +20,16 @@
 
 #include "dchInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -189,7 +199,7 @@ int Dch_NodesAreEqual( void * p, Aig_Obj_t * pObj0, Aig_Obj_t * pObj1 )
 
 /**Function*************************************************************
 
-  Synopsis    [Perform random simulation.]
+  Synopsis    [Assigns random sim info to the CIs.]
 
   Description []
                
@@ -198,9 +208,9 @@ int Dch_NodesAreEqual( void * p, Aig_Obj_t * pObj0, Aig_Obj_t * pObj1 )
   SeeAlso     []
 
 ***********************************************************************/
-void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
+void Dch_AssignRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
 {
-    unsigned * pSim, * pSim0, * pSim1;
+    unsigned * pSim;
     Aig_Obj_t * pObj;
     int i, k, nWords;
     nWords = (unsigned *)Vec_PtrEntry(vSims, 1) - (unsigned *)Vec_PtrEntry(vSims, 0);
@@ -218,6 +228,26 @@ void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
             pSim[k] = Dch_ObjRandomSim();
         pSim[0] <<= 1;
     }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the internal nodes.]
+
+  Description [Assumes that the CI sim info is assigned. Does not change 
+  the AIG, so several sim info arrays can be simulated concurrently.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_SimulateNodes( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
+{
+    unsigned * pSim, * pSim0, * pSim1;
+    Aig_Obj_t * pObj;
+    int i, k, nWords;
+    nWords = (unsigned *)Vec_PtrEntry(vSims, 1) - (unsigned *)Vec_PtrEntry(vSims, 0);
 
     // simulate AIG in the topological order
     Aig_ManForEachNode( pAig, pObj, i )
@@ -252,7 +282,7 @@ void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
 
 /**Function*************************************************************
 
-  Synopsis    [Derives candidate equivalence classes of AIG nodes.]
+  Synopsis    [Perform random simulation.]
 
   Description []
                
@@ -261,28 +291,121 @@ void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
   SeeAlso     []
 
 ***********************************************************************/
-Dch_Cla_t * Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, int fVerbose )
+void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
+{
+    Dch_AssignRandomSimulation( pAig, vSims );
+    Dch_SimulateNodes( pAig, vSims );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates several rounds of random patterns concurrently.]
+
+  Description [The random CI patterns are assigned to the rounds one after 
+  another in the main thread, so the random numbers are drawn in the same 
+  order as in the serial case. Then each round is simulated by its own 
+  thread. The classes are refined by the caller in the order of rounds, 
+  so the result is the same as with one thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void Dch_PerformRandomSimulationPar( Aig_Man_t * pAig, Vec_Ptr_t ** pvSims, int nRounds )
+{
+    int r;
+    for ( r = 0; r < nRounds; r++ )
+        Dch_PerformRandomSimulation( pAig, pvSims[r] );
+}
+
+#else // pthreads are used
+
+#define DCH_SIM_THR_MAX  8
+
+typedef struct Dch_SimThr_t_ Dch_SimThr_t;
+struct Dch_SimThr_t_
+{
+    Aig_Man_t *      pAig;           // the AIG
+    Vec_Ptr_t *      vSims;          // the sim info of one round
+};
+
+void * Dch_SimulateNodesWorker( void * pArg )
+{
+    Dch_SimThr_t * pThr = (Dch_SimThr_t *)pArg;
+    Dch_SimulateNodes( pThr->pAig, pThr->vSims );
+    return NULL;
+}
+void Dch_PerformRandomSimulationPar( Aig_Man_t * pAig, Vec_Ptr_t ** pvSims, int nRounds )
+{
+    Dch_SimThr_t ThData[DCH_SIM_THR_MAX];
+    pthread_t WorkerThread[DCH_SIM_THR_MAX];
+    int r, status;
+    assert( nRounds <= DCH_SIM_THR_MAX );
+    for ( r = 0; r < nRounds; r++ )
+        Dch_AssignRandomSimulation( pAig, pvSims[r] );
+    for ( r = 1; r < nRounds; r++ )
+    {
+        ThData[r].pAig  = pAig;
+        ThData[r].vSims = pvSims[r];
+        status = pthread_create( WorkerThread + r, NULL, Dch_SimulateNodesWorker, (void *)(ThData + r) );  
+        assert( status == 0 );
+    }
+    Dch_SimulateNodes( pAig, pvSims[0] );
+    for ( r = 1; r < nRounds; r++ )
+    {
+        status = pthread_join( WorkerThread[r], NULL );  
+        assert( status == 0 );
+    }
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Derives candidate equivalence classes of AIG nodes.]
+
+  Description [With several threads, simulates up to nProcs rounds of 
+  random patterns at the same time and refines the classes using them 
+  in the original order, which gives the same classes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Dch_Cla_t * Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, int nProcs, int fVerbose )
 {
     Dch_Cla_t * pClasses;
-    Vec_Ptr_t * vSims;
-    int i;
+    Vec_Ptr_t * pvSims[8];
+    int i, r, nRounds = Abc_MaxInt( 1, Abc_MinInt(nProcs, 8) );
     // allocate simulation information
-    vSims = Vec_PtrAllocSimInfo( Aig_ManObjNumMax(pAig), nWords );
-    // run random simulation from the primary inputs
-    Dch_PerformRandomSimulation( pAig, vSims );
+    for ( r = 0; r < nRounds; r++ )
+        pvSims[r] = Vec_PtrAllocSimInfo( Aig_ManObjNumMax(pAig), nWords );
     // start storage for equivalence classes
     pClasses = Dch_ClassesStart( pAig );
-    Dch_ClassesSetData( pClasses, vSims, Dch_NodeHash, Dch_NodeIsConst, Dch_NodesAreEqual );
-    // hash nodes by sim info
-    Dch_ClassesPrepare( pClasses, 0, 0 );
-    // iterate random simulation
-    for ( i = 0; i < 7; i++ )
+    // run 8 rounds of random simulation from the primary inputs, 
+    // hash nodes by sim info after the first one and refine after the others
+    for ( i = 0; i < 8; i += nRounds )
     {
-        Dch_PerformRandomSimulation( pAig, vSims );
-        Dch_ClassesRefine( pClasses );
+        if ( nRounds > 1 )
+            Dch_PerformRandomSimulationPar( pAig, pvSims, Abc_MinInt(nRounds, 8 - i) );
+        else
+            Dch_PerformRandomSimulation( pAig, pvSims[0] );
+        for ( r = 0; r < nRounds && i + r < 8; r++ )
+        {
+            Dch_ClassesSetData( pClasses, pvSims[r], Dch_NodeHash, Dch_NodeIsConst, Dch_NodesAreEqual );
+            if ( i + r == 0 )
+                Dch_ClassesPrepare( pClasses, 0, 0 );
+            else
+                Dch_ClassesRefine( pClasses );
+        }
     }
     // clean up and return
-    Vec_PtrFree( vSims );
+    for ( r = 0; r < nRounds; r++ )
+        Vec_PtrFree( pvSims[r] );
     // prepare class refinement procedures
     Dch_ClassesSetData( pClasses, NULL, NULL, Dch_NodeIsConstCex, Dch_NodesAreEqualCex );
     return pClasses;
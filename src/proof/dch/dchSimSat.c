@@ -117,6 +117,12 @@ void Dch_ManResimulateSolved_rec( Dch_Man_t * p, Aig_Obj_t * pObj )
     {
         Aig_Obj_t * pObjFraig;
         int nVarNum;
+        // replay the counter-example saved by a worker thread
+        if ( p->vCexVals )
+        {
+            pObj->fMarkB = Vec_IntEntry( p->vCexVals, Aig_ObjCioId(pObj) );
+            return;
+        }
         pObjFraig = Dch_ObjFraig( pObj );
         assert( !Aig_IsComplement(pObjFraig) );
         nVarNum = Dch_ObjSatNum( p, pObjFraig );
@@ -21,6 +21,16 @@
 #include "dchInt.h"
 #include "misc/bar/bar.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -137,6 +147,248 @@ void Dch_ManSweep( Dch_Man_t * p )
     Aig_ManCleanMarkB( p->pAigTotal );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs fraiging for the internal nodes using several threads.]
+
+  Description [Visits the nodes in the same topological order as 
+  Dch_ManSweep() but in batches. For each batch, the fraiged nodes are 
+  derived first and the candidate pairs that need SAT calls are collected. 
+  The pairs are solved by the threads, each owning a SAT solver, and the 
+  pair number k is always given to the thread (k % nProcs), so that the 
+  result does not depend on timing. The results are then applied to the 
+  nodes in the topological order by the main thread, which rederives the 
+  fraiged nodes on top of the merged fanins: counter-examples are replayed 
+  to refine the classes, and the pairs whose representatives have changed 
+  in the meantime, or that timed out before the merging, are solved again 
+  by the solver of the main thread. 
+  Only proved equivalences are recorded, so the choices are correct 
+  regardless of how the nodes are batched.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void Dch_ManSweepPar( Dch_Man_t * p )
+{
+    Dch_ManSweep( p );
+}
+
+#else // pthreads are used
+
+#define DCH_PAR_THR_MAX  100
+#define DCH_PAR_PAIRS    256  // the min number of pairs in one batch
+
+typedef struct Dch_ParMan_t_ Dch_ParMan_t;
+struct Dch_ParMan_t_
+{
+    int              nProcs;         // the number of threads
+    Vec_Ptr_t *      vReprs;         // the representatives of the pairs
+    Vec_Ptr_t *      vPairs;         // the fraiged nodes of the pairs
+    Vec_Int_t *      vStatus;        // the results of the SAT calls
+    Vec_Wec_t *      vCexes;         // the counter-examples of the disproved pairs
+};
+
+typedef struct Dch_ParThr_t_ Dch_ParThr_t;
+struct Dch_ParThr_t_
+{
+    Dch_ParMan_t *   pPar;           // the shared data
+    Dch_Man_t *      pMan;           // the manager of the thread
+    int              iThread;        // the thread number
+};
+
+int Dch_ManSweepAddPair( Dch_Man_t * p, Dch_ParMan_t * pPar, Aig_Obj_t * pObj )
+{
+    Aig_Obj_t * pObjRepr = Aig_ObjRepr( p->pAigTotal, pObj );
+    if ( pObjRepr == NULL || Dch_ObjFraig(pObjRepr) == NULL )
+        return -1;
+    if ( Aig_Regular(Dch_ObjFraig(pObj)) == Aig_Regular(Dch_ObjFraig(pObjRepr)) )
+        return -1;
+    assert( Aig_Regular(Dch_ObjFraig(pObj)) != Aig_ManConst1(p->pAigFraig) );
+    Vec_PtrPush( pPar->vReprs, pObjRepr );
+    Vec_PtrPush( pPar->vPairs, Aig_Regular(Dch_ObjFraig(pObjRepr)) );
+    Vec_PtrPush( pPar->vPairs, Aig_Regular(Dch_ObjFraig(pObj)) );
+    return Vec_PtrSize(pPar->vReprs) - 1;
+}
+void * Dch_ManSweepWorker( void * pArg )
+{
+    Dch_ParThr_t * pThr = (Dch_ParThr_t *)pArg;
+    Dch_ParMan_t * pPar = pThr->pPar;
+    int k, RetValue;
+    for ( k = pThr->iThread; k < Vec_PtrSize(pPar->vReprs); k += pPar->nProcs )
+    {
+        RetValue = Dch_NodesAreEquiv( pThr->pMan, (Aig_Obj_t *)Vec_PtrEntry(pPar->vPairs, 2*k), (Aig_Obj_t *)Vec_PtrEntry(pPar->vPairs, 2*k+1) );
+        Vec_IntWriteEntry( pPar->vStatus, k, RetValue );
+        if ( RetValue == 0 )
+            Dch_ManSaveCex( pThr->pMan, Vec_WecEntry(pPar->vCexes, k) );
+    }
+    return NULL;
+}
+void Dch_ManSweepCommit( Dch_Man_t * p, Dch_ParMan_t * pPar, Aig_Obj_t * pObj, int iPair, Vec_Int_t * vCexVals )
+{
+    Aig_Obj_t * pObjRepr, * pObjNew;
+    Vec_Int_t * vCex;
+    int i, iCi, RetValue, fChanged;
+    // skip the node if a fanin was dropped after a timeout
+    if ( Dch_ObjFraig(Aig_ObjFanin0(pObj)) == NULL || 
+         Dch_ObjFraig(Aig_ObjFanin1(pObj)) == NULL )
+    {
+        Dch_ObjSetFraig( pObj, NULL );
+        return;
+    }
+    // rederive the fraiged node because the fanins may have been merged
+    pObjNew = Aig_And( p->pAigFraig, Dch_ObjChild0Fra(pObj), Dch_ObjChild1Fra(pObj) );
+    fChanged = (pObjNew != Dch_ObjFraig(pObj));
+    Dch_ObjSetFraig( pObj, pObjNew );
+    // handle the node as usual if the pair was not solved or is out of date
+    pObjRepr = Aig_ObjRepr( p->pAigTotal, pObj );
+    if ( iPair == -1 || pObjRepr != Vec_PtrEntry(pPar->vReprs, iPair) || Dch_ObjFraig(pObjRepr) == NULL )
+    {
+        p->nResolved += (iPair >= 0);
+        Dch_ManSweepNode( p, pObj );
+        return;
+    }
+    RetValue = Vec_IntEntry( pPar->vStatus, iPair );
+    if ( RetValue == -1 ) // timed out
+    {
+        // the problem may be easier for the new fraiged node
+        if ( fChanged )
+        {
+            p->nResolved++;
+            Dch_ManSweepNode( p, pObj );
+        }
+        else
+            Dch_ObjSetFraig( pObj, NULL );
+        return;
+    }
+    if ( RetValue == 1 )  // proved equivalent
+    {
+        Dch_ObjSetFraig( pObj, Aig_NotCond( Dch_ObjFraig(pObjRepr), pObj->fPhase ^ pObjRepr->fPhase ) );
+        p->pReprsProved[ pObj->Id ] = pObjRepr;
+        return;
+    }
+    // disproved the equivalence - replay the counter-example of the thread
+    vCex = Vec_WecEntry( pPar->vCexes, iPair );
+    Vec_IntForEachEntry( vCex, iCi, i )
+        Vec_IntWriteEntry( vCexVals, iCi, 1 );
+    p->vCexVals = vCexVals;
+    if ( p->pPars->fSimulateTfo )
+        Dch_ManResimulateCex( p, pObj, pObjRepr );
+    else
+        Dch_ManResimulateCex2( p, pObj, pObjRepr );
+    p->vCexVals = NULL;
+    Vec_IntForEachEntry( vCex, iCi, i )
+        Vec_IntWriteEntry( vCexVals, iCi, 0 );
+    assert( Aig_ObjRepr( p->pAigTotal, pObj ) != pObjRepr );
+}
+void Dch_ManSweepPar( Dch_Man_t * p )
+{
+    Dch_ParMan_t Par, * pPar = &Par;
+    Dch_ParThr_t ThData[DCH_PAR_THR_MAX];
+    pthread_t WorkerThread[DCH_PAR_THR_MAX];
+    Bar_Progress_t * pProgress = NULL;
+    Vec_Ptr_t * vBatch;
+    Vec_Int_t * vPairIds, * vCexVals;
+    Aig_Obj_t * pObj, * pObjNew;
+    int i, k, status, iObj = 0;
+    int nProcs = Abc_MinInt( p->pPars->nProcs, DCH_PAR_THR_MAX );
+    int nPairsMax = Abc_MaxInt( DCH_PAR_PAIRS, 32 * nProcs );
+    // map constants and PIs
+    p->pAigFraig = Aig_ManStart( Aig_ManObjNumMax(p->pAigTotal) );
+    Aig_ManCleanData( p->pAigTotal );
+    Aig_ManConst1(p->pAigTotal)->pData = Aig_ManConst1(p->pAigFraig);
+    Aig_ManForEachCi( p->pAigTotal, pObj, i )
+        pObj->pData = Aig_ObjCreateCi( p->pAigFraig );
+    // the counter-examples refer to the CIs by their numbers
+    Aig_ManSetCioIds( p->pAigTotal );
+    Aig_ManSetCioIds( p->pAigFraig );
+    // start the threads' data
+    pPar->nProcs  = nProcs;
+    pPar->vReprs  = Vec_PtrAlloc( nPairsMax );
+    pPar->vPairs  = Vec_PtrAlloc( 2 * nPairsMax );
+    pPar->vStatus = Vec_IntAlloc( nPairsMax );
+    pPar->vCexes  = Vec_WecStart( nPairsMax );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pPar    = pPar;
+        ThData[i].pMan    = Dch_ManCreateThread( p );
+        ThData[i].iThread = i;
+    }
+    vBatch   = Vec_PtrAlloc( 1000 );
+    vPairIds = Vec_IntAlloc( 1000 );
+    vCexVals = Vec_IntStart( Aig_ManCiNum(p->pAigTotal) );
+    // sweep internal nodes
+    pProgress = Bar_ProgressStart( stdout, Aig_ManObjNumMax(p->pAigTotal) );
+    while ( iObj < Aig_ManObjNumMax(p->pAigTotal) )
+    {
+        // derive the fraiged nodes of the batch and collect the pairs
+        Vec_PtrClear( vBatch );
+        Vec_IntClear( vPairIds );
+        Vec_PtrClear( pPar->vReprs );
+        Vec_PtrClear( pPar->vPairs );
+        for ( ; iObj < Aig_ManObjNumMax(p->pAigTotal) && Vec_PtrSize(pPar->vReprs) < nPairsMax; iObj++ )
+        {
+            pObj = Aig_ManObj( p->pAigTotal, iObj );
+            if ( pObj == NULL || !Aig_ObjIsNode(pObj) )
+                continue;
+            if ( Dch_ObjFraig(Aig_ObjFanin0(pObj)) == NULL || 
+                 Dch_ObjFraig(Aig_ObjFanin1(pObj)) == NULL )
+                continue;
+            pObjNew = Aig_And( p->pAigFraig, Dch_ObjChild0Fra(pObj), Dch_ObjChild1Fra(pObj) );
+            if ( pObjNew == NULL )
+                continue;
+            Dch_ObjSetFraig( pObj, pObjNew );
+            Vec_PtrPush( vBatch, pObj );
+            Vec_IntPush( vPairIds, Dch_ManSweepAddPair(p, pPar, pObj) );
+        }
+        Bar_ProgressUpdate( pProgress, iObj, NULL );
+        // solve the pairs
+        if ( Vec_PtrSize(pPar->vReprs) > 0 )
+        {
+            Vec_IntFill( pPar->vStatus, Vec_PtrSize(pPar->vReprs), -1 );
+            for ( k = 1; k < nProcs; k++ )
+            {
+                status = pthread_create( WorkerThread + k, NULL, Dch_ManSweepWorker, (void *)(ThData + k) );  
+                assert( status == 0 );
+            }
+            Dch_ManSweepWorker( ThData );
+            for ( k = 1; k < nProcs; k++ )
+            {
+                status = pthread_join( WorkerThread[k], NULL );  
+                assert( status == 0 );
+            }
+            p->nBatches++;
+        }
+        // update the nodes in the topological order
+        Vec_PtrForEachEntry( Aig_Obj_t *, vBatch, pObj, k )
+            Dch_ManSweepCommit( p, pPar, pObj, Vec_IntEntry(vPairIds, k), vCexVals );
+    }
+    Bar_ProgressStop( pProgress );
+    // stop the threads' data
+    for ( i = 0; i < nProcs; i++ )
+        Dch_ManStopThread( p, ThData[i].pMan );
+    Vec_PtrFree( pPar->vReprs );
+    Vec_PtrFree( pPar->vPairs );
+    Vec_IntFree( pPar->vStatus );
+    Vec_WecFree( pPar->vCexes );
+    Vec_PtrFree( vBatch );
+    Vec_IntFree( vPairIds );
+    Vec_IntFree( vCexVals );
+    Aig_ManCleanCioIds( p->pAigTotal );
+    // update the representatives of the nodes (makes classes invalid)
+    ABC_FREE( p->pAigTotal->pReprs );
+    p->pAigTotal->pReprs = p->pReprsProved;
+    p->pReprsProved = NULL;
+    // clean the mark
+    Aig_ManCleanMarkB( p->pAigTotal );
+}
+
+#endif // pthreads are used
+
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
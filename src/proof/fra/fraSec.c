@@ -439,7 +439,7 @@ clk = Abc_Clock();
         pNew = Aig_ManDupOrdered( pTemp = pNew );
         Aig_ManStop( pTemp );
 //        pNew = Dar_ManRewriteDefault( pTemp = pNew );
-        pNew = Dar_ManCompress2( pTemp = pNew, 1, 0, 1, 0, 0 ); 
+        pNew = Dar_ManCompress2( pTemp = pNew, 1, 0, 1, 0, 1, 0 ); 
         Aig_ManStop( pTemp );
         if ( pParSec->fVerbose )
         {
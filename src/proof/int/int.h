@@ -64,9 +64,14 @@ struct Inter_ManParams_t_
     int  fUseTwoFrames; // create the OR of two last timeframes
     int  fDropSatOuts;  // replace by 1 the solved outputs
     int  fDropInvar;    // dump inductive invariant into file
+    int  fCompactProof; // log the proofs compactly and trim unused clauses
+    int  nProcs;        // the number of threads trying different bounds
+    int  nFramesStart;  // the number of timeframes to start with
     int  fVerbose;      // print verbose statistics
     int  iFrameMax;     // the time frame reached
     char * pFileName;   // file name to dump interpolant
+    int  RunId;         // the id of this run
+    int(*pFuncStop)(int); // callback to terminate
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -80,6 +85,7 @@ struct Inter_ManParams_t_
 /*=== intCore.c ==========================================================*/
 extern void       Inter_ManSetDefaultParams( Inter_ManParams_t * p );
 extern int        Inter_ManPerformInterpolation( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame );
+extern int        Inter_ManPerformInterpolationPar( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame );
 
 
 
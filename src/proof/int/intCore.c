@@ -21,6 +21,17 @@
 #include "intInt.h"
 #include "sat/bmc/bmc.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -61,6 +72,9 @@ void Inter_ManSetDefaultParams( Inter_ManParams_t * p )
     p->fUseSeparate  = 0;     // solve each output separately
     p->fUseTwoFrames = 0;     // create OR of two last timeframes
     p->fDropSatOuts  = 0;     // replace by 1 the solved outputs
+    p->fCompactProof = 1;     // log the proofs compactly and trim unused clauses
+    p->nProcs        = 1;     // the number of threads trying different bounds
+    p->nFramesStart  = 1;     // the number of timeframes to start with
     p->fVerbose      = 0;     // print verbose statistics
     p->iFrameMax     =-1;
 }
@@ -89,6 +103,8 @@ int Inter_ManPerformInterpolation( Aig_Man_t * pAig, Inter_ManParams_t * pPars,
     // enable ORing of the interpolants, if containment check is performed inductively with K > 1
     if ( pPars->nFramesK > 1 )
         pPars->fTransLoop = 1;
+    if ( pPars->nProcs > 1 )
+        return Inter_ManPerformInterpolationPar( pAig, pPars, piFrame );
 
     // sanity checks
     assert( Saig_ManRegNum(pAig) > 0 );
@@ -131,7 +147,7 @@ p->timeCnf += Abc_Clock() - clk;
  
     // derive interpolant
     *piFrame = -1;
-    p->nFrames = 1;
+    p->nFrames = Abc_MaxInt( 1, pPars->nFramesStart );
     for ( s = 0; ; s++ )
     {
         Cnf_Dat_t * pCnfInter2;
@@ -205,6 +221,13 @@ p->timeEqu += Abc_Clock() - clk;
                 Inter_CheckStop( pCheck );
                 return -1;
             }
+            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            { 
+                p->timeTotal = Abc_Clock() - clkTotal;
+                Inter_ManStop( p, 0 );
+                Inter_CheckStop( pCheck );
+                return -1;
+            }
 
             // perform interpolation
             clk = Abc_Clock();
@@ -242,10 +265,13 @@ p->timeEqu += Abc_Clock() - clk;
                         pParsBmc->nConfLimit = 100000000;
                         pParsBmc->nStart     = p->nFrames;
                         pParsBmc->fVerbose   = pPars->fVerbose;
+                        pParsBmc->fSilent    = 1;
+                        pParsBmc->RunId      = pPars->RunId;
+                        pParsBmc->pFuncStop  = pPars->pFuncStop;
                         RetValue = Saig_ManBmcScalable( pAig, pParsBmc );
                         if ( RetValue == 1 )
                             printf( "Error: The problem should be SAT but it is UNSAT.\n" );
-                        else if ( RetValue == -1 )
+                        else if ( RetValue == -1 && (!pPars->pFuncStop || !pPars->pFuncStop(pPars->RunId)) ) // not terminated
                             printf( "Error: The problem timed out.\n" );
                     }
                     Inter_ManStop( p, 0 );
@@ -264,7 +290,7 @@ p->timeEqu += Abc_Clock() - clk;
                     if ( pPars->fVerbose )
                         printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
                 }
-                else
+                else if ( !pPars->pFuncStop || !pPars->pFuncStop(pPars->RunId) ) // not terminated
                 {
                     assert( p->nConfCur >= p->nConfLimit );
                     if ( pPars->fVerbose )
@@ -403,6 +429,204 @@ p->timeCnf += Abc_Clock() - clk;
 
 
 
+/**Function*************************************************************
+
+  Synopsis    [Performs interpolation with several bounds in parallel.]
+
+  Description [Thread i starts interpolation with i more timeframes than
+  the first thread. Since the proof with N starting timeframes relies on
+  the absence of counter-examples in fewer timeframes, the thread first
+  checks these timeframes by BMC. The first thread, which proves the 
+  property or finds a counter-example, terminates the other threads.
+  The run id and the result are kept in a manager owned by this call, 
+  so that several calls can run at the same time. The callback of the
+  caller, if any, is checked by the calling thread while waiting.
+  Returns 1 if proven. 0 if failed. -1 if undecided.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+int Inter_ManPerformInterpolationPar( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame )
+{
+    pPars->nProcs = 1;
+    return Inter_ManPerformInterpolation( pAig, pPars, piFrame );
+}
+
+#else // pthreads are used
+
+#define PAR_THR_MAX 100
+
+typedef struct Inter_ParMan_t_ Inter_ParMan_t;
+typedef struct Inter_ParThData_t_
+{
+    Inter_ParMan_t *  pMan;
+    Aig_Man_t *       pAig;       // the copy of the AIG used by this thread
+    Inter_ManParams_t Pars;       // the parameters of this thread
+    int               iThread;
+} Inter_ParThData_t;
+struct Inter_ParMan_t_
+{
+    int               fVerbose;
+    int               iWinner;    // the thread giving the answer
+    int               RetValue;   // the answer
+    int               iFrame;     // the frame of the counter-example
+    int               iFrameMax;  // the last frame reached
+    Abc_Cex_t *       pCex;       // the counter-example
+    abctime           clkStart;
+    int               nDone;      // the number of finished threads
+    volatile int      nRunId;     // the current run id
+    pthread_mutex_t   Mutex;      // protects the fields above
+};
+
+// the manager of the run served by this worker thread
+static ABC_THREAD_LOCAL Inter_ParMan_t * s_pInterParMan = NULL;
+
+// the threads of the current run stop as soon as the run id is incremented
+int Inter_ManCallBackToStop( int RunId ) { return s_pInterParMan && RunId < s_pInterParMan->nRunId; }
+
+void * Inter_ManParWorkerThread( void * pArg )
+{
+    Inter_ParThData_t * pThData = (Inter_ParThData_t *)pArg;
+    Inter_ParMan_t * pMan = pThData->pMan;
+    Inter_ManParams_t * pPars = &pThData->Pars;
+    int RetValue = -1, iFrame = -1, fSafe = 1;
+    s_pInterParMan = pMan;
+    // the CNFs of this thread are derived using its own CNF manager
+    Cnf_ManStartThread();
+    // make sure there is no counter-example in fewer timeframes
+    if ( pPars->nFramesStart > 1 )
+    {
+        Saig_ParBmc_t ParsBmc, * pParsBmc = &ParsBmc;
+        Saig_ParBmcSetDefaultParams( pParsBmc );
+        pParsBmc->nFramesMax = pPars->nFramesStart;
+        pParsBmc->nTimeOut   = pPars->nSecLimit;
+        pParsBmc->fSilent    = 1;
+        pParsBmc->RunId      = pPars->RunId;
+        pParsBmc->pFuncStop  = pPars->pFuncStop;
+        if ( Saig_ManBmcScalable( pThData->pAig, pParsBmc ) == 0 )
+        {
+            RetValue = 0;
+            iFrame = pThData->pAig->pSeqModel->iFrame;
+        }
+        else 
+            fSafe = pParsBmc->iFrame + 1 >= pPars->nFramesStart;
+    }
+    if ( RetValue == -1 && fSafe )
+        RetValue = Inter_ManPerformInterpolation( pThData->pAig, pPars, &iFrame );
+    Cnf_ManStopThread();
+    // report the result
+    pthread_mutex_lock( &pMan->Mutex );
+    if ( RetValue != -1 && pMan->iWinner == -1 )
+    {
+        pMan->iWinner   = pThData->iThread;
+        pMan->RetValue  = RetValue;
+        pMan->iFrame    = iFrame;
+        pMan->iFrameMax = pPars->iFrameMax;
+        pMan->pCex      = pThData->pAig->pSeqModel;  pThData->pAig->pSeqModel = NULL;
+        pMan->nRunId++;
+    }
+    else if ( pMan->iWinner == -1 )
+        pMan->iFrameMax = Abc_MaxInt( pMan->iFrameMax, pPars->iFrameMax );
+    if ( pMan->fVerbose )
+    {
+        printf( "Thread %2d : Starting frames = %3d.  ", pThData->iThread, pPars->nFramesStart );
+        if ( RetValue == 1 )
+            printf( "%-24s", "Property proved." );
+        else if ( RetValue == 0 )
+            printf( "Failed in frame %5d.  ", iFrame );
+        else 
+            printf( "%-24s", pMan->iWinner >= 0 ? "Terminated." : "Undecided." );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - pMan->clkStart );
+        fflush( stdout );
+    }
+    pMan->nDone++;
+    pthread_mutex_unlock( &pMan->Mutex );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+int Inter_ManPerformInterpolationPar( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame )
+{
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Inter_ParThData_t * pThData;
+    Inter_ParMan_t Man, * pMan = &Man;
+    int i, status, nProcs = Abc_MinInt( pPars->nProcs, PAR_THR_MAX );
+    if ( Inter_ManCheckInitialState(pAig) )
+    {
+        *piFrame = -1;
+        printf( "Property trivially fails in the initial state.\n" );
+        return 0;
+    }
+    memset( pMan, 0, sizeof(Inter_ParMan_t) );
+    pMan->fVerbose  = pPars->fVerbose;
+    pMan->iWinner   = -1;
+    pMan->RetValue  = -1;
+    pMan->iFrame    = -1;
+    pMan->iFrameMax = -1;
+    pMan->clkStart  = Abc_Clock();
+    status = pthread_mutex_init( &pMan->Mutex, NULL );  assert( status == 0 );
+    if ( pPars->fVerbose )
+        printf( "Running interpolation with %d threads starting from %d to %d timeframes.\n", 
+            nProcs, pPars->nFramesStart, pPars->nFramesStart + nProcs - 1 );
+    fflush( stdout );
+    pThData = ABC_CALLOC( Inter_ParThData_t, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData[i].pMan               = pMan;
+        pThData[i].pAig               = Aig_ManDupSimple( pAig );
+        pThData[i].Pars               = *pPars;
+        pThData[i].Pars.nProcs        = 1;
+        pThData[i].Pars.nFramesStart  = pPars->nFramesStart + i;
+        pThData[i].Pars.fDropInvar    = 0;
+        pThData[i].Pars.fVerbose      = 0;
+        pThData[i].Pars.RunId         = pMan->nRunId;
+        pThData[i].Pars.pFuncStop     = Inter_ManCallBackToStop;
+        pThData[i].iThread            = i;
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Inter_ManParWorkerThread, (void *)(pThData + i) );
+        assert( status == 0 );
+    }
+    // the caller's callback is checked in this thread, which may be a worker of the caller
+    if ( pPars->pFuncStop )
+    {
+        struct timespec pause_duration;
+        pause_duration.tv_sec = 0;
+        pause_duration.tv_nsec = 10000000L; // 10 milliseconds
+        while ( 1 )
+        {
+            int fStop = pPars->pFuncStop( pPars->RunId );
+            pthread_mutex_lock( &pMan->Mutex );
+            if ( fStop && pMan->iWinner == -1 )
+                pMan->nRunId++;
+            fStop = fStop || pMan->nDone == nProcs;
+            pthread_mutex_unlock( &pMan->Mutex );
+            if ( fStop )
+                break;
+            nanosleep( &pause_duration, NULL );
+        }
+    }
+    for ( i = 0; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    for ( i = 0; i < nProcs; i++ )
+        Aig_ManStop( pThData[i].pAig );
+    ABC_FREE( pThData );
+    pthread_mutex_destroy( &pMan->Mutex );
+    // return the result of the first thread that solved the problem
+    Abc_CexFreeP( &pAig->pSeqModel );
+    pAig->pSeqModel = pMan->pCex;
+    pPars->iFrameMax = pMan->iFrameMax;
+    *piFrame = pMan->iFrame;
+    return pMan->RetValue;
+}
+
+#endif // pthreads are used
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -69,7 +69,16 @@ struct Inter_Man_t_
     int              nConfCur;     // the current number of conflicts
     int              nConfLimit;   // the limit on the number of conflicts
     int              fVerbose;     // the verbosiness flag
+    int              fCompactProof; // log the proofs compactly
     char *           pFileName;
+    int              RunId;        // the id of this run
+    int(*pFuncStop)(int);          // callback to terminate
+    // proof statistics
+    int              nProofs;      // the number of proofs
+    double           nProofClas;   // the number of logged learned clauses
+    double           nProofTrim;   // the number of trimmed learned clauses
+    int              nProofPeak;   // the peak memory of the proof log
+    double           nProofFull;   // the memory of the largest proof stored without the log
     // runtime
     abctime          timeRwr;
     abctime          timeCnf;
@@ -223,6 +223,10 @@ int Inter_ManPerformOneStep( Inter_Man_t * p, int fUseBias, int fUseBackward, ab
     // set runtime limit
     if ( nTimeNewOut )
         sat_solver_set_runtime_limit( pSat, nTimeNewOut );
+    if ( p->fCompactProof )
+        sat_solver_store_compact( pSat );
+    pSat->RunId = p->RunId;
+    pSat->pFuncStop = p->pFuncStop;
 
     // collect global variables
     pGlobalVars = ABC_CALLOC( int, sat_solver_nvars(pSat) );
@@ -303,6 +307,17 @@ clk = Abc_Clock();
     }
 */
 
+    // collect statistics of the proof log
+    if ( p->fCompactProof )
+    {
+        Sto_Man_t * pStore = (Sto_Man_t *)pSatCnf;
+        p->nProofs++;
+        p->nProofClas += pStore->nLogged;
+        p->nProofTrim += pStore->nTrimmed;
+        p->nProofPeak  = Abc_MaxInt( p->nProofPeak, pStore->nLogPeak );
+        p->nProofFull  = Abc_MaxDouble( p->nProofFull, pStore->dLogFull );
+    }
+
     pManInterA = Inta_ManAlloc();
     p->pInterNew = (Aig_Man_t *)Inta_ManInterpolate( pManInterA, (Sto_Man_t *)pSatCnf, nTimeNewOut, p->vVarsAB, 0 );
     Inta_ManFree( pManInterA );
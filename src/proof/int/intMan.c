@@ -52,7 +52,10 @@ Inter_Man_t * Inter_ManCreate( Aig_Man_t * pAig, Inter_ManParams_t * pPars )
     p->vVarsAB = Vec_IntAlloc( Aig_ManRegNum(pAig) );
     p->nConfLimit = pPars->nBTLimit;
     p->fVerbose = pPars->fVerbose;
+    p->fCompactProof = pPars->fCompactProof;
     p->pFileName = pPars->pFileName;
+    p->RunId = pPars->RunId;
+    p->pFuncStop = pPars->pFuncStop;
     p->pAig = pAig;
     if ( pPars->fDropInvar )
         p->vInters = Vec_PtrAlloc( 100 );
@@ -138,6 +141,10 @@ void Inter_ManStop( Inter_Man_t * p, int fProved )
         ABC_PRTP( "Containment", p->timeEqu,   p->timeTotal );
         ABC_PRTP( "Other      ", p->timeOther, p->timeTotal );
         ABC_PRTP( "TOTAL      ", p->timeTotal, p->timeTotal );
+        if ( p->nProofs && p->nProofClas > 0 )
+            printf( "Proof log: Proofs = %d. Learned = %.0f. Trimmed = %.0f (%.2f %%). Peak = %.2f MB (vs. %.2f MB).\n", 
+                p->nProofs, p->nProofClas, p->nProofTrim, 100.0 * p->nProofTrim / p->nProofClas, 
+                1.0 * p->nProofPeak / (1<<20), p->nProofFull / (1<<20) );
     }
 
     if ( p->vInters )
@@ -497,7 +497,7 @@ void Pdr_ManReportInvariant( Pdr_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-void Pdr_ManVerifyInvariant( Pdr_Man_t * p )
+int Pdr_ManVerifyInvariant( Pdr_Man_t * p )
 {
     sat_solver * pSat;
     Vec_Int_t * vLits;
@@ -528,19 +528,21 @@ void Pdr_ManVerifyInvariant( Pdr_Man_t * p )
         RetValue = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits), 0, 0, 0, 0 );
         if ( RetValue != l_False )
         {
-            Abc_Print( 1, "Verification of clause %d failed.\n", i );
+            if ( !p->pPars->fSilent )
+                Abc_Print( 1, "Verification of clause %d failed.\n", i );
             Counter++;
         }
     }
-    if ( Counter )
+    if ( Counter && !p->pPars->fSilent )
         Abc_Print( 1, "Verification of %d clauses has failed.\n", Counter );
-    else
+    else if ( !p->pPars->fSilent )
     {
         Abc_Print( 1, "Verification of invariant with %d clauses was successful.  ", Vec_PtrSize(vCubes) );
         Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
     }
 //    sat_solver_delete( pSat );
     Vec_PtrFree( vCubes );
+    return Counter == 0;
 }
 
 /**Function*************************************************************
@@ -0,0 +1,469 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Parallel PDR with clause sharing.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "base/main/main.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// Several workers run PDR on their own copies of the AIG with different
+// generalization settings. Each clause added to the frames by a worker
+// is published as (worker, frame, lits). Other workers import it only
+// after checking that it is inductive relative to their own previous frame,
+// so the frames of each worker remain a valid PDR trace. The first worker
+// to finish stops the others, and its invariant is verified independently.
+// Worker 0 runs in the calling thread, which is the only thread calling
+// the user's termination callback. The lemmas read by all workers are
+// dropped from the shared array, which is also capped in case a worker
+// does not read for a long time; such worker misses the oldest lemmas.
+
+#define PDR_PAR_MAX 64
+#define PDR_PAR_LEMMAS (1 << 22) // the number of lemma words kept before the unread ones are dropped
+
+struct Pdr_Share_t_
+{
+    Vec_Int_t *     vLemmas;     // published lemmas: (worker, frame, nLits, lits)
+    int             nDropped;    // the number of words dropped from the front of vLemmas
+    volatile int    nPublished;  // the number of words published (including the dropped ones)
+    int             nWorkers;    // the number of workers
+    int             pRead[PDR_PAR_MAX]; // the number of words read by each worker
+    int             iWinner;     // the worker that solved the problem
+    volatile int    nRunId;      // the current run of the workers
+    int          (* pFuncStop)(int); // user's termination callback
+    int             UserRunId;   // user's run ID
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;       // protects the lemma array
+#endif
+};
+
+typedef struct Pdr_ParThData_t_ Pdr_ParThData_t;
+struct Pdr_ParThData_t_
+{
+    Pdr_Share_t *   pShare;      // shared data
+    Aig_Man_t *     pAig;        // copy of the AIG
+    Pdr_Par_t       Pars;        // parameters of this worker
+    Pdr_Man_t *     pMan;        // PDR manager of this worker
+    int             iWorker;     // worker number
+    int             RetValue;    // the result
+    abctime         clkTotal;    // runtime
+};
+
+// the worker served by this thread
+static ABC_THREAD_LOCAL Pdr_ParThData_t * s_pPdrParThData = NULL;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Callback used to stop the workers.]
+
+  Description [The workers stop when the run of their shared data is 
+  incremented, either by the first worker to finish or by worker 0 
+  when the user's callback requests termination.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManParCallBackToStop( int RunId )
+{
+    Pdr_ParThData_t * pThData = s_pPdrParThData;
+    Pdr_Share_t * pShare = pThData ? pThData->pShare : NULL;
+    if ( pShare == NULL )
+        return 0;
+    if ( RunId < pShare->nRunId )
+        return 1;
+    if ( pThData->iWorker > 0 || !pShare->pFuncStop || !pShare->pFuncStop(pShare->UserRunId) )
+        return 0;
+    pthread_mutex_lock( &pShare->Mutex );
+    pShare->nRunId++;
+    pthread_mutex_unlock( &pShare->Mutex );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Drops the lemmas that are no longer needed.]
+
+  Description [Drops the lemmas read by all workers if they make up at
+  least a half of the array. If they do not, but the array has more than
+  PDR_PAR_LEMMAS words, drops the oldest half of the lemmas, which
+  the slowest workers will never read. Assumes the lock.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManShareTrim( Pdr_Share_t * pShare )
+{
+    Vec_Int_t * vLemmas = pShare->vLemmas;
+    int i, nDrop = pShare->nPublished - pShare->nDropped;
+    for ( i = 0; i < pShare->nWorkers; i++ )
+        nDrop = Abc_MinInt( nDrop, pShare->pRead[i] - pShare->nDropped );
+    if ( 2 * nDrop < Vec_IntSize(vLemmas) )
+    {
+        if ( Vec_IntSize(vLemmas) <= PDR_PAR_LEMMAS )
+            return;
+        for ( nDrop = 0; 2 * nDrop < Vec_IntSize(vLemmas); nDrop += 3 + Vec_IntEntry(vLemmas, nDrop+2) );
+    }
+    if ( nDrop == 0 )
+        return;
+    memmove( Vec_IntArray(vLemmas), Vec_IntArray(vLemmas) + nDrop, sizeof(int) * (Vec_IntSize(vLemmas) - nDrop) );
+    Vec_IntShrink( vLemmas, Vec_IntSize(vLemmas) - nDrop );
+    pShare->nDropped += nDrop;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes the clause derived by this worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManSharePublish( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Share_t * pShare = p->pShare;
+    pthread_mutex_lock( &pShare->Mutex );
+    Vec_IntPush( pShare->vLemmas, p->iShareId );
+    Vec_IntPush( pShare->vLemmas, k );
+    Vec_IntPush( pShare->vLemmas, pCube->nLits );
+    Vec_IntPushArray( pShare->vLemmas, pCube->Lits, pCube->nLits );
+    pShare->nPublished = pShare->nDropped + Vec_IntSize( pShare->vLemmas );
+    if ( Vec_IntSize(pShare->vLemmas) > PDR_PAR_LEMMAS )
+        Pdr_ManShareTrim( pShare );
+    pthread_mutex_unlock( &pShare->Mutex );
+    p->nShareOut++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Imports the clauses published by other workers.]
+
+  Description [The shared array is only locked if new clauses appeared.
+  The worker skips the clauses dropped before it could read them.
+  A clause derived for frame k is added to frames 1..k of this worker
+  if it is inductive relative to frame k-1 of this worker.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManShareImport( Pdr_Man_t * p )
+{
+    Pdr_Share_t * pShare = p->pShare;
+    Vec_Int_t * vNew, * vLits, * vPiLits;
+    Pdr_Set_t * pCube;
+    int i, k, n, iWorker, nLits, kMax, RetValue;
+    if ( pShare->nPublished == p->iShareRead )
+        return;
+    pthread_mutex_lock( &pShare->Mutex );
+    p->iShareRead = Abc_MaxInt( p->iShareRead, pShare->nDropped );
+    vNew = Vec_IntAllocArrayCopy( Vec_IntEntryP(pShare->vLemmas, p->iShareRead - pShare->nDropped), pShare->nPublished - p->iShareRead );
+    p->iShareRead = pShare->pRead[p->iShareId] = pShare->nPublished;
+    Pdr_ManShareTrim( pShare );
+    pthread_mutex_unlock( &pShare->Mutex );
+    vLits   = Vec_IntAlloc( 100 );
+    vPiLits = Vec_IntAlloc( 0 );
+    kMax = Vec_PtrSize(p->vSolvers) - 1;
+    for ( i = 0; i < Vec_IntSize(vNew); i += 3 + nLits )
+    {
+        iWorker = Vec_IntEntry( vNew, i   );
+        k       = Abc_MinInt( Vec_IntEntry(vNew, i+1), kMax );
+        nLits   = Vec_IntEntry( vNew, i+2 );
+        if ( iWorker == p->iShareId || k < 1 )
+            continue;
+        Vec_IntClear( vLits );
+        for ( n = 0; n < nLits; n++ )
+            Vec_IntPush( vLits, Vec_IntEntry(vNew, i+3+n) );
+        pCube = Pdr_SetCreate( vLits, vPiLits );
+        if ( Pdr_SetIsInit(pCube, -1) || Pdr_ManCheckContainment(p, k, pCube) )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        RetValue = Pdr_ManCheckCube( p, k-1, pCube, NULL, p->pPars->nConfLimit, 0, 1 );
+        if ( RetValue != 1 )
+        {
+            Pdr_SetDeref( pCube );
+            p->nShareRej++;
+            continue;
+        }
+        for ( n = 1; n <= k; n++ )
+            Pdr_ManSolverAddClause( p, n, pCube );
+        Vec_VecPush( p->vClauses, k, pCube ); // consume ref
+        p->nCubes++;
+        p->nShareIn++;
+    }
+    Vec_IntFree( vPiLits );
+    Vec_IntFree( vLits );
+    Vec_IntFree( vNew );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the parameters of one worker.]
+
+  Description [Worker 0 uses the user's parameters. Other workers differ
+  in the random seed and in the generalization procedure.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManParSetParams( Pdr_Par_t * pPars, int iWorker, int RunId )
+{
+    pPars->nProcs       = 1;
+    pPars->fVerbose     = 0;
+    pPars->fVeryVerbose = 0;
+    pPars->fNotVerbose  = 1;
+    pPars->fSilent      = 1;
+    pPars->fDumpInv     = 0;
+    pPars->RunId        = RunId;
+    pPars->pFuncStop    = Pdr_ManParCallBackToStop;
+    if ( iWorker == 0 )
+        return;
+    pPars->nRandomSeed += 7919 * iWorker;
+    switch ( iWorker % 4 )
+    {
+    case 1: pPars->fTwoRounds ^= 1;                        break;
+    case 2: pPars->fSkipDown = 0; pPars->fCtgs = 1;        break;
+    case 3: pPars->fFlopOrder ^= 1;                        break;
+    case 0: pPars->fSimpleGeneral ^= 1;                    break;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_ManParWorkerThread( void * pArg )
+{
+    Pdr_ParThData_t * pThData = (Pdr_ParThData_t *)pArg;
+    Pdr_ParThData_t * pThDataOld = s_pPdrParThData;
+    abctime clk = Abc_Clock();
+    s_pPdrParThData = pThData;
+    pThData->RetValue = Pdr_ManSolveInt( pThData->pMan );
+    pThData->clkTotal = Abc_Clock() - clk;
+    pthread_mutex_lock( &pThData->pShare->Mutex );
+    // the finished worker does not hold back dropping the lemmas
+    pThData->pShare->pRead[pThData->iWorker] = ABC_INFINITY;
+    if ( pThData->RetValue != -1 && pThData->pShare->iWinner == -1 )
+    {
+        pThData->pShare->iWinner = pThData->iWorker;
+        pThData->pShare->nRunId++;
+    }
+    pthread_mutex_unlock( &pThData->pShare->Mutex );
+    s_pPdrParThData = pThDataOld;
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs several PDR workers sharing the clauses.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    Pdr_ParThData_t ThData[PDR_PAR_MAX];
+    pthread_t WorkerThread[PDR_PAR_MAX];
+    Pdr_Share_t Share, * pShare = &Share;
+    Pdr_Man_t * pWin = NULL;
+    int i, status, RetValue = -1, nProcs = Abc_MinInt( pPars->nProcs, PDR_PAR_MAX );
+    abctime clk = Abc_Clock();
+    if ( pPars->fSolveAll || pPars->fUseAbs || pPars->fUseBridge || pPars->nTimeOutOne || pPars->vOutMap )
+    {
+        if ( !pPars->fSilent )
+            Abc_Print( 1, "Parallel PDR does not support multi-output, abstraction or bridge modes; running one worker.\n" );
+        pPars->nProcs = 1;
+        RetValue = Pdr_ManSolve( pAig, pPars );
+        pPars->nProcs = nProcs;
+        return RetValue;
+    }
+    ABC_FREE( pAig->pSeqModel );
+    // start the shared data
+    memset( pShare, 0, sizeof(Pdr_Share_t) );
+    pShare->vLemmas  = Vec_IntAlloc( 1 << 16 );
+    pShare->nWorkers = nProcs;
+    pShare->iWinner  = -1;
+    status = pthread_mutex_init( &pShare->Mutex, NULL );  assert( status == 0 );
+    pShare->pFuncStop = pPars->pFuncStop;
+    pShare->UserRunId = pPars->RunId;
+    // start the workers
+    for ( i = 0; i < nProcs; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Pdr_ParThData_t) );
+        ThData[i].pShare   = pShare;
+        ThData[i].pAig     = Aig_ManDupSimple( pAig );
+        ThData[i].Pars     = *pPars;
+        ThData[i].iWorker  = i;
+        ThData[i].RetValue = -1;
+        Pdr_ManParSetParams( &ThData[i].Pars, i, pShare->nRunId );
+        ThData[i].pMan = Pdr_ManStart( ThData[i].pAig, &ThData[i].Pars, NULL );
+        ThData[i].pMan->pShare   = pShare;
+        ThData[i].pMan->iShareId = i;
+    }
+    for ( i = 1; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Pdr_ManParWorkerThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    Pdr_ManParWorkerThread( (void *)ThData );
+    for ( i = 1; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    // collect the results
+    if ( pShare->iWinner >= 0 )
+    {
+        pWin     = ThData[pShare->iWinner].pMan;
+        RetValue = ThData[pShare->iWinner].RetValue;
+        pPars->iFrame     = ThData[pShare->iWinner].Pars.iFrame;
+        pPars->nFailOuts  = ThData[pShare->iWinner].Pars.nFailOuts;
+        pPars->nProveOuts = ThData[pShare->iWinner].Pars.nProveOuts;
+    }
+    else
+    {
+        for ( i = 0; i < nProcs; i++ )
+            pPars->iFrame = Abc_MaxInt( pPars->iFrame, ThData[i].Pars.iFrame );
+    }
+    if ( RetValue == 0 )
+    {
+        Abc_Cex_t * pCex = ThData[pShare->iWinner].pAig->pSeqModel;
+        ThData[pShare->iWinner].pAig->pSeqModel = NULL;
+        if ( pCex && Saig_ManVerifyCex( pAig, pCex ) )
+            pAig->pSeqModel = pCex;
+        else
+        {
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Parallel PDR: The counter-example of worker %d failed to verify.\n", pShare->iWinner );
+            Abc_CexFreeP( &pCex );
+            RetValue = -1;
+        }
+    }
+    else if ( RetValue == 1 )
+    {
+        pWin->pPars->fSilent = pPars->fSilent;
+        if ( !pPars->fSilent )
+            Pdr_ManReportInvariant( pWin );
+        if ( !Pdr_ManVerifyInvariant( pWin ) )
+        {
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Parallel PDR: The invariant of worker %d failed to verify.\n", pShare->iWinner );
+            RetValue = -1;
+        }
+    }
+    if ( pWin && RetValue == 1 )
+    {
+        if ( pPars->fDumpInv )
+        {
+            char * pFileName = pPars->pInvFileName ? pPars->pInvFileName : Extra_FileNameGenericAppend(pAig->pName, "_inv.pla");
+            Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( pWin, 0 ) );
+            Pdr_ManDumpClauses( pWin, pFileName, 1 );
+            printf( "Dumped inductive invariant in file \"%s\".\n", pFileName );
+        }
+        else
+            Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( pWin, 0 ) );
+    }
+    if ( pPars->fVerbose )
+    {
+        for ( i = 0; i < nProcs; i++ )
+        {
+            Pdr_Man_t * p = ThData[i].pMan;
+            Abc_Print( 1, "Worker %2d : Frames =%4d  Cubes =%7d  Out =%7d  In =%7d  Rej =%7d  Res = %-5s ",
+                i, Vec_PtrSize(p->vSolvers), p->nCubes, p->nShareOut, p->nShareIn, p->nShareRej,
+                i == pShare->iWinner ? (ThData[i].RetValue ? "UNSAT" : "SAT") : "-" );
+            Abc_PrintTime( 1, "Time", ThData[i].clkTotal );
+        }
+        Abc_Print( 1, "Shared lemmas: published %d words, dropped %d words.\n", pShare->nPublished, pShare->nDropped );
+        Abc_PrintTime( 1, "Parallel PDR time", Abc_Clock() - clk );
+    }
+    // cleanup
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Pdr_ManStop( ThData[i].pMan );
+        Aig_ManStop( ThData[i].pAig );
+    }
+    Vec_IntFree( pShare->vLemmas );
+    pthread_mutex_destroy( &pShare->Mutex );
+    pPars->iFrame--;
+    return RetValue;
+}
+
+#else // pthreads are not used
+
+void Pdr_ManSharePublish( Pdr_Man_t * p, int k, Pdr_Set_t * pCube ) {}
+void Pdr_ManShareImport( Pdr_Man_t * p ) {}
+int Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    int RetValue, nProcs = pPars->nProcs;
+    pPars->nProcs = 1;
+    RetValue = Pdr_ManSolve( pAig, pPars );
+    pPars->nProcs = nProcs;
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
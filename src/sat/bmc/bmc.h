@@ -42,6 +42,18 @@ ABC_NAMESPACE_HEADER_START
 ////////////////////////////////////////////////////////////////////////
 
 
+// incremental SAT solvers available through the uniform interface
+typedef enum { 
+    BMC_SOLVER_BSAT = 0,    // 0: MiniSat-based solver in ABC
+    BMC_SOLVER_SATOKO,      // 1: Satoko
+    BMC_SOLVER_GLUCOSE,     // 2: Glucose 3.0
+    BMC_SOLVER_CADICAL,     // 3: CaDiCaL
+    BMC_SOLVER_KISSAT,      // 4: Kissat (non-incremental, emulated)
+    BMC_SOLVER_NUM          // 5: the number of solvers
+} Bmc_SolverType_t;
+
+typedef struct Bmc_Solver_t_ Bmc_Solver_t;
+
 // exact synthesis parameters
 
 typedef struct Bmc_EsPar_t_ Bmc_EsPar_t;
@@ -150,12 +162,15 @@ struct Bmc_AndPar_t_
     int         nTimeOut;       // timeout in seconds
     int         nLutSize;       // LUT size for cut computation
     int         nProcs;         // the number of parallel solvers
+    int         fParDepth;      // parallel solvers check different windows of frames
     int         fLoadCnf;       // dynamic CNF loading
     int         fDumpFrames;    // dump unrolled timeframes
     int         fUseSynth;      // use synthesis
     int         fUseOldCnf;     // use old CNF construction
     int         fUseGlucose;    // use Glucose 3.0 as the default solver
     int         fUseEliminate;  // use variable elimination
+    int         nSolverType;    // SAT solver type (Bmc_SolverType_t)
+    int         fSolverStats;   // print SAT call statistics
     int         fVerbose;       // verbose 
     int         fVeryVerbose;   // very verbose 
     int         fNotVerbose;    // skip line-by-line print-out 
@@ -163,7 +178,9 @@ struct Bmc_AndPar_t_
     int         nFailOuts;      // the number of failed outputs
     int         nDropOuts;      // the number of dropped outputs
     
-    void (*pFuncOnFrameDone)(int, int, int); // callback on each frame status (frame, po, statuss)
+    void (*pFuncOnFrameDone)(int, int, int); // callback on each frame status (frame, po, statuss); with -d, called by one worker thread at a time
+    int         RunId;          // BMC id in this run 
+    int(*pFuncStop)(int);       // callback to terminate
 };
   
 typedef struct Bmc_BCorePar_t_ Bmc_BCorePar_t;
@@ -252,6 +269,27 @@ extern int               Bmc_CexVerifyAnyPo( Gia_Man_t * p, Abc_Cex_t * pCex, Ab
 /*=== bmcICheck.c ==========================================================*/
 extern void              Bmc_PerformICheck( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fEmpty, int fVerbose );
 extern Vec_Int_t *       Bmc_PerformISearch( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fReverse, int fBackTopo, int fDump, int fVerbose );
+/*=== bmcSolver.c ==========================================================*/
+extern int               Bmc_SolverTypeFromName( char * pName );
+extern char *            Bmc_SolverTypeName( int Type );
+extern Bmc_Solver_t *    Bmc_SolverStart( int Type );
+extern void              Bmc_SolverStop( Bmc_Solver_t * p );
+extern int               Bmc_SolverType( Bmc_Solver_t * p );
+extern void *            Bmc_SolverBackend( Bmc_Solver_t * p );
+extern int               Bmc_SolverAddVar( Bmc_Solver_t * p );
+extern int               Bmc_SolverAddClause( Bmc_Solver_t * p, int * pLits, int nLits );
+extern void              Bmc_SolverSetConfLimit( Bmc_Solver_t * p, int nConfLimit );
+extern int               Bmc_SolverSolve( Bmc_Solver_t * p, int * pLits, int nLits );
+extern int               Bmc_SolverVarValue( Bmc_Solver_t * p, int v );
+extern int               Bmc_SolverFinal( Bmc_Solver_t * p, int ** ppArray );
+extern int               Bmc_SolverVarNum( Bmc_Solver_t * p );
+extern int               Bmc_SolverClauseNum( Bmc_Solver_t * p );
+extern int               Bmc_SolverConfNum( Bmc_Solver_t * p );
+extern int               Bmc_SolverLearntNum( Bmc_Solver_t * p );
+extern void              Bmc_SolverSetStop( Bmc_Solver_t * p, int * pStop );
+extern void              Bmc_SolverSetStopFunc( Bmc_Solver_t * p, int RunId, int (*pFuncStop)(int) );
+extern abctime           Bmc_SolverSetRuntimeLimit( Bmc_Solver_t * p, abctime nTimeToStop );
+extern void              Bmc_SolverPrintStats( Bmc_Solver_t * p );
 /*=== bmcUnroll.c ==========================================================*/
 extern Unr_Man_t *       Unr_ManUnrollStart( Gia_Man_t * pGia, int fVerbose );
 extern Gia_Man_t *       Unr_ManUnrollFrame( Unr_Man_t * p, int f );
@@ -21,8 +21,6 @@
 #include "proof/fra/fra.h"
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satStore.h"
-#include "sat/satoko/satoko.h"
-#include "sat/glucose/AbcGlucose.h"
 #include "misc/vec/vecHsh.h"
 #include "misc/vec/vecWec.h"
 #include "bmc.h"
@@ -61,9 +59,7 @@ struct Gia_ManBmc_t_
     int               nLitUsed;    // used literals
     int               nLitUseless; // useless literals
     // SAT solver
-    sat_solver *      pSat;        // SAT solver
-    satoko_t *        pSat2;       // SAT solver
-    bmcg_sat_solver * pSat3;       // SAT solver
+    Bmc_Solver_t *    pSat;        // SAT solver
     int               nSatVars;    // SAT variables
     int               nObjNums;    // SAT objects
     int               nWordNum;    // unsigned words for ternary simulation
@@ -126,6 +122,12 @@ static inline int Saig_ManBmcSimInfoClear( unsigned * pInfo, Aig_Obj_t * pObj )
     return Value;
 }
 
+// the backend of the SAT solver if it is bsat
+static inline sat_solver * Saig_ManBmcBsat( Gia_ManBmc_t * p )
+{
+    return Bmc_SolverType(p->pSat) == BMC_SOLVER_BSAT ? (sat_solver *)Bmc_SolverBackend(p->pSat) : NULL;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns the number of LIs with binary ternary info.]
@@ -747,27 +749,10 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLi
     p->vVisited = Vec_WecAlloc( 100 );
     // create solver
     p->nSatVars = 1;
-    if ( fUseSatoko )
-    {
-        satoko_opts_t opts;
-        satoko_default_opts(&opts);
-        opts.conf_limit = nConfLimit;
-        p->pSat2 = satoko_create();  
-        satoko_configure(p->pSat2, &opts);
-        satoko_setnvars(p->pSat2, 1000);
-    }
-    else if ( fUseGlucose )
-    {
-        //opts.conf_limit = nConfLimit;
-        p->pSat3 = bmcg_sat_solver_start();  
-        for ( i = 0; i < 1000; i++ )
-            bmcg_sat_solver_addvar( p->pSat3 );
-    }
-    else
-    {
-        p->pSat  = sat_solver_new();
-        sat_solver_setnvars(p->pSat, 1000);
-    }
+    p->pSat = Bmc_SolverStart( fUseSatoko ? BMC_SOLVER_SATOKO : fUseGlucose ? BMC_SOLVER_GLUCOSE : BMC_SOLVER_BSAT );
+    Bmc_SolverSetConfLimit( p->pSat, nConfLimit );
+    for ( i = 0; i < 1000; i++ )
+        Bmc_SolverAddVar( p->pSat );
     Cnf_ReadMsops( &p->pSopSizes, &p->pSops );
     // terminary simulation 
     p->nWordNum = Abc_BitWordNum( 2 * Aig_ManObjNumMax(pAig) );
@@ -800,15 +785,17 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
 {
     if ( p->pPars->fVerbose )
     {
-        int nUsedVars = p->pSat ? sat_solver_count_usedvars(p->pSat) : 0;
+        sat_solver * pBsat = Saig_ManBmcBsat( p );
+        int nUsedVars = pBsat ? sat_solver_count_usedvars(pBsat) : 0;
         Abc_Print( 1, "LStart(P) = %d  LDelta(Q) = %d  LRatio(R) = %d  ReduceDB = %d  Vars = %d  Used = %d (%.2f %%)\n", 
-            p->pSat ? p->pSat->nLearntStart     : 0, 
-            p->pSat ? p->pSat->nLearntDelta     : 0, 
-            p->pSat ? p->pSat->nLearntRatio     : 0, 
-            p->pSat ? p->pSat->nDBreduces       : 0, 
-            p->pSat ? sat_solver_nvars(p->pSat) : p->pSat3 ? bmcg_sat_solver_varnum(p->pSat3) : satoko_varnum(p->pSat2), 
+            pBsat ? pBsat->nLearntStart     : 0, 
+            pBsat ? pBsat->nLearntDelta     : 0, 
+            pBsat ? pBsat->nLearntRatio     : 0, 
+            pBsat ? pBsat->nDBreduces       : 0, 
+            Bmc_SolverVarNum(p->pSat), 
             nUsedVars, 
-            100.0*nUsedVars/(p->pSat ? sat_solver_nvars(p->pSat) : p->pSat3 ? bmcg_sat_solver_varnum(p->pSat3) : satoko_varnum(p->pSat2)) );
+            100.0*nUsedVars/Bmc_SolverVarNum(p->pSat) );
+        Bmc_SolverPrintStats( p->pSat );
         Abc_Print( 1, "Buffs = %d. Dups = %d.   Hash hits = %d.  Hash misses = %d.  UniProps = %d.\n", 
             p->nBufNum, p->nDupNum, p->nHashHit, p->nHashMiss, p->nUniProps );
     }
@@ -827,9 +814,7 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
     Vec_IntFree( p->vId2Num );
     Vec_VecFree( (Vec_Vec_t *)p->vId2Var );
     Vec_PtrFreeFree( p->vTerInfo );
-    if ( p->pSat )  sat_solver_delete( p->pSat );
-    if ( p->pSat2 ) satoko_destroy( p->pSat2 );
-    if ( p->pSat3 ) bmcg_sat_solver_stop( p->pSat3 );
+    Bmc_SolverStop( p->pSat );
     ABC_FREE( p->pTime4Outs );
     Vec_IntFree( p->vData );
     Hsh_IntManStop( p->vHash );
@@ -1019,21 +1004,8 @@ static inline void Saig_ManBmcAddClauses( Gia_ManBmc_t * p, int uTruth, int Lits
                 }
                 CutLit = CutLit / 3;
             }
-            if ( p->pSat2 )
-            {
-                if ( !satoko_add_clause( p->pSat2, ClaLits, nClaLits ) )
-                    assert( 0 );
-            }
-            else if ( p->pSat3 )
-            {
-                if ( !bmcg_sat_solver_addclause( p->pSat3, ClaLits, nClaLits ) )
-                    assert( 0 );
-            }
-            else
-            {
-                if ( !sat_solver_addclause( p->pSat, ClaLits, ClaLits+nClaLits ) )
-                    assert( 0 );
-            }
+            if ( !Bmc_SolverAddClause( p->pSat, ClaLits, nClaLits ) )
+                assert( 0 );
         }
     }
 }
@@ -1280,15 +1252,8 @@ int Saig_ManBmcCreateCnf( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame )
             Saig_ManBmcCreateCnf_rec( p, pTemp, iFrame-f );
     Lit = Saig_ManBmcLiteral( p, pObj, iFrame );
     // extend the SAT solver
-    if ( p->pSat2 )
-        satoko_setnvars( p->pSat2, p->nSatVars );
-    else if ( p->pSat3 )
-    {
-        for ( i = bmcg_sat_solver_varnum(p->pSat3); i < p->nSatVars; i++ )
-            bmcg_sat_solver_addvar( p->pSat3 );
-    }
-    else
-        sat_solver_setnvars( p->pSat, p->nSatVars );
+    while ( Bmc_SolverVarNum(p->pSat) < p->nSatVars )
+        Bmc_SolverAddVar( p->pSat );
     return Lit;
 }
 
@@ -1399,21 +1364,8 @@ Abc_Cex_t * Saig_ManGenerateCex( Gia_ManBmc_t * p, int f, int i )
         Saig_ManForEachPi( p->pAig, pObjPi, k )
         {
             int iLit = Saig_ManBmcLiteral( p, pObjPi, j );
-            if ( p->pSat2 )
-            {
-                if ( iLit != ~0 && satoko_read_cex_varvalue(p->pSat2, lit_var(iLit)) )
-                    Abc_InfoSetBit( pCex->pData, iBit + k );
-            }
-            else if ( p->pSat3 )
-            {
-                if ( iLit != ~0 && bmcg_sat_solver_read_cex_varvalue(p->pSat3, lit_var(iLit)) )
-                    Abc_InfoSetBit( pCex->pData, iBit + k );
-            }
-            else
-            {
-                if ( iLit != ~0 && sat_solver_var_value(p->pSat, lit_var(iLit)) )
-                    Abc_InfoSetBit( pCex->pData, iBit + k );
-            }
+            if ( iLit != ~0 && Bmc_SolverVarValue(p->pSat, lit_var(iLit)) )
+                Abc_InfoSetBit( pCex->pData, iBit + k );
         }
     return pCex;
 }
@@ -1436,15 +1388,8 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
         return l_False;
     if ( Lit == 1 )
         return l_True;
-    if ( p->pSat2 )
-        return satoko_solve_assumptions_limit( p->pSat2, &Lit, 1, p->pPars->nConfLimit );
-    else if ( p->pSat3 )
-    {
-        bmcg_sat_solver_set_conflict_budget( p->pSat3, p->pPars->nConfLimit );
-        return bmcg_sat_solver_solve( p->pSat3, &Lit, 1 );
-    }
-    else
-        return sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    Bmc_SolverSetConfLimit( p->pSat, p->pPars->nConfLimit );
+    return Bmc_SolverSolve( p->pSat, &Lit, 1 );
 }
 
 /**Function*************************************************************
@@ -1482,26 +1427,16 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     // create BMC manager
     p = Saig_Bmc3ManStart( pAig, pPars->nTimeOutOne, pPars->nConfLimit, pPars->fUseSatoko, pPars->fUseGlucose );
     p->pPars = pPars;
-    if ( p->pSat )
+    if ( Saig_ManBmcBsat(p) )
     {
-        p->pSat->nLearntStart = p->pPars->nLearnedStart;
-        p->pSat->nLearntDelta = p->pPars->nLearnedDelta;
-        p->pSat->nLearntRatio = p->pPars->nLearnedPerce;
-        p->pSat->nLearntMax   = p->pSat->nLearntStart;
-        p->pSat->fNoRestarts  = p->pPars->fNoRestarts;
-        p->pSat->RunId        = p->pPars->RunId;
-        p->pSat->pFuncStop    = p->pPars->pFuncStop;
-    }
-    else if ( p->pSat3 )
-    {
-//        satoko_set_runid(p->pSat3, p->pPars->RunId);
-//        satoko_set_stop_func(p->pSat3, p->pPars->pFuncStop);
-    }
-    else
-    {
-        satoko_set_runid(p->pSat2, p->pPars->RunId);
-        satoko_set_stop_func(p->pSat2, p->pPars->pFuncStop);
+        sat_solver * pBsat = Saig_ManBmcBsat( p );
+        pBsat->nLearntStart = p->pPars->nLearnedStart;
+        pBsat->nLearntDelta = p->pPars->nLearnedDelta;
+        pBsat->nLearntRatio = p->pPars->nLearnedPerce;
+        pBsat->nLearntMax   = pBsat->nLearntStart;
+        pBsat->fNoRestarts  = p->pPars->fNoRestarts;
     }
+    Bmc_SolverSetStopFunc( p->pSat, p->pPars->RunId, p->pPars->pFuncStop );
     if ( pPars->fSolveAll && p->vCexes == NULL )
         p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
     if ( pPars->fVerbose )
@@ -1515,14 +1450,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     pPars->nFramesMax = pPars->nFramesMax ? pPars->nFramesMax : ABC_INFINITY;
     // set runtime limit
     if ( nTimeToStop )
-    {
-        if ( p->pSat2 )
-            satoko_set_runtime_limit( p->pSat2, nTimeToStop );
-        else if ( p->pSat3 )
-            bmcg_sat_solver_set_runtime_limit( p->pSat3, nTimeToStop );
-        else
-            sat_solver_set_runtime_limit( p->pSat, nTimeToStop );
-    }
+        Bmc_SolverSetRuntimeLimit( p->pSat, nTimeToStop );
     // perform frames
     Aig_ManRandom( 1 );
     pPars->timeLastSolved = Abc_Clock();
@@ -1531,6 +1459,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         // stop BMC after exploring all reachable states
         if ( !pPars->nFramesJump && Aig_ManRegNum(pAig) < 30 && f == (1 << Aig_ManRegNum(pAig)) )
         {
+            if ( !pPars->fSilent )
             Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
             if ( p->pPars->fUseBridge )
                 Saig_ManForEachPo( pAig, pObj, i )
@@ -1542,6 +1471,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         // stop BMC if all targets are solved
         if ( pPars->fSolveAll && pPars->nFailOuts + pPars->nDropOuts >= Saig_ManPoNum(pAig) )
         {
+            if ( !pPars->fSilent )
             Abc_Print( 1, "Stopping BMC because all targets are disproved or timed out.\n" );
             RetValue = pPars->nFailOuts ? 0 : 1;
             goto finish;
@@ -1644,17 +1574,12 @@ clk2 = Abc_Clock();
 clkOther += Abc_Clock() - clk2;
             // solve this output
             fUnfinished = 0;
-            if ( p->pSat ) sat_solver_compress( p->pSat );
+            if ( Saig_ManBmcBsat(p) ) sat_solver_compress( Saig_ManBmcBsat(p) );
             if ( p->pTime4Outs )
             {
                 assert( p->pTime4Outs[i] > 0 );
                 clkOne = Abc_Clock();
-                if ( p->pSat2 )
-                    satoko_set_runtime_limit( p->pSat2, p->pTime4Outs[i] + Abc_Clock() );
-                else if ( p->pSat3 )
-                    bmcg_sat_solver_set_runtime_limit( p->pSat3, p->pTime4Outs[i] + Abc_Clock() );
-                else
-                    sat_solver_set_runtime_limit( p->pSat, p->pTime4Outs[i] + Abc_Clock() );
+                Bmc_SolverSetRuntimeLimit( p->pSat, p->pTime4Outs[i] + Abc_Clock() );
             }
 clk2 = Abc_Clock();
             status = Saig_ManCallSolver( p, Lit );
@@ -1678,25 +1603,21 @@ nTimeUnsat += clkSatRun;
                 {
                     // add final unit clause
                     Lit = lit_neg( Lit );
-                    if ( p->pSat2 )
-                        status = satoko_add_clause( p->pSat2, &Lit, 1 );
-                    else if ( p->pSat3 )
-                        status = bmcg_sat_solver_addclause( p->pSat3, &Lit, 1 );
-                    else
-                        status = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+                    status = Bmc_SolverAddClause( p->pSat, &Lit, 1 );
                     assert( status );
                     // add learned units
-                    if ( p->pSat )
+                    if ( Saig_ManBmcBsat(p) )
                     {
-                        for ( k = 0; k < veci_size(&p->pSat->unit_lits); k++ )
+                        sat_solver * pBsat = Saig_ManBmcBsat( p );
+                        for ( k = 0; k < veci_size(&pBsat->unit_lits); k++ )
                         {
-                            Lit = veci_begin(&p->pSat->unit_lits)[k];
-                            status = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+                            Lit = veci_begin(&pBsat->unit_lits)[k];
+                            status = Bmc_SolverAddClause( p->pSat, &Lit, 1 );
                             assert( status );
                         }
-                        veci_resize(&p->pSat->unit_lits, 0);
+                        veci_resize(&pBsat->unit_lits, 0);
                         // propagate units
-                        sat_solver_compress( p->pSat );
+                        sat_solver_compress( pBsat );
                     }
                 }
                 if ( p->pPars->fUseBridge )
@@ -1713,14 +1634,14 @@ nTimeSat += clkSatRun;
                     {
                         Abc_Print( 1, "%4d %s : ", f,  fUnfinished ? "-" : "+" );
                         Abc_Print( 1, "Var =%8.0f. ",  (double)p->nSatVars );
-                        Abc_Print( 1, "Cla =%9.0f. ",  (double)(p->pSat ? p->pSat->stats.clauses   : p->pSat3 ? bmcg_sat_solver_clausenum(p->pSat3)   : satoko_clausenum(p->pSat2)) );
-                        Abc_Print( 1, "Conf =%7.0f. ", (double)(p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) );
+                        Abc_Print( 1, "Cla =%9.0f. ",  (double)Bmc_SolverClauseNum(p->pSat) );
+                        Abc_Print( 1, "Conf =%7.0f. ", (double)Bmc_SolverConfNum(p->pSat) );
 //                        Abc_Print( 1, "Imp =%10.0f. ", (double)p->pSat->stats.propagations );
 //                        Abc_Print( 1, "Uni =%7.0f. ",(double)(p->pSat ? sat_solver_count_assigned(p->pSat) : 0) );
 //                        ABC_PRT( "Time", Abc_Clock() - clk );
-                        Abc_Print( 1, "Learn =%7.0f. ", (double)(p->pSat ? p->pSat->stats.learnts : p->pSat3 ? bmcg_sat_solver_learntnum(p->pSat3) : satoko_learntnum(p->pSat2)) );
+                        Abc_Print( 1, "Learn =%7.0f. ", (double)Bmc_SolverLearntNum(p->pSat) );
                         Abc_Print( 1, "%4.0f MB",      4.25*(f+1)*p->nObjNums /(1<<20) );
-                        Abc_Print( 1, "%4.0f MB",      1.0*(p->pSat ? sat_solver_memory(p->pSat) : 0)/(1<<20) );
+                        Abc_Print( 1, "%4.0f MB",      1.0*(Saig_ManBmcBsat(p) ? sat_solver_memory(Saig_ManBmcBsat(p)) : 0)/(1<<20) );
                         Abc_Print( 1, "%9.2f sec  ",   (float)(Abc_Clock() - clkTotal)/(float)(CLOCKS_PER_SEC) );
 //                        Abc_Print( 1, "\n" );
 //                        ABC_PRMn( "Id2Var", (f+1)*p->nObjNums*4 );
@@ -1760,14 +1681,7 @@ nTimeSat += clkSatRun;
                 pPars->timeLastSolved = Abc_Clock();
                 nTimeToStop = Saig_ManBmcTimeToStop( pPars, nTimeToStopNG );
                 if ( nTimeToStop )
-                {
-                    if ( p->pSat2 )
-                        satoko_set_runtime_limit( p->pSat2, nTimeToStop );
-                    else if ( p->pSat3 )
-                        bmcg_sat_solver_set_runtime_limit( p->pSat3, nTimeToStop );
-                    else
-                        sat_solver_set_runtime_limit( p->pSat, nTimeToStop );
-                }
+                    Bmc_SolverSetRuntimeLimit( p->pSat, nTimeToStop );
 
                 // check if other outputs failed under the same counter-example
                 Saig_ManForEachPo( pAig, pObj, k )
@@ -1780,21 +1694,8 @@ nTimeSat += clkSatRun;
                         continue;
                     // check if this output is solved
                     Lit = Saig_ManBmcCreateCnf( p, pObj, f );
-                    if ( p->pSat2 )
-                    {
-                        if ( satoko_read_cex_varvalue(p->pSat2, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
-                            continue;
-                    }
-                    else if ( p->pSat3 )
-                    {
-                        if ( bmcg_sat_solver_read_cex_varvalue(p->pSat3, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
-                            continue;
-                    }
-                    else
-                    {
-                        if ( sat_solver_var_value(p->pSat, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
-                            continue;
-                    }
+                    if ( Bmc_SolverVarValue(p->pSat, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
+                        continue;
                     // write entry
                     pPars->nFailOuts++;
                     if ( !pPars->fNotVerbose )
@@ -1833,7 +1734,7 @@ nTimeUndec += clkSatRun;
         }
         if ( pPars->fVerbose ) 
         {
-            if ( fFirst == 1 && f > 0 && (p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) > 1 )
+            if ( fFirst == 1 && f > 0 && Bmc_SolverConfNum(p->pSat) > 1 )
             {
                 fFirst = 0;
 //                Abc_Print( 1, "Outputs of frames up to %d are trivially UNSAT.\n", f );
@@ -1841,11 +1742,11 @@ nTimeUndec += clkSatRun;
             Abc_Print( 1, "%4d %s : ", f, fUnfinished ? "-" : "+" );
             Abc_Print( 1, "Var =%8.0f. ", (double)p->nSatVars );
 //            Abc_Print( 1, "Used =%8.0f. ", (double)sat_solver_count_usedvars(p->pSat) );
-            Abc_Print( 1, "Cla =%9.0f. ", (double)(p->pSat ? p->pSat->stats.clauses   : p->pSat3 ? bmcg_sat_solver_clausenum(p->pSat3)   : satoko_clausenum(p->pSat2))   );
-            Abc_Print( 1, "Conf =%7.0f. ",(double)(p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) );
+            Abc_Print( 1, "Cla =%9.0f. ", (double)Bmc_SolverClauseNum(p->pSat) );
+            Abc_Print( 1, "Conf =%7.0f. ",(double)Bmc_SolverConfNum(p->pSat) );
 //            Abc_Print( 1, "Imp =%10.0f. ", (double)p->pSat->stats.propagations );
 //            Abc_Print( 1, "Uni =%7.0f. ", (double)(p->pSat ? sat_solver_count_assigned(p->pSat) : 0) );
-            Abc_Print( 1, "Learn =%7.0f. ", (double)(p->pSat ? p->pSat->stats.learnts : p->pSat3 ? bmcg_sat_solver_learntnum(p->pSat3) : satoko_learntnum(p->pSat2)) );
+            Abc_Print( 1, "Learn =%7.0f. ", (double)Bmc_SolverLearntNum(p->pSat) );
             if ( pPars->fSolveAll )
                 Abc_Print( 1, "CEX =%5d. ", pPars->nFailOuts );
             if ( pPars->nTimeOutOne )
@@ -1853,7 +1754,7 @@ nTimeUndec += clkSatRun;
 //            ABC_PRT( "Time", Abc_Clock() - clk );
 //            Abc_Print( 1, "%4.0f MB",     4.0*Vec_IntSize(p->vVisited) /(1<<20) );
             Abc_Print( 1, "%4.0f MB",     4.0*(f+1)*p->nObjNums /(1<<20) );
-            Abc_Print( 1, "%4.0f MB",     1.0*(p->pSat ? sat_solver_memory(p->pSat) : 0)/(1<<20) );
+            Abc_Print( 1, "%4.0f MB",     1.0*(Saig_ManBmcBsat(p) ? sat_solver_memory(Saig_ManBmcBsat(p)) : 0)/(1<<20) );
 //            Abc_Print( 1, " %6d %6d ",   p->nLitUsed, p->nLitUseless );
             Abc_Print( 1, "%9.2f sec ",   1.0*(Abc_Clock() - clkTotal)/CLOCKS_PER_SEC );
 //            Abc_Print( 1, "\n" );
@@ -34,14 +34,16 @@
     #define l_Undef  0
     #define l_True   1
     #define l_False -1
-    #define bmc_sat_solver                     satoko_t
-    #define bmc_sat_solver_start(type)         satoko_create()
-    #define bmc_sat_solver_stop                satoko_destroy
-    #define bmc_sat_solver_addclause           satoko_add_clause
-    #define bmc_sat_solver_addvar(s)           satoko_add_variable(s, 0)
-    #define bmc_sat_solver_solve               satoko_solve_assumptions
-    #define bmc_sat_solver_read_cex_varvalue   satoko_read_cex_varvalue
-    #define bmc_sat_solver_setstop             satoko_set_stop
+    #define bmc_sat_solver                     Bmc_Solver_t
+    #define bmc_sat_solver_start(type)         Bmc_SolverStart(type)
+    #define bmc_sat_solver_stop                Bmc_SolverStop
+    #define bmc_sat_solver_addclause           Bmc_SolverAddClause
+    #define bmc_sat_solver_addvar              Bmc_SolverAddVar
+    #define bmc_sat_solver_solve               Bmc_SolverSolve
+    #define bmc_sat_solver_read_cex_varvalue   Bmc_SolverVarValue
+    #define bmc_sat_solver_setstop             Bmc_SolverSetStop
+    #define bmc_sat_solver_setstopfunc         Bmc_SolverSetStopFunc
+    #define bmc_sat_solver_setruntimelimit     Bmc_SolverSetRuntimeLimit
 #endif
 
 
@@ -368,7 +370,6 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     int i, Lit = Abc_Var2Lit( 0, 1 );
     satoko_opts_t opts;
     satoko_default_opts(&opts);
-    opts.conf_limit = pPars->nConfLimit;
     assert( Gia_ManRegNum(pGia) > 0 );
     p->pPars   = pPars;
     p->pGia    = pGia;
@@ -388,11 +389,14 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         opts.b_rst = 1.4 - i * 0.05;
         opts.garbage_max_ratio = (float) 0.3 + i * 0.05;
         // create SAT solvers
-        p->pSats[i] = bmc_sat_solver_start( i );  
 #ifdef ABC_USE_EXT_SOLVERS
+        p->pSats[i] = bmc_sat_solver_start( i );  
         p->pSats[i]->SolverType = i;
 #else
-        satoko_configure(p->pSats[i], &opts);
+        p->pSats[i] = bmc_sat_solver_start( pPars->nSolverType );  
+        if ( pPars->nSolverType == BMC_SOLVER_SATOKO )
+            satoko_configure( (satoko_t *)Bmc_SolverBackend(p->pSats[i]), &opts );
+        Bmc_SolverSetConfLimit( p->pSats[i], pPars->nConfLimit );
 #endif
         bmc_sat_solver_addvar( p->pSats[i] );
         bmc_sat_solver_addclause( p->pSats[i], &Lit, 1 );  
@@ -410,6 +414,12 @@ void Bmcs_ManStop( Bmcs_Man_t * p )
     Vec_PtrErase( &p->vGia2Fr );
     Vec_IntErase( &p->vFr2Sat );
     Vec_IntErase( &p->vCiMap );
+#ifndef ABC_USE_EXT_SOLVERS
+    if ( p->pPars->fSolverStats )
+        for ( i = 0; i < p->pPars->nProcs; i++ )
+            if ( p->pSats[i] ) 
+                Bmc_SolverPrintStats( p->pSats[i] );
+#endif
     for ( i = 0; i < p->pPars->nProcs; i++ )
         if ( p->pSats[i] ) 
             bmc_sat_solver_stop( p->pSats[i] );
@@ -583,10 +593,12 @@ void Bmcs_ManPrintFrame( Bmcs_Man_t * p, int f, int nClauses, int Solver, abctim
         return;
     Abc_Print( 1, "%4d %s : ", f,   fUnfinished ? "-" : "+" );
 #ifndef ABC_USE_EXT_SOLVERS
-    Abc_Print( 1, "Var =%8.0f.  ",  (double)satoko_varnum(p->pSats[0]) ); 
-    Abc_Print( 1, "Cla =%9.0f.  ",  (double)satoko_clausenum(p->pSats[0]) );  
-    Abc_Print( 1, "Learn =%9.0f.  ",(double)satoko_learntnum(p->pSats[0]) );  
-    Abc_Print( 1, "Conf =%9.0f.  ", (double)satoko_conflictnum(p->pSats[0]) );  
+    Abc_Print( 1, "Var =%8.0f.  ",  (double)Bmc_SolverVarNum(p->pSats[0]) ); 
+    Abc_Print( 1, "Cla =%9.0f.  ",  (double)Bmc_SolverClauseNum(p->pSats[0]) );  
+    if ( Bmc_SolverLearntNum(p->pSats[0]) >= 0 )
+    Abc_Print( 1, "Learn =%9.0f.  ",(double)Bmc_SolverLearntNum(p->pSats[0]) );  
+    if ( Bmc_SolverConfNum(p->pSats[0]) >= 0 )
+    Abc_Print( 1, "Conf =%9.0f.  ", (double)Bmc_SolverConfNum(p->pSats[0]) );  
 #else
     Abc_Print( 1, "Var =%8.0f.  ",  (double)p->nSatVars ); 
     Abc_Print( 1, "Cla =%9.0f.  ",  (double)nClauses );  
@@ -609,14 +621,14 @@ void Bmcs_ManPrintTime( Bmcs_Man_t * p )
     ABC_PRTP( "Other         ", p->timeOth,  clkTotal );
     ABC_PRTP( "TOTAL         ", clkTotal  ,  clkTotal );
 }
-Abc_Cex_t * Bmcs_ManGenerateCex( Bmcs_Man_t * p, int i, int f, int s )
+Abc_Cex_t * Bmcs_ManGenerateCex( Bmcs_Man_t * p, int i, int f, int s, int nSatVars )
 {
     Abc_Cex_t * pCex = Abc_CexMakeTriv( Gia_ManRegNum(p->pGia), Gia_ManPiNum(p->pGia), Gia_ManPoNum(p->pGia), f*Gia_ManPoNum(p->pGia)+i );
     Gia_Obj_t * pObj;  int k;
     Gia_ManForEachPi( p->pFrames, pObj, k )
     {
         int iSatVar = Vec_IntEntry( &p->vFr2Sat, Gia_ObjId(p->pFrames, pObj) );
-        if ( iSatVar > 0 && bmc_sat_solver_read_cex_varvalue(p->pSats[s], iSatVar) ) // 1 bit
+        if ( iSatVar > 0 && iSatVar < nSatVars && bmc_sat_solver_read_cex_varvalue(p->pSats[s], iSatVar) ) // 1 bit
         {
             int iCiId   = Vec_IntEntry( &p->vCiMap, 2*k+0 );
             int iFrame  = Vec_IntEntry( &p->vCiMap, 2*k+1 );
@@ -680,7 +692,7 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                 {
                     RetValue = 0;
                     pPars->iFrame = f+k;
-                    pGia->pCexSeq = Bmcs_ManGenerateCex( p, i, f+k, 0 );
+                    pGia->pCexSeq = Bmcs_ManGenerateCex( p, i, f+k, 0, p->nSatVars );
                     pPars->nFailOuts++;
                     Bmcs_ManPrintFrame( p, f+k, nClauses, -1, clkStart );
                     if ( !pPars->fNotVerbose )
@@ -726,6 +738,7 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 #ifndef ABC_USE_PTHREADS
 
 int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) { return Bmcs_ManPerformOne(pGia, pPars); }
+int Bmcs_ManPerformDepth( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) { return Bmcs_ManPerformOne(pGia, pPars); }
 
 #else // pthreads are used
 
@@ -871,7 +884,7 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                 {
                     RetValue = 0;
                     pPars->iFrame = f+k;
-                    pGia->pCexSeq = Bmcs_ManGenerateCex( p, i, f+k, Solver );
+                    pGia->pCexSeq = Bmcs_ManGenerateCex( p, i, f+k, Solver, p->nSatVars );
                     pPars->nFailOuts++;
                     Bmcs_ManPrintFrame( p, f+k, nClauses, Solver, clkStart );
                     if ( !pPars->fNotVerbose )
@@ -899,6 +912,8 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         ThData[i].pSat = NULL;
         ThData[i].fWorking = 1;
     }
+    for ( i = 0; i < pPars->nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
     p->timeOth = Abc_Clock() - clkStart - p->timeUnf - p->timeCnf - p->timeSat;
     if ( RetValue == -1 && !pPars->fNotVerbose )
         printf( "No output failed in %d frames.  ", f + (k < pPars->nFramesAdd ? k+1 : 0) );
@@ -908,6 +923,374 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Depth-parallel BMC.]
+
+  Description [The frames are divided into windows of nFramesAdd frames.
+  The calling thread is the only producer: it unrolls the windows one 
+  after another and derives the CNF of each window, staying at most nProcs 
+  windows ahead of the workers. Each of the nProcs worker threads owns 
+  one incremental solver. A worker takes the next window, loads the CNF 
+  of all windows up to this one into its solver, and checks the outputs
+  in the frames of the window. Thus different threads work on different 
+  depths at the same time. When an output fails (or a call is undecided),
+  the workers solving later windows are stopped, while the earlier windows
+  are completed, so that the failure in the earliest frame is reported.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Bmcs_Win_t_ Bmcs_Win_t;
+struct Bmcs_Win_t_
+{
+    int               iFrame;      // the first frame
+    int               nFrames;     // the number of frames
+    Cnf_Dat_t *       pCnf;        // the CNF of the frames (NULL if trivial or freed)
+    Vec_Int_t *       vLits;       // the output literals of the frames
+    int               nVarsEnd;    // the number of SAT variables after this window
+    int               nClauses;    // the number of clauses up to this window
+    int               nLoaded;     // the number of solvers, which loaded the CNF
+    int               Status;      // the status (l_Undef if not solved or undecided)
+    int               iOut;        // the failed output
+    int               iFrameFail;  // the failed frame
+    int               iThread;     // the thread solving this window
+    int               fSolved;     // the window is solved
+};
+
+typedef struct Bmcs_Dep_t_ Bmcs_Dep_t;
+typedef struct Bmcs_DepTh_t_ Bmcs_DepTh_t;
+struct Bmcs_DepTh_t_
+{
+    Bmcs_Dep_t *      pDep;        // the shared data
+    bmc_sat_solver *  pSat;        // the solver of this thread
+    int               iThread;     // the thread number
+    int               nWinsLoaded; // the number of windows loaded into the solver
+    int               nSatVars;    // the number of variables in the solver
+    int               iWin;        // the window being solved
+    int               fStop;       // the stop request for the solver
+    int               nWins;       // the number of windows solved
+    int               nCalls;      // the number of SAT calls
+    abctime           timeLoad;    // runtime of loading CNF
+    abctime           timeSat;     // runtime of the solver
+};
+struct Bmcs_Dep_t_
+{
+    Bmcs_Man_t *      p;           // the BMC manager
+    Bmcs_Win_t **     pWins;       // the windows
+    int               nWinsAlloc;  // the size of the window array
+    int               nProduced;   // the number of unrolled windows
+    int               nTaken;      // the number of windows given to the workers
+    int               nReported;   // the number of windows reported in order
+    int               iWinStop;    // the first window, which failed or was undecided
+    int               fDone;       // no more windows will be produced
+    abctime           clkStart;    // the starting time
+    Bmcs_DepTh_t      ThData[PAR_THR_MAX];
+    pthread_mutex_t   Mutex;       // protects the fields above
+    pthread_cond_t    CondWork;    // a new window is produced
+    pthread_cond_t    CondProd;    // a window is taken or solved
+};
+
+static int Bmcs_DepTimeOut( Bmcs_Dep_t * pDep )
+{
+    Bmc_AndPar_t * pPars = pDep->p->pPars;
+    if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+        return 1;
+    return pPars->nTimeOut && (Abc_Clock() - pDep->clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut;
+}
+// stops the solvers working on the windows after the given one (assumes the lock)
+static void Bmcs_DepStopAfter( Bmcs_Dep_t * pDep, int iWin )
+{
+    int k;
+    if ( pDep->iWinStop <= iWin )
+        return;
+    pDep->iWinStop = iWin;
+    for ( k = 0; k < pDep->p->pPars->nProcs; k++ )
+        if ( pDep->ThData[k].iWin > iWin )
+            pDep->ThData[k].fStop = 1;
+    pthread_cond_broadcast( &pDep->CondWork );
+    pthread_cond_broadcast( &pDep->CondProd );
+}
+// reports the frames solved in order (assumes the lock)
+// the user's callback is called by the worker threads, one at a time,
+// with the frames in increasing order, while the lock is held
+static void Bmcs_DepReport( Bmcs_Dep_t * pDep )
+{
+    Bmc_AndPar_t * pPars = pDep->p->pPars;
+    Bmcs_Win_t * pWin;
+    int k, i;
+    while ( pDep->nReported < pDep->nProduced )
+    {
+        pWin = pDep->pWins[pDep->nReported];
+        if ( !pWin->fSolved || pWin->Status != l_False )
+            break;
+        for ( k = 0; k < pWin->nFrames; k++ )
+        {
+            if ( pPars->fVerbose )
+            {
+                Abc_Print( 1, "%4d %s : ", pWin->iFrame + k, "+" );
+                Abc_Print( 1, "Var =%8.0f.  ",  (double)pWin->nVarsEnd ); 
+                Abc_Print( 1, "Cla =%9.0f.  ",  (double)pWin->nClauses );  
+                Abc_Print( 1, "T = %3d. ",      pWin->iThread );
+                Abc_Print( 1, "%9.2f sec  ",    (float)(Abc_Clock() - pDep->clkStart)/(float)(CLOCKS_PER_SEC) );
+                printf( "\n" );
+                fflush( stdout );
+            }
+            if ( pPars->pFuncOnFrameDone )
+                for ( i = 0; i < Gia_ManPoNum(pDep->p->pGia); i++ )
+                    pPars->pFuncOnFrameDone( pWin->iFrame + k, i, 0 );
+        }
+        pDep->nReported++;
+    }
+}
+// loads the CNF of the windows up to iWin into the solver of the thread
+static void Bmcs_DepLoad( Bmcs_DepTh_t * pTh, int iWin )
+{
+    Bmcs_Dep_t * pDep = pTh->pDep;
+    Bmcs_Win_t * pWin;
+    abctime clk = Abc_Clock();
+    int i;
+    for ( ; pTh->nWinsLoaded <= iWin; pTh->nWinsLoaded++ )
+    {
+        pthread_mutex_lock( &pDep->Mutex );
+        pWin = pDep->pWins[pTh->nWinsLoaded];
+        pthread_mutex_unlock( &pDep->Mutex );
+        for ( ; pTh->nSatVars < pWin->nVarsEnd; pTh->nSatVars++ )
+            bmc_sat_solver_addvar( pTh->pSat );
+        if ( pWin->pCnf )
+            for ( i = 0; i < pWin->pCnf->nClauses; i++ )
+                if ( !bmc_sat_solver_addclause( pTh->pSat, pWin->pCnf->pClauses[i], pWin->pCnf->pClauses[i+1]-pWin->pCnf->pClauses[i] ) )
+                    assert( 0 );
+        // the last solver to load the CNF frees it
+        pthread_mutex_lock( &pDep->Mutex );
+        if ( ++pWin->nLoaded == pDep->p->pPars->nProcs && pWin->pCnf )
+            Cnf_DataFree( pWin->pCnf ), pWin->pCnf = NULL;
+        pthread_mutex_unlock( &pDep->Mutex );
+    }
+    pTh->timeLoad += Abc_Clock() - clk;
+}
+void * Bmcs_DepWorkerThread( void * pArg )
+{
+    Bmcs_DepTh_t * pTh = (Bmcs_DepTh_t *)pArg;
+    Bmcs_Dep_t * pDep = pTh->pDep;
+    int nPos = Gia_ManPoNum(pDep->p->pGia);
+    Bmcs_Win_t * pWin;
+    int iWin, k, iLit, status;
+    abctime clk;
+    while ( 1 )
+    {
+        // take the next window
+        pthread_mutex_lock( &pDep->Mutex );
+        while ( pDep->nTaken == pDep->nProduced && !pDep->fDone && pDep->nTaken <= pDep->iWinStop )
+            pthread_cond_wait( &pDep->CondWork, &pDep->Mutex );
+        if ( pDep->nTaken == pDep->nProduced || pDep->nTaken > pDep->iWinStop )
+        {
+            pthread_mutex_unlock( &pDep->Mutex );
+            break;
+        }
+        iWin = pDep->nTaken++;
+        pWin = pDep->pWins[iWin];
+        pWin->iThread = pTh->iThread;
+        pTh->iWin  = iWin;
+        pTh->fStop = 0;
+        pthread_cond_signal( &pDep->CondProd );
+        pthread_mutex_unlock( &pDep->Mutex );
+        // load the CNF and check the outputs
+        Bmcs_DepLoad( pTh, iWin );
+        status = l_False;
+        Vec_IntForEachEntry( pWin->vLits, iLit, k )
+        {
+            if ( pTh->fStop || Bmcs_DepTimeOut(pDep) )
+            {
+                status = l_Undef;
+                break;
+            }
+            clk = Abc_Clock();
+            status = bmc_sat_solver_solve( pTh->pSat, &iLit, 1 );
+            pTh->timeSat += Abc_Clock() - clk;
+            pTh->nCalls++;
+            if ( status != l_False )
+                break;
+        }
+        pTh->nWins++;
+        // record the result
+        pthread_mutex_lock( &pDep->Mutex );
+        pWin->Status  = status;
+        pWin->fSolved = 1;
+        if ( status == l_True )
+        {
+            pWin->iFrameFail = pWin->iFrame + k / nPos;
+            pWin->iOut       = k % nPos;
+        }
+        if ( status != l_False )
+            Bmcs_DepStopAfter( pDep, iWin );
+        Bmcs_DepReport( pDep );
+        pTh->iWin = -1;
+        pthread_cond_signal( &pDep->CondProd );
+        pthread_mutex_unlock( &pDep->Mutex );
+        if ( status != l_False ) // the solver keeps the counter-example
+            break;
+    }
+    return NULL;
+}
+// unrolls the next window (called by the producer without the lock)
+static Bmcs_Win_t * Bmcs_DepProduce( Bmcs_Dep_t * pDep, int iFrame, int nFrames, int * pnClauses )
+{
+    Bmcs_Man_t * p = pDep->p;
+    Bmcs_Win_t * pWin = ABC_CALLOC( Bmcs_Win_t, 1 );
+    int k, i, iObj;
+    pWin->iFrame  = iFrame;
+    pWin->nFrames = nFrames;
+    pWin->Status  = l_Undef;
+    pWin->iThread = -1;
+    pWin->pCnf    = Bmcs_ManAddNewCnf( p, iFrame, nFrames );
+    pWin->vLits   = Vec_IntAlloc( nFrames * Gia_ManPoNum(p->pGia) );
+    if ( pWin->pCnf )
+    {
+        *pnClauses += pWin->pCnf->nClauses;
+        for ( k = 0; k < nFrames; k++ )
+        for ( i = 0; i < Gia_ManPoNum(p->pGia); i++ )
+        {
+            iObj = Gia_ObjId( p->pFrames, Gia_ManCo(p->pFrames, (iFrame+k) * Gia_ManPoNum(p->pGia) + i) );
+            Vec_IntPush( pWin->vLits, Abc_Var2Lit(Vec_IntEntry(&p->vFr2Sat, iObj), 0) );
+        }
+    }
+    p->nSatVarsOld = p->nSatVars;
+    pWin->nVarsEnd = p->nSatVars;
+    pWin->nClauses = *pnClauses;
+    return pWin;
+}
+int Bmcs_ManPerformDepth( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
+{
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Bmcs_Dep_t Dep, * pDep = &Dep;
+    Bmcs_Man_t * p = Bmcs_ManStart( pGia, pPars );
+    Bmcs_Win_t * pWin;
+    int i, status, iFrame = 0, nFrames, nClauses = 0, nFramesDone = 0, RetValue = -1;
+    int nWinFrames = Abc_MaxInt( pPars->nFramesAdd, 1 );
+    abctime timeLoad = 0;
+    Abc_CexFreeP( &pGia->pCexSeq );
+    memset( pDep, 0, sizeof(Bmcs_Dep_t) );
+    pDep->p          = p;
+    pDep->nWinsAlloc = 1000;
+    pDep->pWins      = ABC_CALLOC( Bmcs_Win_t *, pDep->nWinsAlloc );
+    pDep->iWinStop   = ABC_INFINITY;
+    pDep->clkStart   = Abc_Clock();
+    status = pthread_mutex_init( &pDep->Mutex, NULL );     assert( status == 0 );
+    status = pthread_cond_init( &pDep->CondWork, NULL );   assert( status == 0 );
+    status = pthread_cond_init( &pDep->CondProd, NULL );   assert( status == 0 );
+    if ( pPars->fVerbose )
+        printf( "Running depth-parallel BMC with %d threads and windows of %d frames.\n", pPars->nProcs, nWinFrames );
+    // start the workers
+    for ( i = 0; i < pPars->nProcs; i++ )
+    {
+        Bmcs_DepTh_t * pTh = pDep->ThData + i;
+        pTh->pDep     = pDep;
+        pTh->pSat     = p->pSats[i];
+        pTh->iThread  = i;
+        pTh->nSatVars = 1;
+        pTh->iWin     = -1;
+        bmc_sat_solver_setstop( pTh->pSat, &pTh->fStop );
+#ifndef ABC_USE_EXT_SOLVERS
+        // let the solvers stop in the middle of a call when the time is out or the caller stops the run
+        if ( pPars->pFuncStop )
+            bmc_sat_solver_setstopfunc( pTh->pSat, pPars->RunId, pPars->pFuncStop );
+        if ( pPars->nTimeOut )
+            bmc_sat_solver_setruntimelimit( pTh->pSat, pDep->clkStart + (abctime)pPars->nTimeOut * CLOCKS_PER_SEC );
+#endif
+        status = pthread_create( WorkerThread + i, NULL, Bmcs_DepWorkerThread, (void *)pTh );  assert( status == 0 );
+    }
+    // produce the windows
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pDep->Mutex );
+        while ( pDep->nProduced - pDep->nTaken >= pPars->nProcs && pDep->nProduced <= pDep->iWinStop && !Bmcs_DepTimeOut(pDep) )
+            pthread_cond_wait( &pDep->CondProd, &pDep->Mutex );
+        nFrames = pPars->nFramesMax ? Abc_MinInt( nWinFrames, pPars->nFramesMax - iFrame ) : nWinFrames;
+        if ( nFrames <= 0 || pDep->nProduced > pDep->iWinStop || Bmcs_DepTimeOut(pDep) )
+        {
+            pDep->fDone = 1;
+            pthread_cond_broadcast( &pDep->CondWork );
+            pthread_mutex_unlock( &pDep->Mutex );
+            break;
+        }
+        pthread_mutex_unlock( &pDep->Mutex );
+        pWin = Bmcs_DepProduce( pDep, iFrame, nFrames, &nClauses );
+        iFrame += nFrames;
+        pthread_mutex_lock( &pDep->Mutex );
+        if ( pDep->nProduced == pDep->nWinsAlloc )
+        {
+            pDep->pWins = ABC_REALLOC( Bmcs_Win_t *, pDep->pWins, 2 * pDep->nWinsAlloc );
+            pDep->nWinsAlloc *= 2;
+        }
+        pDep->pWins[pDep->nProduced++] = pWin;
+        pthread_cond_signal( &pDep->CondWork );
+        pthread_mutex_unlock( &pDep->Mutex );
+    }
+    for ( i = 0; i < pPars->nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    pthread_cond_destroy( &pDep->CondWork );
+    pthread_cond_destroy( &pDep->CondProd );
+    pthread_mutex_destroy( &pDep->Mutex );
+    // find the first window, which is not proved
+    for ( i = 0; i < pDep->nProduced; i++ )
+    {
+        pWin = pDep->pWins[i];
+        if ( !pWin->fSolved || pWin->Status != l_False )
+            break;
+        nFramesDone += pWin->nFrames;
+    }
+    if ( i < pDep->nProduced && pWin->Status == l_True )
+    {
+        Bmcs_DepTh_t * pTh = pDep->ThData + pWin->iThread;
+        RetValue = 0;
+        pPars->iFrame = pWin->iFrameFail;
+        pGia->pCexSeq = Bmcs_ManGenerateCex( p, pWin->iOut, pWin->iFrameFail, pWin->iThread, pTh->nSatVars );
+        pPars->nFailOuts++;
+        if ( !pPars->fNotVerbose )
+        {
+            int nOutDigits = Abc_Base10Log( Gia_ManPoNum(pGia) );
+            Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).  ",  
+                nOutDigits, pWin->iOut, pWin->iFrameFail, nOutDigits, pPars->nFailOuts, nOutDigits, Gia_ManPoNum(pGia) );
+            fflush( stdout );
+        }
+        if( pPars->pFuncOnFrameDone )
+            pPars->pFuncOnFrameDone( pWin->iFrameFail, pWin->iOut, 1 );
+    }
+    else 
+    {
+        pPars->iFrame = nFramesDone - 1;
+        if ( !pPars->fNotVerbose )
+            printf( "No output failed in %d frames.  ", nFramesDone );
+    }
+    Abc_PrintTime( 1, "Time", Abc_Clock() - pDep->clkStart );
+    if ( pPars->fVerbose )
+    {
+        for ( i = 0; i < pPars->nProcs; i++ )
+        {
+            Bmcs_DepTh_t * pTh = pDep->ThData + i;
+            printf( "Thread %2d : Windows = %5d.  Calls = %7d.  Vars = %8d.  ", i, pTh->nWins, pTh->nCalls, pTh->nSatVars );
+            printf( "Load = %7.2f sec.  SAT = %9.2f sec.\n", 1.0*pTh->timeLoad/CLOCKS_PER_SEC, 1.0*pTh->timeSat/CLOCKS_PER_SEC );
+            p->timeSat = Abc_MaxInt( p->timeSat, pTh->timeSat );
+            timeLoad += pTh->timeLoad;
+        }
+        printf( "Proved %d frames (%.0f frames per hour).  ", nFramesDone, 3600.0 * nFramesDone * CLOCKS_PER_SEC / Abc_MaxInt(1, Abc_Clock() - pDep->clkStart) );
+        Abc_PrintTime( 1, "Unfolding and CNF", p->timeUnf + p->timeCnf );
+    }
+    for ( i = 0; i < pDep->nProduced; i++ )
+    {
+        if ( pDep->pWins[i]->pCnf )
+            Cnf_DataFree( pDep->pWins[i]->pCnf );
+        Vec_IntFree( pDep->pWins[i]->vLits );
+        ABC_FREE( pDep->pWins[i] );
+    }
+    ABC_FREE( pDep->pWins );
+    Bmcs_ManStop( p );
+    return RetValue;
+}
+
 #endif // pthreads are used
 
 
@@ -927,6 +1310,8 @@ int Bmcs_ManPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     assert( pPars->nProcs < PAR_THR_MAX );
     if ( pPars->nProcs == 1 )
         return Bmcs_ManPerformOne( pGia, pPars );
+    else if ( pPars->fParDepth )
+        return Bmcs_ManPerformDepth( pGia, pPars );
     else
         return Bmcs_ManPerformMulti( pGia, pPars );
 }
@@ -0,0 +1,468 @@
+/**CFile****************************************************************
+
+  FileName    [bmcSolver.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Uniform interface to the incremental SAT solvers.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/satoko/satoko.h"
+#include "sat/glucose2/AbcGlucose2.h"
+#include "sat/cadical/cadicalSolver.h"
+#include "sat/cadical/ccadical.h"
+#include "sat/kissat/kissatSolver.h"
+#include "sat/kissat/kissat.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The engine talks to the solver through a table of functions selected
+// at runtime. All backends use ABC literals (2*Var+Compl) and return
+// 1 (SAT), -1 (UNSAT) or 0 (undecided) from the solve call.
+
+#define BMC_SOLVER_HIST 24   // latency histogram buckets (log2 of microseconds)
+
+typedef struct Bmc_SolverFuncs_t_ Bmc_SolverFuncs_t;
+struct Bmc_SolverFuncs_t_
+{
+    char *      pName;
+    void *      (*pStart)    ( void );
+    void        (*pStop)     ( void * );
+    int         (*pAddVar)   ( void * );
+    int         (*pAddClause)( void *, int *, int );
+    int         (*pSolve)    ( void *, int *, int, int );
+    int         (*pVarValue) ( void *, int );
+    int         (*pFinal)    ( void *, int ** );
+    int         (*pConfNum)  ( void * );
+    int         (*pLearntNum)( void * );
+    void        (*pSetStop)  ( void *, Bmc_Solver_t * );
+};
+
+struct Bmc_Solver_t_
+{
+    int                 Type;       // backend type
+    Bmc_SolverFuncs_t * pFuncs;     // backend functions
+    void *              pSat;       // backend solver
+    int                 nVars;      // the number of variables
+    int                 nClauses;   // the number of clauses
+    int                 nConfLimit; // conflict limit of one call (0 = no limit)
+    int                 nCalls;     // the number of solver calls
+    int                 nCallsRes[3]; // the number of UNSAT, undecided, SAT calls
+    abctime             timeSat;    // runtime of the solver calls
+    int                 Hist[BMC_SOLVER_HIST]; // latency histogram
+    // the conditions to stop a solver call
+    int *               pStop;      // external stop flag
+    int                 RunId;      // the ID of the run checked by pFuncStop
+    int              (* pFuncStop)(int); // returns 1 if the run should stop
+    abctime             nTimeToStop; // the runtime limit (0 = no limit)
+};
+
+// Kissat is not incremental: the clauses are recorded and the problem
+// is solved from scratch with the assumptions added as unit clauses
+typedef struct Bmc_SolverKis_t_ Bmc_SolverKis_t;
+struct Bmc_SolverKis_t_
+{
+    kissat_solver *     pSat;       // the last solver (holds the model)
+    Vec_Int_t *         vClauses;   // clauses terminated by -1
+    Vec_Int_t *         vAssump;    // assumptions of the last call
+    int                 nVars;      // the number of variables
+    Bmc_Solver_t *      pOwner;     // the solver holding the stop conditions
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Backend wrappers.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Bmc_SolverBsatStart( void )                        { return sat_solver_new();                                                      }
+static void   Bmc_SolverBsatStop( void * p )                     { sat_solver_delete( (sat_solver *)p );                                         }
+static int    Bmc_SolverBsatAddVar( void * p )                   { return sat_solver_addvar( (sat_solver *)p );                                  }
+static int    Bmc_SolverBsatAddClause( void * p, int * pLits, int nLits ) { return sat_solver_addclause( (sat_solver *)p, pLits, pLits + nLits ); }
+static int    Bmc_SolverBsatSolve( void * p, int * pLits, int nLits, int nConfLimit ) { return sat_solver_solve( (sat_solver *)p, pLits, pLits + nLits, (ABC_INT64_T)nConfLimit, 0, 0, 0 ); }
+static int    Bmc_SolverBsatVarValue( void * p, int v )          { return sat_solver_var_value( (sat_solver *)p, v );                            }
+static int    Bmc_SolverBsatFinal( void * p, int ** ppArray )    { return sat_solver_final( (sat_solver *)p, ppArray );                          }
+static int    Bmc_SolverBsatConfNum( void * p )                  { return sat_solver_nconflicts( (sat_solver *)p );                              }
+static int    Bmc_SolverBsatLearntNum( void * p )                { return (int)((sat_solver *)p)->stats.learnts;                                 }
+static void   Bmc_SolverBsatSetStop( void * p, Bmc_Solver_t * s )
+{
+    sat_solver_set_stop( (sat_solver *)p, s->pStop );
+    sat_solver_set_runid( (sat_solver *)p, s->RunId );
+    sat_solver_set_stop_func( (sat_solver *)p, s->pFuncStop );
+    sat_solver_set_runtime_limit( (sat_solver *)p, s->nTimeToStop );
+}
+
+static void * Bmc_SolverSatokoStart( void )                      { return satoko_create();                                                       }
+static void   Bmc_SolverSatokoStop( void * p )                   { satoko_destroy( (satoko_t *)p );                                              }
+static int    Bmc_SolverSatokoAddVar( void * p )                 { return satoko_add_variable( (satoko_t *)p, 0 );                               }
+static int    Bmc_SolverSatokoAddClause( void * p, int * pLits, int nLits ) { return satoko_add_clause( (satoko_t *)p, pLits, nLits );         }
+static int    Bmc_SolverSatokoSolve( void * p, int * pLits, int nLits, int nConfLimit ) { return satoko_solve_assumptions_limit( (satoko_t *)p, pLits, nLits, nConfLimit ); }
+static int    Bmc_SolverSatokoVarValue( void * p, int v )        { return satoko_read_cex_varvalue( (satoko_t *)p, v );                          }
+static int    Bmc_SolverSatokoFinal( void * p, int ** ppArray )  { return satoko_final_conflict( (satoko_t *)p, ppArray );                       }
+static int    Bmc_SolverSatokoConfNum( void * p )                { return satoko_conflictnum( (satoko_t *)p );                                   }
+static int    Bmc_SolverSatokoLearntNum( void * p )              { return satoko_learntnum( (satoko_t *)p );                                     }
+static void   Bmc_SolverSatokoSetStop( void * p, Bmc_Solver_t * s )
+{
+    satoko_set_stop( (satoko_t *)p, s->pStop );
+    satoko_set_runid( (satoko_t *)p, s->RunId );
+    satoko_set_stop_func( (satoko_t *)p, s->pFuncStop );
+    satoko_set_runtime_limit( (satoko_t *)p, s->nTimeToStop );
+}
+
+static void * Bmc_SolverGlucoseStart( void )                     { return bmcg2_sat_solver_start();                                              }
+static void   Bmc_SolverGlucoseStop( void * p )                  { bmcg2_sat_solver_stop( (bmcg2_sat_solver *)p );                               }
+static int    Bmc_SolverGlucoseAddVar( void * p )                { return bmcg2_sat_solver_addvar( (bmcg2_sat_solver *)p );                      }
+static int    Bmc_SolverGlucoseAddClause( void * p, int * pLits, int nLits ) { return bmcg2_sat_solver_addclause( (bmcg2_sat_solver *)p, pLits, nLits ); }
+static int    Bmc_SolverGlucoseVarValue( void * p, int v )       { return bmcg2_sat_solver_read_cex_varvalue( (bmcg2_sat_solver *)p, v );        }
+static int    Bmc_SolverGlucoseFinal( void * p, int ** ppArray ) { return bmcg2_sat_solver_final( (bmcg2_sat_solver *)p, ppArray );              }
+static int    Bmc_SolverGlucoseConfNum( void * p )               { return bmcg2_sat_solver_conflictnum( (bmcg2_sat_solver *)p );                 }
+static int    Bmc_SolverGlucoseLearntNum( void * p )             { return bmcg2_sat_solver_learntnum( (bmcg2_sat_solver *)p );                   }
+static void   Bmc_SolverGlucoseSetStop( void * p, Bmc_Solver_t * s )
+{
+    // Glucose has no stop function
+    bmcg2_sat_solver_set_stop( (bmcg2_sat_solver *)p, s->pStop );
+    bmcg2_sat_solver_set_runtime_limit( (bmcg2_sat_solver *)p, s->nTimeToStop );
+}
+static int    Bmc_SolverGlucoseSolve( void * p, int * pLits, int nLits, int nConfLimit )
+{
+    bmcg2_sat_solver_set_conflict_budget( (bmcg2_sat_solver *)p, nConfLimit );
+    return bmcg2_sat_solver_solve( (bmcg2_sat_solver *)p, pLits, nLits );
+}
+
+// the callback of the solvers that poll the caller for termination
+static int    Bmc_SolverStopCheck( void * pSolver )
+{
+    Bmc_Solver_t * s = (Bmc_Solver_t *)pSolver;
+    if ( s->pStop && *s->pStop )
+        return 1;
+    if ( s->pFuncStop && s->pFuncStop(s->RunId) )
+        return 1;
+    return s->nTimeToStop && Abc_Clock() > s->nTimeToStop;
+}
+static void * Bmc_SolverCadicalStart( void )
+{
+    // bounded variable addition introduces variables following the largest one,
+    // which clash with the variables that the engine numbers itself
+    cadical_solver * pSat = cadical_solver_new();
+    ccadical_set_option( (CCaDiCaL *)pSat->p, "factor", 0 );
+    return pSat;
+}
+static void   Bmc_SolverCadicalStop( void * p )                  { cadical_solver_delete( (cadical_solver *)p );                                 }
+static int    Bmc_SolverCadicalAddVar( void * p )
+{
+    // the variable may appear in the clauses added later, so it should not be eliminated
+    int iVar = cadical_solver_addvar( (cadical_solver *)p );
+    ccadical_freeze( (CCaDiCaL *)((cadical_solver *)p)->p, iVar + 1 );
+    return iVar;
+}
+static int    Bmc_SolverCadicalAddClause( void * p, int * pLits, int nLits ) { return cadical_solver_addclause( (cadical_solver *)p, pLits, pLits + nLits ); }
+static int    Bmc_SolverCadicalSolve( void * p, int * pLits, int nLits, int nConfLimit ) { return cadical_solver_solve( (cadical_solver *)p, pLits, pLits + nLits, (ABC_INT64_T)nConfLimit, 0, 0, 0 ); }
+static int    Bmc_SolverCadicalVarValue( void * p, int v )       { return cadical_solver_get_var_value( (cadical_solver *)p, v );                }
+static int    Bmc_SolverCadicalFinal( void * p, int ** ppArray ) { return cadical_solver_final( (cadical_solver *)p, ppArray );                  }
+static int    Bmc_SolverCadicalConfNum( void * p )               { return -1;                                                                    }
+static int    Bmc_SolverCadicalLearntNum( void * p )             { return -1;                                                                    }
+static void   Bmc_SolverCadicalSetStop( void * p, Bmc_Solver_t * s ) { ccadical_set_terminate( (CCaDiCaL *)((cadical_solver *)p)->p, s, Bmc_SolverStopCheck ); }
+
+static void * Bmc_SolverKissatStart( void )
+{
+    Bmc_SolverKis_t * p = ABC_CALLOC( Bmc_SolverKis_t, 1 );
+    p->vClauses = Vec_IntAlloc( 1000 );
+    p->vAssump  = Vec_IntAlloc( 100 );
+    return p;
+}
+static void   Bmc_SolverKissatStop( void * pKis )
+{
+    Bmc_SolverKis_t * p = (Bmc_SolverKis_t *)pKis;
+    if ( p->pSat )
+        kissat_solver_delete( p->pSat );
+    Vec_IntFree( p->vClauses );
+    Vec_IntFree( p->vAssump );
+    ABC_FREE( p );
+}
+static int    Bmc_SolverKissatAddVar( void * p )                 { return ((Bmc_SolverKis_t *)p)->nVars++;                                       }
+static int    Bmc_SolverKissatAddClause( void * pKis, int * pLits, int nLits )
+{
+    Bmc_SolverKis_t * p = (Bmc_SolverKis_t *)pKis;
+    Vec_IntPushArray( p->vClauses, pLits, nLits );
+    Vec_IntPush( p->vClauses, -1 );
+    return 1;
+}
+static int    Bmc_SolverKissatSolve( void * pKis, int * pLits, int nLits, int nConfLimit )
+{
+    Bmc_SolverKis_t * p = (Bmc_SolverKis_t *)pKis;
+    int i, iBeg = 0, Entry;
+    if ( p->pSat )
+        kissat_solver_delete( p->pSat );
+    p->pSat = kissat_solver_new();
+    kissat_solver_setnvars( p->pSat, p->nVars );
+    if ( p->pOwner )
+        kissat_set_terminate( (kissat *)p->pSat->p, p->pOwner, Bmc_SolverStopCheck );
+    Vec_IntForEachEntry( p->vClauses, Entry, i )
+        if ( Entry == -1 )
+        {
+            kissat_solver_addclause( p->pSat, Vec_IntEntryP(p->vClauses, iBeg), Vec_IntEntryP(p->vClauses, i) );
+            iBeg = i + 1;
+        }
+    Vec_IntClear( p->vAssump );
+    for ( i = 0; i < nLits; i++ )
+    {
+        kissat_solver_addclause( p->pSat, pLits + i, pLits + i + 1 );
+        Vec_IntPush( p->vAssump, Abc_LitNot(pLits[i]) );
+    }
+    return kissat_solver_solve( p->pSat, NULL, NULL, (ABC_INT64_T)nConfLimit, 0, 0, 0 );
+}
+static int    Bmc_SolverKissatVarValue( void * p, int v )        { return kissat_solver_get_var_value( ((Bmc_SolverKis_t *)p)->pSat, v );        }
+static int    Bmc_SolverKissatFinal( void * p, int ** ppArray )
+{
+    // no core is available; all assumptions are returned
+    *ppArray = Vec_IntArray( ((Bmc_SolverKis_t *)p)->vAssump );
+    return Vec_IntSize( ((Bmc_SolverKis_t *)p)->vAssump );
+}
+static int    Bmc_SolverKissatConfNum( void * p )                { return -1;                                                                    }
+static int    Bmc_SolverKissatLearntNum( void * p )              { return -1;                                                                    }
+static void   Bmc_SolverKissatSetStop( void * p, Bmc_Solver_t * s ) { ((Bmc_SolverKis_t *)p)->pOwner = s;                                         }
+
+static Bmc_SolverFuncs_t s_BmcSolverFuncs[BMC_SOLVER_NUM] = {
+    { "bsat",    Bmc_SolverBsatStart,    Bmc_SolverBsatStop,    Bmc_SolverBsatAddVar,    Bmc_SolverBsatAddClause,    Bmc_SolverBsatSolve,    Bmc_SolverBsatVarValue,    Bmc_SolverBsatFinal,    Bmc_SolverBsatConfNum,    Bmc_SolverBsatLearntNum,    Bmc_SolverBsatSetStop    },
+    { "satoko",  Bmc_SolverSatokoStart,  Bmc_SolverSatokoStop,  Bmc_SolverSatokoAddVar,  Bmc_SolverSatokoAddClause,  Bmc_SolverSatokoSolve,  Bmc_SolverSatokoVarValue,  Bmc_SolverSatokoFinal,  Bmc_SolverSatokoConfNum,  Bmc_SolverSatokoLearntNum,  Bmc_SolverSatokoSetStop  },
+    { "glucose", Bmc_SolverGlucoseStart, Bmc_SolverGlucoseStop, Bmc_SolverGlucoseAddVar, Bmc_SolverGlucoseAddClause, Bmc_SolverGlucoseSolve, Bmc_SolverGlucoseVarValue, Bmc_SolverGlucoseFinal, Bmc_SolverGlucoseConfNum, Bmc_SolverGlucoseLearntNum, Bmc_SolverGlucoseSetStop },
+    { "cadical", Bmc_SolverCadicalStart, Bmc_SolverCadicalStop, Bmc_SolverCadicalAddVar, Bmc_SolverCadicalAddClause, Bmc_SolverCadicalSolve, Bmc_SolverCadicalVarValue, Bmc_SolverCadicalFinal, Bmc_SolverCadicalConfNum, Bmc_SolverCadicalLearntNum, Bmc_SolverCadicalSetStop },
+    { "kissat",  Bmc_SolverKissatStart,  Bmc_SolverKissatStop,  Bmc_SolverKissatAddVar,  Bmc_SolverKissatAddClause,  Bmc_SolverKissatSolve,  Bmc_SolverKissatVarValue,  Bmc_SolverKissatFinal,  Bmc_SolverKissatConfNum,  Bmc_SolverKissatLearntNum,  Bmc_SolverKissatSetStop  }
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Converts between the solver type and its name.]
+
+  Description [Returns -1 if the name is not known.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_SolverTypeFromName( char * pName )
+{
+    int i;
+    for ( i = 0; i < BMC_SOLVER_NUM; i++ )
+        if ( !strcmp(pName, s_BmcSolverFuncs[i].pName) )
+            return i;
+    if ( !strcmp(pName, "glucose2") )
+        return BMC_SOLVER_GLUCOSE;
+    return -1;
+}
+char * Bmc_SolverTypeName( int Type )
+{
+    assert( Type >= 0 && Type < BMC_SOLVER_NUM );
+    return s_BmcSolverFuncs[Type].pName;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the solver.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_Solver_t * Bmc_SolverStart( int Type )
+{
+    Bmc_Solver_t * p;
+    assert( Type >= 0 && Type < BMC_SOLVER_NUM );
+    p = ABC_CALLOC( Bmc_Solver_t, 1 );
+    p->Type   = Type;
+    p->pFuncs = s_BmcSolverFuncs + Type;
+    p->pSat   = p->pFuncs->pStart();
+    return p;
+}
+void Bmc_SolverStop( Bmc_Solver_t * p )
+{
+    p->pFuncs->pStop( p->pSat );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solver interface.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_SolverType( Bmc_Solver_t * p )
+{
+    return p->Type;
+}
+void * Bmc_SolverBackend( Bmc_Solver_t * p )
+{
+    return p->pSat;
+}
+int Bmc_SolverAddVar( Bmc_Solver_t * p )
+{
+    p->nVars++;
+    return p->pFuncs->pAddVar( p->pSat );
+}
+int Bmc_SolverAddClause( Bmc_Solver_t * p, int * pLits, int nLits )
+{
+    p->nClauses++;
+    return p->pFuncs->pAddClause( p->pSat, pLits, nLits );
+}
+void Bmc_SolverSetConfLimit( Bmc_Solver_t * p, int nConfLimit )
+{
+    p->nConfLimit = nConfLimit;
+}
+int Bmc_SolverSolve( Bmc_Solver_t * p, int * pLits, int nLits )
+{
+    abctime clk = Abc_Clock();
+    word Micro; int Bucket = 0;
+    int status = p->pFuncs->pSolve( p->pSat, pLits, nLits, p->nConfLimit );
+    clk = Abc_Clock() - clk;
+    p->timeSat += clk;
+    p->nCalls++;
+    p->nCallsRes[status + 1]++;
+    Micro = (word)(1000000.0 * clk / CLOCKS_PER_SEC);
+    while ( Micro > 1 && Bucket < BMC_SOLVER_HIST - 1 )
+        Micro >>= 1, Bucket++;
+    p->Hist[Bucket]++;
+    return status;
+}
+int Bmc_SolverVarValue( Bmc_Solver_t * p, int v )
+{
+    return p->pFuncs->pVarValue( p->pSat, v );
+}
+int Bmc_SolverFinal( Bmc_Solver_t * p, int ** ppArray )
+{
+    return p->pFuncs->pFinal( p->pSat, ppArray );
+}
+int Bmc_SolverVarNum( Bmc_Solver_t * p )
+{
+    return p->nVars;
+}
+int Bmc_SolverClauseNum( Bmc_Solver_t * p )
+{
+    return p->nClauses;
+}
+int Bmc_SolverConfNum( Bmc_Solver_t * p )
+{
+    return p->pFuncs->pConfNum( p->pSat );
+}
+int Bmc_SolverLearntNum( Bmc_Solver_t * p )
+{
+    return p->pFuncs->pLearntNum( p->pSat );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the conditions to stop the solver calls.]
+
+  Description [A call stops when the flag pStop is set, when pFuncStop
+  returns 1 for RunId, or when the clock reaches nTimeToStop. Glucose
+  does not check the stop function. Returns the previous runtime limit.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_SolverSetStop( Bmc_Solver_t * p, int * pStop )
+{
+    p->pStop = pStop;
+    p->pFuncs->pSetStop( p->pSat, p );
+}
+void Bmc_SolverSetStopFunc( Bmc_Solver_t * p, int RunId, int (*pFuncStop)(int) )
+{
+    p->RunId = RunId;
+    p->pFuncStop = pFuncStop;
+    p->pFuncs->pSetStop( p->pSat, p );
+}
+abctime Bmc_SolverSetRuntimeLimit( Bmc_Solver_t * p, abctime nTimeToStop )
+{
+    abctime nTimeOld = p->nTimeToStop;
+    p->nTimeToStop = nTimeToStop;
+    p->pFuncs->pSetStop( p->pSat, p );
+    return nTimeOld;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the statistics of the solver calls.]
+
+  Description [The histogram shows the number of calls whose runtime
+  falls into the range [2^k, 2^(k+1)) microseconds.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_SolverPrintStats( Bmc_Solver_t * p )
+{
+    int i, Max = 0, nFirst = -1, nLast = -1;
+    Abc_Print( 1, "Solver %-8s: Calls = %d (SAT = %d  UNSAT = %d  Undec = %d)  ",
+        p->pFuncs->pName, p->nCalls, p->nCallsRes[2], p->nCallsRes[0], p->nCallsRes[1] );
+    Abc_PrintTime( 1, "Time", p->timeSat );
+    for ( i = 0; i < BMC_SOLVER_HIST; i++ )
+        if ( p->Hist[i] )
+        {
+            Max = Abc_MaxInt( Max, p->Hist[i] );
+            nLast = i;
+            if ( nFirst == -1 )
+                nFirst = i;
+        }
+    for ( i = nFirst; i >= 0 && i <= nLast; i++ )
+    {
+        int k, nStars = Max ? (50 * p->Hist[i] + Max - 1) / Max : 0;
+        if ( i < 10 )
+            Abc_Print( 1, "  %6d us ", 1 << i );
+        else if ( i < 20 )
+            Abc_Print( 1, "  %6d ms ", 1 << (i - 10) );
+        else
+            Abc_Print( 1, "  %6d s  ", 1 << (i - 20) );
+        Abc_Print( 1, ": %8d  ", p->Hist[i] );
+        for ( k = 0; k < nStars; k++ )
+            Abc_Print( 1, "*" );
+        Abc_Print( 1, "\n" );
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
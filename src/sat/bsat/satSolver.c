@@ -133,6 +133,18 @@ int sat_solver_get_var_value(sat_solver* s, int v)
 static inline int      sat_solver_dl(sat_solver* s)                { return veci_size(&s->trail_lim); }
 static inline veci*    sat_solver_read_wlist(sat_solver* s, lit l) { return &s->wlists[l];            }
 
+// A watcher of a two-literal clause is one entry (the other literal, see clause_from_lit()).
+// A watcher of a longer clause is two entries: the clause handle (always even) followed 
+// by the blocker literal, which is one of the literals of the clause. If the blocker
+// is true, the clause is satisfied and propagation skips it without touching the clause.
+static inline void     sat_solver_watch(sat_solver* s, lit l, cla h, lit blocker)
+{
+    veci* ws = sat_solver_read_wlist(s,l);
+    assert( !clause_is_lit(h) );
+    veci_push(ws, h);
+    veci_push(ws, blocker);
+}
+
 //=================================================================================================
 // Variable order functions:
 
@@ -455,6 +467,12 @@ static inline void act_clause_bump(sat_solver* s, clause *c)
             act_clause_rescale(s);
     }
 }
+// marks the learned clause as used in the derivation of other clauses
+static inline void sat_solver_store_used(sat_solver* s, clause *c) 
+{
+    if ( s->fStoreTrim )
+        veci_begin(&s->store_ids)[c->lits[c->size]] |= 1;
+}
 static inline void act_clause_decay(sat_solver* s)    
 { 
     if ( s->ClaActType == 0 )
@@ -587,8 +605,16 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
 
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),c);
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),c);
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(size > 2 ? h : clause_from_lit(begin[1])));
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(size > 2 ? h : clause_from_lit(begin[0])));
+    if ( size > 2 )
+    {
+        sat_solver_watch(s, lit_neg(begin[0]), h, begin[1]);
+        sat_solver_watch(s, lit_neg(begin[1]), h, begin[0]);
+    }
+    else
+    {
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),clause_from_lit(begin[1]));
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),clause_from_lit(begin[0]));
+    }
 
     return h;
 }
@@ -730,6 +756,13 @@ static void sat_solver_record(sat_solver* s, veci* cls)
         int RetValue = Sto_ManAddClause( (Sto_Man_t *)s->pStore, begin, end );
         assert( RetValue );
         (void) RetValue;
+        // remember where the learned clause is logged (clauses outside of the log are never trimmed)
+        if ( h && s->fStoreTrim )
+        {
+            Sto_Man_t * pStore = (Sto_Man_t *)s->pStore;
+            assert( veci_size(&s->store_ids) == clause_id(clause_read(s, h)) );
+            veci_push( &s->store_ids, Sto_ManIsLogging(pStore) ? Sto_ManLogLast(pStore) << 1 : 1 );
+        }
     }
     ///////////////////////////////////
 /*
@@ -792,6 +825,8 @@ static int sat_solver_lit_removable(sat_solver* s, int x, int minl)
             clause* c = clause_read(s, s->reasons[v]);
             lit* lits = clause_begin(c);
             int  i;
+            if (clause_learnt(c))
+                sat_solver_store_used(s,c);
             for (i = 1; i < clause_size(c); i++){
                 int v = lit_var(lits[i]);
                 if (!var_tag(s,v) && var_level(s, v)){
@@ -895,6 +930,8 @@ static void sat_solver_analyze_final(sat_solver* s, int hConf, int skip_first)
                 else{
                     clause* c = clause_read(s, s->reasons[x]);
                     int* lits = clause_begin(c);
+                    if (clause_learnt(c))
+                        sat_solver_store_used(s,c);
                     for (j = 1; j < clause_size(c); j++)
                         if (var_level(s, lit_var(lits[j])) > 0)
                             var_set_tag(s, lit_var(lits[j]), 1);
@@ -932,7 +969,10 @@ static void sat_solver_analyze(sat_solver* s, int h, veci* learnt)
             clause* c = clause_read(s, h);
             
             if (clause_learnt(c))
+            {
                 act_clause_bump(s,c);
+                sat_solver_store_used(s,c);
+            }
             lits = clause_begin(c);
             //printlits(lits,lits+clause_size(c)); printf("\n");
             for (j = (p == lit_Undef ? 0 : 1); j < clause_size(c); j++){
@@ -1077,9 +1117,20 @@ int sat_solver_propagate(sat_solver* s)
                     while (i < end)
                         *j++ = *i++;
                 }
+                else
+                    i++;
             }else{
 
-                clause* c = clause_read(s,*i);
+                clause* c;
+                lit blocker = i[1];
+                // If the blocker is true, then clause is already satisfied.
+                if (var_value(s, lit_var(blocker)) == lit_sign(blocker)){
+                    *j++ = *i++;
+                    *j++ = *i++;
+                    continue;
+                }
+
+                c = clause_read(s,*i);
                 lits = clause_begin(c);
 
                 // Make sure the false literal is data[1]:
@@ -1091,8 +1142,11 @@ int sat_solver_propagate(sat_solver* s)
                 assert(lits[1] == false_lit);
 
                 // If 0th watch is true, then clause is already satisfied.
-                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0]))
+                if (lits[0] != blocker && var_value(s, lit_var(lits[0])) == lit_sign(lits[0])){
                     *j++ = *i;
+                    *j++ = lits[0];
+                    i += 2;
+                }
                 else{
                     // Look for new watch:
                     lit* stop = lits + clause_size(c);
@@ -1101,24 +1155,29 @@ int sat_solver_propagate(sat_solver* s)
                         if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
                             lits[1] = *k;
                             *k = false_lit;
-                            veci_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i);
+                            sat_solver_watch(s, lit_neg(lits[1]), *i, lits[0]);
                             goto next; }
                     }
 
                     *j++ = *i;
+                    *j++ = lits[0];
                     // Clause is unit under assignment:
                     if ( c->lrn )
                         c->lbd = sat_clause_compute_lbd(s, c);
                     if (!sat_solver_enqueue(s,lits[0], *i)){
-                        hConfl = *i++;
+                        hConfl = *i;
+                        i += 2;
                         // Copy the remaining watches:
                         while (i < end)
                             *j++ = *i++;
                     }
+                    else
+                        i += 2;
                 }
+                continue;
+            next:
+                i += 2;
             }
-        next:
-            i++;
         }
 
         s->stats.inspects += j - veci_begin(ws);
@@ -1155,6 +1214,7 @@ sat_solver* sat_solver_new(void)
     veci_new(&s->tagged);
 //    veci_new(&s->learned);
     veci_new(&s->act_clas);
+    veci_new(&s->store_ids);
     veci_new(&s->stack);
 //    veci_new(&s->model);
     veci_new(&s->unit_lits);
@@ -1220,6 +1280,7 @@ sat_solver* zsat_solver_new_seed(double seed)
     veci_new(&s->tagged);
 //    veci_new(&s->learned);
     veci_new(&s->act_clas);
+    veci_new(&s->store_ids);
     veci_new(&s->stack);
 //    veci_new(&s->model);
     veci_new(&s->unit_lits);
@@ -1349,6 +1410,7 @@ void sat_solver_delete(sat_solver* s)
     veci_delete(&s->tagged);
 //    veci_delete(&s->learned);
     veci_delete(&s->act_clas);
+    veci_delete(&s->store_ids);
     veci_delete(&s->stack);
 //    veci_delete(&s->model);
     veci_delete(&s->act_vars);
@@ -1411,6 +1473,7 @@ void sat_solver_restart( sat_solver* s )
     // variable activities
     solver_init_activities(s);
     veci_resize(&s->act_clas, 0);
+    veci_resize(&s->store_ids, 0);
 
 
     s->root_level             = 0;
@@ -1455,6 +1518,7 @@ void zsat_solver_restart_seed( sat_solver* s, double seed )
 
     solver_init_activities(s);
     veci_resize(&s->act_clas, 0);
+    veci_resize(&s->store_ids, 0);
 
     s->root_level             = 0;
 //    s->simpdb_assigns         = 0;
@@ -1506,6 +1570,7 @@ double sat_solver_memory( sat_solver* s )
     Mem += s->act_vars.cap * sizeof(int);
     Mem += s->unit_lits.cap * sizeof(int);
     Mem += s->act_clas.cap * sizeof(int);
+    Mem += s->store_ids.cap * sizeof(int);
     Mem += s->temp_clause.cap * sizeof(int);
     Mem += s->conf_final.cap * sizeof(int);
     Mem += Sat_MemMemoryAll( &s->Mem );
@@ -1527,6 +1592,7 @@ void sat_solver_reducedb(sat_solver* s)
     Sat_Mem_t * pMem = &s->Mem;
     int nLearnedOld = veci_size(&s->act_clas);
     int * act_clas = veci_begin(&s->act_clas);
+    int * store_ids = veci_begin(&s->store_ids);
     int * pPerm, * pArray, * pSortValues, nCutoffValue;
     int i, k, j, Id, Counter, CounterStart, nSelected;
     clause * c;
@@ -1573,9 +1639,16 @@ void sat_solver_reducedb(sat_solver* s)
     {
         assert( c->mark == 0 );
         if ( Counter++ > CounterStart || clause_size(c) < 3 || pSortValues[clause_id(c)] > nCutoffValue || s->reasons[lit_var(c->lits[0])] == Sat_MemHand(pMem, i, k) )
+        {
+            if ( s->fStoreTrim )
+                store_ids[j] = store_ids[clause_id(c)];
             act_clas[j++] = act_clas[clause_id(c)];
+        }
         else // delete
         {
+            // the clause not used so far is not in the proof
+            if ( s->fStoreTrim && !(store_ids[clause_id(c)] & 1) )
+                Sto_ManTrimClause( (Sto_Man_t *)s->pStore, store_ids[clause_id(c)] >> 1 );
             c->mark = 1;
             s->stats.learnts_literals -= clause_size(c);
             s->stats.learnts--;
@@ -1584,6 +1657,8 @@ void sat_solver_reducedb(sat_solver* s)
     assert( s->stats.learnts == (unsigned)j );
     assert( Counter == nLearnedOld );
     veci_resize(&s->act_clas,j);
+    if ( s->fStoreTrim )
+        veci_resize(&s->store_ids,j);
     ABC_FREE( pSortValues );
 
     // update ID of each clause to be its new handle
@@ -1613,12 +1688,18 @@ void sat_solver_reducedb(sat_solver* s)
             if ( clause_is_lit(pArray[k]) ) // 2-lit clause
                 pArray[j++] = pArray[k];
             else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
-                pArray[j++] = pArray[k];
+            {
+                pArray[j++] = pArray[k++];
+                pArray[j++] = pArray[k]; // blocker
+            }
             else 
             {
-                c = clause_read(s, pArray[k]);
+                c = clause_read(s, pArray[k++]);
                 if ( !c->mark ) // useful learned clause
+                {
                    pArray[j++] = clause_id(c); // updating handle here!!!
+                   pArray[j++] = pArray[k]; // blocker
+                }
             }
         }
         veci_resize(&s->wlists[i],j);
@@ -1679,8 +1760,11 @@ void sat_solver_rollback( sat_solver* s )
                 if ( clause_read_lit(pArray[k]) < s->iVarPivot*2 )
                     pArray[j++] = pArray[k];
             }
-            else if ( Sat_MemClauseUsed(pMem, pArray[k]) )
-                pArray[j++] = pArray[k];
+            else if ( Sat_MemClauseUsed(pMem, pArray[k++]) )
+            {
+                pArray[j++] = pArray[k-1];
+                pArray[j++] = pArray[k]; // blocker
+            }
         }
         veci_resize(&s->wlists[i],j);
     }
@@ -1696,6 +1780,8 @@ void sat_solver_rollback( sat_solver* s )
 
     // resize learned arrays
     veci_resize(&s->act_clas,  s->stats.learnts);
+    if ( s->fStoreTrim )
+        veci_resize(&s->store_ids, s->stats.learnts);
 
     // initialize other vars
     s->size = s->iVarPivot;
@@ -1983,6 +2069,8 @@ int sat_solver_solve_internal(sat_solver* s)
             break;
         if ( s->pFuncStop && s->pFuncStop(s->RunId) )
             break;
+        if ( s->pStop && *s->pStop )
+            break;
     }
     if (s->verbosity >= 1)
         printf("==============================================================================\n");
@@ -2068,6 +2156,7 @@ void sat_solver_set_resource_limits(sat_solver* s, ABC_INT64_T nConfLimit, ABC_I
 int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal)
 {
     lbool status;
+    abctime clk;
     lit * i;
     ////////////////////////////////////////////////
     if ( s->fSolved )
@@ -2118,7 +2207,9 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
     s->root_level = sat_solver_dl(s);
 #endif
 
+    clk = Abc_Clock();
     status = sat_solver_solve_internal(s);
+    s->timeTotal += Abc_Clock() - clk;
 
     sat_solver_canceluntil(s,0);
     s->root_level = 0;
@@ -2392,8 +2483,26 @@ void sat_solver_store_alloc( sat_solver * s )
     s->pStore = Sto_ManAlloc();
 }
 
+// logs the learned clauses compactly and trims those deleted without being used
+void sat_solver_store_compact( sat_solver * s )
+{
+    assert( s->pStore != NULL );
+    assert( s->stats.learnts == 0 );
+    ((Sto_Man_t *)s->pStore)->fCompact = 1;
+    s->fStoreTrim = 1;
+}
+
+static void sat_solver_store_expand( sat_solver * s )
+{
+    if ( s->pStore && ((Sto_Man_t *)s->pStore)->fCompact ) 
+        Sto_ManExpandLog( (Sto_Man_t *)s->pStore );
+    veci_resize(&s->store_ids, 0);
+    s->fStoreTrim = 0;
+}
+
 void sat_solver_store_write( sat_solver * s, char * pFileName )
 {
+    sat_solver_store_expand( s );
     if ( s->pStore ) Sto_ManDumpClauses( (Sto_Man_t *)s->pStore, pFileName );
 }
 
@@ -2401,6 +2510,8 @@ void sat_solver_store_free( sat_solver * s )
 {
     if ( s->pStore ) Sto_ManFree( (Sto_Man_t *)s->pStore );
     s->pStore = NULL;
+    veci_resize(&s->store_ids, 0);
+    s->fStoreTrim = 0;
 }
 
 int sat_solver_store_change_last( sat_solver * s )
@@ -2424,6 +2535,7 @@ void * sat_solver_store_release( sat_solver * s )
     void * pTemp;
     if ( s->pStore == NULL )
         return NULL;
+    sat_solver_store_expand( s );
     pTemp = s->pStore;
     s->pStore = NULL;
     return pTemp;
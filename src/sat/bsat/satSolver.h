@@ -82,6 +82,7 @@ extern void        Sat_SolverTraceWrite( sat_solver * pSat, int * pBeg, int * pE
 
 // clause storage
 extern void        sat_solver_store_alloc( sat_solver * s );
+extern void        sat_solver_store_compact( sat_solver * s );
 extern void        sat_solver_store_write( sat_solver * s, char * pFileName );
 extern void        sat_solver_store_free( sat_solver * s );
 extern void        sat_solver_store_mark_roots( sat_solver * s );
@@ -127,6 +128,8 @@ struct sat_solver_t
     unsigned    cla_inc;       // Amount to bump next clause with.
     unsigned    cla_decay;     // INVERSE decay factor for clause activity: stores 1/decay.
     veci        act_clas;      // contain clause activities
+    veci        store_ids;     // the proof log entry of each learned clause (shifted; bit 0 = used)
+    int         fStoreTrim;    // trim the unused learned clauses from the proof log
 
     char *      pFreqs;        // how many times this variable was assigned a value
     int         nVarUsed;
@@ -170,6 +173,7 @@ struct sat_solver_t
     ABC_INT64_T nConfLimit;    // external limit on the number of conflicts
     ABC_INT64_T nInsLimit;     // external limit on the number of implications
     abctime     nRuntimeLimit; // external limit on runtime
+    abctime     timeTotal;     // the total runtime of sat_solver_solve()
 
     veci        act_vars;      // variables whose activity has changed
     double*     factors;       // the activity factors
@@ -206,6 +210,7 @@ struct sat_solver_t
     // termination callback
     int         RunId;          // SAT id in this run
     int(*pFuncStop)(int);       // callback to terminate
+    int *       pStop;          // external stop flag
 };
 
 static inline clause * clause_read( sat_solver * s, cla h )          
@@ -361,6 +366,10 @@ static inline void sat_solver_set_stop_func( sat_solver *s, int (*fnct)(int) )
 { 
     s->pFuncStop = fnct; 
 }
+static inline void sat_solver_set_stop( sat_solver *s, int * pStop ) 
+{ 
+    s->pStop = pStop; 
+}
 
 static inline int sat_solver_add_const( sat_solver * pSat, int iVar, int fCompl )
 {
@@ -103,7 +103,7 @@ int Sto_ManMemoryReport( Sto_Man_t * p )
     Total = p->nChunkUsed; 
     for ( pMem = p->pChunkLast; (pNext = *(char **)pMem); pMem = pNext )
         Total += p->nChunkSize;
-    return Total;
+    return Total + p->nLogCap + sizeof(int) * p->nLogPosCap;
 }
 
 
@@ -143,9 +143,175 @@ Sto_Man_t * Sto_ManAlloc()
 void Sto_ManFree( Sto_Man_t * p )
 {
     Sto_ManMemoryStop( p );
+    ABC_FREE( p->pLog );
+    ABC_FREE( p->pLogPos );
     ABC_FREE( p );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes/reads one unsigned number into/from the log.]
+
+  Description [Uses 7 bits per byte; the highest bit shows that
+  more bytes follow.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Sto_ManLogWriteNum( Sto_Man_t * p, unsigned x )
+{
+    while ( x & ~0x7f )
+    {
+        p->pLog[p->nLogSize++] = (unsigned char)((x & 0x7f) | 0x80);
+        x >>= 7;
+    }
+    p->pLog[p->nLogSize++] = (unsigned char)x;
+}
+static inline unsigned Sto_ManLogReadNum( unsigned char ** ppPos )
+{
+    unsigned char * pPos = *ppPos;
+    unsigned x = 0;
+    int i;
+    for ( i = 0; *pPos & 0x80; i += 7 )
+        x |= (unsigned)(*pPos++ & 0x7f) << i;
+    x |= (unsigned)(*pPos++) << i;
+    *ppPos = pPos;
+    return x;
+}
+static inline int Sto_ManLogRecordSize( unsigned char * pPos )
+{
+    unsigned char * pStart = pPos;
+    int k, nLits = (int)(Sto_ManLogReadNum( &pPos ) >> 1);
+    for ( k = 0; k < nLits; k++ )
+        Sto_ManLogReadNum( &pPos );
+    return pPos - pStart;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds one clause to the compact log.]
+
+  Description [The clause is written as the number of literals (shifted
+  left by one; the lowest bit is set when the clause is trimmed), followed
+  by the first literal and the differences between the next literals.
+  The literals are sorted and there are no duplicated variables.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sto_ManLogClause( Sto_Man_t * p, lit * pBeg, lit * pEnd )
+{
+    int nSize, nLits = pEnd - pBeg;
+    lit * i;
+    // make sure the log has room for the clause (the log starts small and doubles)
+    if ( p->nLogSize + 5 * (nLits + 1) > p->nLogCap )
+    {
+        p->nLogCap = STO_MAX( 2 * p->nLogCap, STO_MAX( p->nLogSize + 5 * (nLits + 1), (1<<10) ) );
+        p->pLog = ABC_REALLOC( unsigned char, p->pLog, p->nLogCap );
+    }
+    if ( p->nLogged == p->nLogPosCap )
+    {
+        p->nLogPosCap = STO_MAX( 2 * p->nLogPosCap, (1<<8) );
+        p->pLogPos = ABC_REALLOC( int, p->pLogPos, p->nLogPosCap );
+    }
+    p->pLogPos[p->nLogged++] = p->nLogSize;
+    // write the clause
+    Sto_ManLogWriteNum( p, (unsigned)nLits << 1 );
+    for ( i = pBeg; i < pEnd; i++ )
+        Sto_ManLogWriteNum( p, i == pBeg ? (unsigned)*i : (unsigned)(*i - *(i-1)) );
+    p->nLogPeak = STO_MAX( p->nLogPeak, p->nLogCap + (int)sizeof(int) * p->nLogPosCap );
+    // remember the memory the clause would take otherwise
+    nSize = sizeof(Sto_Cls_t) + sizeof(lit) * nLits;
+    p->dLogFull += (nSize / sizeof(char*) + ((nSize % sizeof(char*)) > 0)) * sizeof(char*);
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the clause from the compact log.]
+
+  Description [Should be called for the learned clauses, which are deleted
+  by the solver without being used in the derivation of other clauses.
+  Such clauses do not belong to the proof. The log is compacted when
+  more than half of it is taken by the trimmed clauses.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sto_ManTrimClause( Sto_Man_t * p, int iLog )
+{
+    int i, Pos, Size, nLogSize = 0;
+    assert( iLog >= 0 && iLog < p->nLogged );
+    Pos = p->pLogPos[iLog];
+    assert( Pos >= 0 && !(p->pLog[Pos] & 1) );
+    p->pLog[Pos] |= 1;
+    p->pLogPos[iLog] = -1;
+    p->nLogDead += Sto_ManLogRecordSize( p->pLog + Pos );
+    p->nTrimmed++;
+    if ( p->nLogDead < (1<<16) || 2 * p->nLogDead < p->nLogSize )
+        return;
+    // move the remaining clauses to the beginning of the log
+    for ( i = 0; i < p->nLogged; i++ )
+    {
+        if ( (Pos = p->pLogPos[i]) < 0 )
+            continue;
+        Size = Sto_ManLogRecordSize( p->pLog + Pos );
+        memmove( p->pLog + nLogSize, p->pLog + Pos, (size_t)Size );
+        p->pLogPos[i] = nLogSize;
+        nLogSize += Size;
+    }
+    assert( nLogSize == p->nLogSize - p->nLogDead );
+    p->nLogSize = nLogSize;
+    p->nLogDead = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses remaining in the log to the manager.]
+
+  Description [After this, the clauses can be traversed as usual.
+  The logged clauses receive consecutive IDs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sto_ManExpandLog( Sto_Man_t * p )
+{
+    unsigned char * pPos;
+    lit * pLits = NULL;
+    int i, k, nLits, nLitsMax = 0, RetValue;
+    p->fCompact = 0;
+    for ( i = 0; i < p->nLogged; i++ )
+    {
+        if ( p->pLogPos[i] < 0 )
+            continue;
+        pPos  = p->pLog + p->pLogPos[i];
+        nLits = (int)(Sto_ManLogReadNum( &pPos ) >> 1);
+        if ( nLits > nLitsMax )
+        {
+            nLitsMax = 2 * nLits;
+            pLits = ABC_REALLOC( lit, pLits, nLitsMax );
+        }
+        for ( k = 0; k < nLits; k++ )
+            pLits[k] = (lit)Sto_ManLogReadNum( &pPos ) + (k ? pLits[k-1] : 0);
+        RetValue = Sto_ManAddClause( p, pLits, pLits + nLits );
+        assert( RetValue );
+        (void) RetValue;
+    }
+    ABC_FREE( pLits );
+    ABC_FREE( p->pLog );
+    ABC_FREE( p->pLogPos );
+    p->nLogSize = p->nLogDead = p->nLogCap = p->nLogPosCap = 0;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Adds one clause to the manager.]
@@ -184,6 +350,8 @@ int Sto_ManAddClause( Sto_Man_t * p, lit * pBeg, lit * pEnd )
         // check the largest var size
         p->nVars = STO_MAX( p->nVars, lit_var(*(pEnd-1)) + 1 );
     }
+    if ( Sto_ManIsLogging(p) )
+        return Sto_ManLogClause( p, pBeg, pEnd );
 
     // get memory for the clause
     nSize = sizeof(Sto_Cls_t) + sizeof(lit) * (pEnd - pBeg);
@@ -93,8 +93,24 @@ struct Sto_Man_t_
     int             nChunkSize;   // the number of bytes in a chunk
     int             nChunkUsed;   // the number of bytes used in the last chunk
     char *          pChunkLast;   // the last memory chunk
+    // compact log of the learned clauses
+    int             fCompact;     // log the learned clauses compactly
+    int             nLogged;      // the number of clauses added to the log
+    int             nTrimmed;     // the number of clauses trimmed from the log
+    int             nLogSize;     // the number of bytes used by the log
+    int             nLogDead;     // the number of bytes used by the trimmed clauses
+    int             nLogCap;      // the number of bytes allocated for the log
+    int             nLogPeak;     // the peak memory used by the log
+    int             nLogPosCap;   // the number of entries allocated for positions
+    unsigned char * pLog;         // the delta-encoded clauses
+    int *           pLogPos;      // the position of each logged clause (or -1)
+    double          dLogFull;     // the memory the logged clauses would use if stored
 };
 
+// learned clauses are logged compactly after the root clauses are marked
+static inline int   Sto_ManIsLogging( Sto_Man_t * p )   { return p->fCompact && p->nRoots > 0;   }
+static inline int   Sto_ManLogLast( Sto_Man_t * p )     { return p->nLogged - 1;                  }
+
 // iterators through the clauses
 #define Sto_ManForEachClause( p, pCls )      for( pCls = p->pHead; pCls; pCls = pCls->pNext )
 #define Sto_ManForEachClauseRoot( p, pCls )  for( pCls = p->pHead; pCls && pCls->fRoot; pCls = pCls->pNext )
@@ -117,6 +133,8 @@ extern void         Sto_ManMarkClausesA( Sto_Man_t * p );
 extern void         Sto_ManDumpClauses( Sto_Man_t * p, char * pFileName );
 extern int          Sto_ManChangeLastClause( Sto_Man_t * p );
 extern Sto_Man_t *  Sto_ManLoadClauses( char * pFileName );
+extern void         Sto_ManTrimClause( Sto_Man_t * p, int iLog );
+extern void         Sto_ManExpandLog( Sto_Man_t * p );
 
 
 /*=== satInter.c ==========================================================*/
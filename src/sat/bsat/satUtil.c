@@ -196,6 +196,8 @@ void Sat_SolverPrintStats( FILE * pFile, sat_solver * p )
     printf( "conflicts     : %16.0f\n", Sat_Wrd2Dbl(p->stats.conflicts) );
     printf( "decisions     : %16.0f\n", Sat_Wrd2Dbl(p->stats.decisions) );
     printf( "propagations  : %16.0f\n", Sat_Wrd2Dbl(p->stats.propagations) );
+    if ( p->timeTotal )
+    printf( "props/sec     : %16.0f\n", Sat_Wrd2Dbl(p->stats.propagations) * CLOCKS_PER_SEC / p->timeTotal );
 //    printf( "inspects      : %10d\n", (int)p->stats.inspects );
 //    printf( "inspects2     : %10d\n", (int)p->stats.inspects2 );
 }
@@ -51,6 +51,12 @@ ABC_NAMESPACE_HEADER_START
 typedef struct Cnf_Man_t_            Cnf_Man_t;
 typedef struct Cnf_Dat_t_            Cnf_Dat_t;
 typedef struct Cnf_Cut_t_            Cnf_Cut_t;
+typedef struct Cnf_Out_t_            Cnf_Out_t;
+
+#define CNF_OUT_SIZE      (1 << 20)  // the size of the output buffer
+#define CNF_OUT_SEG_SIZE  (1 << 14)  // the number of clauses in one segment
+#define CNF_OUT_THR_MAX   64         // the max number of formatting threads
+#define CNF_OUT_LIT_MAX   12         // the max number of bytes in one formatted literal
 
 // the CNF asserting outputs of AIG to be 1
 struct Cnf_Dat_t_
@@ -129,11 +135,14 @@ static inline void         Cnf_ObjSetBestCut( Aig_Obj_t * pObj, Cnf_Cut_t * pCut
 extern Vec_Int_t *     Cnf_DeriveMappingArray( Aig_Man_t * pAig );
 extern Cnf_Dat_t *     Cnf_Derive( Aig_Man_t * pAig, int nOutputs );
 extern Cnf_Dat_t *     Cnf_DeriveWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int nOutputs );
+extern word            Cnf_DeriveWriteFile( Aig_Man_t * pAig, char * pFileName, int nOutputs, int fChangePol, int fBinary, int nProcs, int fVerbose, int * pStats );
 extern Cnf_Dat_t *     Cnf_DeriveOther( Aig_Man_t * pAig, int fSkipTtMin );
 extern Cnf_Dat_t *     Cnf_DeriveOtherWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int fSkipTtMin );
 extern void            Cnf_ManPrepare();
 extern Cnf_Man_t *     Cnf_ManRead();
 extern void            Cnf_ManFree();
+extern void            Cnf_ManStartThread();
+extern void            Cnf_ManStopThread();
 /*=== cnfCut.c ========================================================*/
 extern Cnf_Cut_t *     Cnf_CutCreate( Cnf_Man_t * p, Aig_Obj_t * pObj );
 extern void            Cnf_CutPrint( Cnf_Cut_t * pCut );
@@ -163,6 +172,16 @@ extern void            Cnf_DataLiftAndFlipLits( Cnf_Dat_t * p, int nVarsPlus, Ve
 extern void            Cnf_DataPrint( Cnf_Dat_t * p, int fReadable );
 extern void            Cnf_DataWriteIntoFile( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vForAlls, Vec_Int_t * vExists );
 extern void            Cnf_DataWriteIntoFileInv( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vExists1, Vec_Int_t * vForAlls, Vec_Int_t * vExists2 );
+extern word            Cnf_DataWriteIntoFileFast( Cnf_Dat_t * p, char * pFileName, int fBinary, int nProcs, int fVerbose );
+extern Cnf_Out_t *     Cnf_OutStart( char * pFileName );
+extern void            Cnf_OutWrite( Cnf_Out_t * p, void * pData, int nBytes );
+extern void            Cnf_OutPrintf( Cnf_Out_t * p, const char * pFormat, ... );
+extern word            Cnf_OutStop( Cnf_Out_t * p );
+extern int             Cnf_OutFormatClauses( char * pBuffer, int ** pClauses, int iStart, int iStop, int fReadable, int fBinary );
+extern void            Cnf_OutWriteHeader( Cnf_Out_t * p, int nVars, int nClauses, int fBinary );
+extern void            Cnf_OutRunSegments( void * (*pFunc)(void *), void * pSegs, int nSegSize, int nSegs );
+extern word            Cnf_OutWriteClauses( Cnf_Out_t * pOut, Cnf_Dat_t * p, int fReadable, int fBinary, int nProcs );
+extern void            Cnf_OutPrintStats( word nBytes, word nMemory, word nMemClauses, abctime Time );
 extern void *          Cnf_DataWriteIntoSolver( Cnf_Dat_t * p, int nFrames, int fInit );
 extern void *          Cnf_DataWriteIntoSolverInt( void * pSat, Cnf_Dat_t * p, int nFrames, int fInit );
 extern int             Cnf_DataWriteOrClause( void * pSat, Cnf_Dat_t * pCnf );
@@ -183,10 +202,13 @@ extern Vec_Int_t *     Cnf_DataCollectCiSatNums( Cnf_Dat_t * pCnf, Aig_Man_t * p
 extern Vec_Int_t *     Cnf_DataCollectCoSatNums( Cnf_Dat_t * pCnf, Aig_Man_t * p );
 extern unsigned char * Cnf_DataDeriveLitPolarities( Cnf_Dat_t * p );
 extern Cnf_Dat_t *     Cnf_DataReadFromFile( char * pFileName );
+extern Vec_Int_t *     Cnf_DataSolve( Cnf_Dat_t * p, int fCadical, int Seed, int TimeOut, volatile int * pStop, int * pStatus );
+extern Vec_Int_t *     Cnf_RunSolver( Vec_Ptr_t * vCnfs, int nJobs, int Seed, int fCadical, int nProcs, int TimeOut, int fSatOnly, int fVerbose, int * pStatus, int * piWinner );
 /*=== cnfWrite.c ========================================================*/
 extern Vec_Int_t *     Cnf_ManWriteCnfMapping( Cnf_Man_t * p, Vec_Ptr_t * vMapped );
 extern void            Cnf_SopConvertToVector( char * pSop, int nCubes, Vec_Int_t * vCover );
 extern Cnf_Dat_t *     Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs );
+extern word            Cnf_ManWriteCnfStream( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int fChangePol, Cnf_Out_t * pOut, int fBinary, int nProcs, int * pStats );
 extern Cnf_Dat_t *     Cnf_ManWriteCnfOther( Cnf_Man_t * p, Vec_Ptr_t * vMapped );
 extern Cnf_Dat_t *     Cnf_DeriveSimple( Aig_Man_t * p, int nOutputs );
 extern Cnf_Dat_t *     Cnf_DeriveSimpleForRetiming( Aig_Man_t * p );
@@ -20,6 +20,17 @@
 
 #include "cnf.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -29,6 +40,19 @@ ABC_NAMESPACE_IMPL_START
 
 static Cnf_Man_t * s_pManCnf = NULL;
 
+// the CNF manager owned by the current thread (see Cnf_ManStartThread)
+static ABC_THREAD_LOCAL Cnf_Man_t * s_pManCnfThread = NULL;
+
+// the shared CNF manager is used by one thread at a time
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_CnfMutex = PTHREAD_MUTEX_INITIALIZER;
+static inline void Cnf_ManLock()   { pthread_mutex_lock( &s_CnfMutex );   }
+static inline void Cnf_ManUnlock() { pthread_mutex_unlock( &s_CnfMutex ); }
+#else
+static inline void Cnf_ManLock()   {}
+static inline void Cnf_ManUnlock() {}
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -53,14 +77,41 @@ void Cnf_ManPrepare()
 }
 Cnf_Man_t * Cnf_ManRead()
 {
-    return s_pManCnf;
+    return s_pManCnfThread ? s_pManCnfThread : s_pManCnf;
 }
 void Cnf_ManFree()
 {
-    if ( s_pManCnf == NULL )
-        return;
-    Cnf_ManStop( s_pManCnf );
+    Cnf_ManLock();
+    if ( s_pManCnf != NULL )
+        Cnf_ManStop( s_pManCnf );
     s_pManCnf = NULL;
+    Cnf_ManUnlock();
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the CNF manager owned by the current thread.]
+
+  Description [While the thread owns its CNF manager, Cnf_Derive(), 
+  Cnf_DeriveOther() and Cnf_DeriveWriteFile() called by this thread 
+  use it instead of the shared manager, so that the worker threads
+  deriving CNFs are not serialized by the lock of the shared manager.]
+               
+  SideEffects []
+
+  SeeAlso     [Cnf_ManStopThread]
+
+***********************************************************************/
+void Cnf_ManStartThread()
+{
+    assert( s_pManCnfThread == NULL );
+    s_pManCnfThread = Cnf_ManStart();
+}
+void Cnf_ManStopThread()
+{
+    assert( s_pManCnfThread != NULL );
+    Cnf_ManStop( s_pManCnfThread );
+    s_pManCnfThread = NULL;
 }
 
 
@@ -164,8 +215,83 @@ p->timeSave = Abc_Clock() - clk;
 }
 Cnf_Dat_t * Cnf_Derive( Aig_Man_t * pAig, int nOutputs )
 {
+    Cnf_Dat_t * pCnf;
+    if ( s_pManCnfThread )
+        return Cnf_DeriveWithMan( s_pManCnfThread, pAig, nOutputs );
+    Cnf_ManLock();
     Cnf_ManPrepare();
-    return Cnf_DeriveWithMan( s_pManCnf, pAig, nOutputs );
+    pCnf = Cnf_DeriveWithMan( s_pManCnf, pAig, nOutputs );
+    Cnf_ManUnlock();
+    return pCnf;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Converts AIG into CNF and writes it into a file.]
+
+  Description [Performs the same mapping as Cnf_Derive() but writes the
+  clauses directly into the file (see Cnf_ManWriteCnfStream) without
+  building the complete CNF. The file is compressed if its name ends 
+  in ".gz". If fBinary is set, the binary format is used (see 
+  Cnf_DataWriteIntoFileFast). Returns the number of variables, clauses, 
+  and literals in pStats[0], pStats[1], and pStats[2]. Returns the number
+  of bytes written or 0 if the file cannot be opened.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Cnf_DeriveWriteFile( Aig_Man_t * pAig, char * pFileName, int nOutputs, int fChangePol, int fBinary, int nProcs, int fVerbose, int * pStats )
+{
+    Cnf_Man_t * p;
+    Cnf_Out_t * pOut;
+    Vec_Ptr_t * vMapped;
+    Aig_MmFixed_t * pMemCuts;
+    word nBytes, nMemory;
+    abctime clk;
+    pOut = Cnf_OutStart( pFileName );
+    if ( pOut == NULL )
+    {
+        printf( "Cnf_DeriveWriteFile(): Output file \"%s\" cannot be opened.\n", pFileName );
+        return 0;
+    }
+    if ( s_pManCnfThread == NULL )
+    {
+        Cnf_ManLock();
+        Cnf_ManPrepare();
+    }
+    p = s_pManCnfThread ? s_pManCnfThread : s_pManCnf;
+    p->pManAig = pAig;
+    // generate cuts for all nodes, assign cost, and find best cuts
+clk = Abc_Clock();
+    pMemCuts = Dar_ManComputeCuts( pAig, 10, 0, 0 );
+p->timeCuts = Abc_Clock() - clk;
+    // find the mapping
+clk = Abc_Clock();
+    Cnf_DeriveMapping( p );
+p->timeMap = Abc_Clock() - clk;
+    // convert it into CNF and write it into the file
+clk = Abc_Clock();
+    Cnf_ManTransferCuts( p );
+    vMapped = Cnf_ManScanMapping( p, 1, 1 );
+    nMemory = Cnf_ManWriteCnfStream( p, vMapped, nOutputs, fChangePol, pOut, fBinary, nProcs, pStats );
+    Vec_PtrFree( vMapped );
+    Aig_MmFixedStop( pMemCuts, 0 );
+    nBytes = Cnf_OutStop( pOut );
+p->timeSave = Abc_Clock() - clk;
+    // reset reference counters
+    Aig_ManResetRefs( pAig );
+    if ( fVerbose )
+    {
+        ABC_PRT( "Cuts    ", p->timeCuts );
+        ABC_PRT( "Mapping ", p->timeMap  );
+        ABC_PRT( "Writing ", p->timeSave );
+        Cnf_OutPrintStats( nBytes, nMemory + CNF_OUT_SIZE, 4 * (word)pStats[2] + 8 * (word)(pStats[1] + 1), p->timeSave );
+    }
+    if ( s_pManCnfThread == NULL )
+        Cnf_ManUnlock();
+    return nBytes;
 }
  
 /**Function*************************************************************
@@ -218,8 +344,14 @@ p->timeSave = Abc_Clock() - clk;
 }
 Cnf_Dat_t * Cnf_DeriveOther( Aig_Man_t * pAig, int fSkipTtMin )
 {
+    Cnf_Dat_t * pCnf;
+    if ( s_pManCnfThread )
+        return Cnf_DeriveOtherWithMan( s_pManCnfThread, pAig, fSkipTtMin );
+    Cnf_ManLock();
     Cnf_ManPrepare();
-    return Cnf_DeriveOtherWithMan( s_pManCnf, pAig, fSkipTtMin );
+    pCnf = Cnf_DeriveOtherWithMan( s_pManCnf, pAig, fSkipTtMin );
+    Cnf_ManUnlock();
+    return pCnf;
 }
 
 #if 0
@@ -23,6 +23,16 @@
 #include "sat/bsat/satSolver2.h"
 #include "misc/zlib/zlib.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -33,6 +43,16 @@ ABC_NAMESPACE_IMPL_START
 static inline int Cnf_Lit2Var( int Lit )        { return (Lit & 1)? -(Lit >> 1)-1 : (Lit >> 1)+1;  }
 static inline int Cnf_Lit2Var2( int Lit )       { return (Lit & 1)? -(Lit >> 1)   : (Lit >> 1);    }
 
+// buffered output stream (compressed if the file name ends in ".gz")
+struct Cnf_Out_t_
+{
+    FILE *           pFile;      // uncompressed output
+    gzFile           pGzFile;    // compressed output
+    char *           pBuffer;    // fixed-size buffer
+    int              nSize;      // the number of bytes in the buffer
+    word             nBytes;     // the number of bytes written
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -286,190 +306,355 @@ void Cnf_DataPrint( Cnf_Dat_t * p, int fReadable )
 
 /**Function*************************************************************
 
-  Synopsis    [Writes CNF into a file.]
+  Synopsis    [Buffered output stream.]
 
-  Description []
+  Description [Uses a fixed-size buffer, which is flushed into the file 
+  or into the gzip stream (if the file name ends in ".gz") when full.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Cnf_DataWriteIntoFileGz( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vForAlls, Vec_Int_t * vExists )
+Cnf_Out_t * Cnf_OutStart( char * pFileName )
 {
-    gzFile pFile;
-    int * pLit, * pStop, i, VarId;
-    pFile = gzopen( pFileName, "wb" );
-    if ( pFile == NULL )
+    Cnf_Out_t * p = ABC_CALLOC( Cnf_Out_t, 1 );
+    int nLength = strlen(pFileName);
+    if ( nLength > 3 && !strcmp(pFileName + nLength - 3, ".gz") )
+        p->pGzFile = gzopen( pFileName, "wb" );
+    else
+        p->pFile = fopen( pFileName, "wb" );
+    if ( p->pFile == NULL && p->pGzFile == NULL )
     {
-        printf( "Cnf_WriteIntoFile(): Output file cannot be opened.\n" );
-        return;
+        ABC_FREE( p );
+        return NULL;
     }
-    gzprintf( pFile, "c Result of efficient AIG-to-CNF conversion using package CNF\n" );
-    gzprintf( pFile, "p cnf %d %d\n", p->nVars, p->nClauses );
-    if ( vForAlls )
+    p->pBuffer = ABC_ALLOC( char, CNF_OUT_SIZE );
+    return p;
+}
+static void Cnf_OutFlush( Cnf_Out_t * p )
+{
+    if ( p->nSize == 0 )
+        return;
+    if ( p->pGzFile )
+        gzwrite( p->pGzFile, p->pBuffer, (unsigned)p->nSize );
+    else
+        fwrite( p->pBuffer, 1, p->nSize, p->pFile );
+    p->nSize = 0;
+}
+void Cnf_OutWrite( Cnf_Out_t * p, void * pData, int nBytes )
+{
+    p->nBytes += nBytes;
+    if ( p->nSize + nBytes > CNF_OUT_SIZE )
+        Cnf_OutFlush( p );
+    if ( nBytes >= CNF_OUT_SIZE )
     {
-        gzprintf( pFile, "a " );
-        Vec_IntForEachEntry( vForAlls, VarId, i )
-            gzprintf( pFile, "%d ", fReadable? VarId : VarId+1 );
-        gzprintf( pFile, "0\n" );
+        if ( p->pGzFile )
+            gzwrite( p->pGzFile, pData, (unsigned)nBytes );
+        else
+            fwrite( pData, 1, nBytes, p->pFile );
+        return;
     }
-    if ( vExists )
+    memcpy( p->pBuffer + p->nSize, pData, nBytes );
+    p->nSize += nBytes;
+}
+void Cnf_OutPrintf( Cnf_Out_t * p, const char * pFormat, ... )
+{
+    char Buffer[1000];
+    int nBytes;
+    va_list args;
+    va_start( args, pFormat );
+    nBytes = vsnprintf( Buffer, 1000, pFormat, args );
+    va_end( args );
+    assert( nBytes < 1000 );
+    Cnf_OutWrite( p, Buffer, nBytes );
+}
+word Cnf_OutStop( Cnf_Out_t * p )
+{
+    word nBytes = p->nBytes;
+    Cnf_OutFlush( p );
+    if ( p->pGzFile )
+        gzclose( p->pGzFile );
+    else
+        fclose( p->pFile );
+    ABC_FREE( p->pBuffer );
+    ABC_FREE( p );
+    return nBytes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Formats the clauses.]
+
+  Description [Writes the clauses from iStart to iStop-1 into the buffer,
+  which should have room for CNF_OUT_LIT_MAX bytes per literal and two bytes
+  per clause. In the text format, the literals are written as DIMACS numbers 
+  (or as the variable numbers, if fReadable is set). In the binary format,
+  each literal Lit is written as the variable-length unsigned number Lit+2
+  (2*v+s for the DIMACS variable v and the sign s), and each clause is
+  terminated by the zero byte. Returns the number of bytes written.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline char * Cnf_OutFormatNum( char * pBuffer, int Num )
+{
+    char Digits[12];
+    unsigned uNum = Num < 0 ? 0 - (unsigned)Num : (unsigned)Num;
+    int n = 0;
+    if ( Num < 0 )
+        *pBuffer++ = '-';
+    do Digits[n++] = '0' + uNum % 10; while ( (uNum /= 10) );
+    while ( n )
+        *pBuffer++ = Digits[--n];
+    return pBuffer;
+}
+static inline char * Cnf_OutFormatCode( char * pBuffer, unsigned uCode )
+{
+    while ( uCode & ~0x7f )
     {
-        gzprintf( pFile, "e " );
-        Vec_IntForEachEntry( vExists, VarId, i )
-            gzprintf( pFile, "%d ", fReadable? VarId : VarId+1 );
-        gzprintf( pFile, "0\n" );
+        *pBuffer++ = (char)((uCode & 0x7f) | 0x80);
+        uCode >>= 7;
     }
-    for ( i = 0; i < p->nClauses; i++ )
+    *pBuffer++ = (char)uCode;
+    return pBuffer;
+}
+int Cnf_OutFormatClauses( char * pBuffer, int ** pClauses, int iStart, int iStop, int fReadable, int fBinary )
+{
+    char * pCur = pBuffer;
+    int i, * pLit, * pStop;
+    for ( i = iStart; i < iStop; i++ )
     {
-        for ( pLit = p->pClauses[i], pStop = p->pClauses[i+1]; pLit < pStop; pLit++ )
-            gzprintf( pFile, "%d ", fReadable? Cnf_Lit2Var2(*pLit) : Cnf_Lit2Var(*pLit) );
-        gzprintf( pFile, "0\n" );
+        if ( fBinary )
+        {
+            for ( pLit = pClauses[i], pStop = pClauses[i+1]; pLit < pStop; pLit++ )
+                pCur = Cnf_OutFormatCode( pCur, (unsigned)*pLit + 2 );
+            *pCur++ = 0;
+            continue;
+        }
+        for ( pLit = pClauses[i], pStop = pClauses[i+1]; pLit < pStop; pLit++ )
+        {
+            pCur = Cnf_OutFormatNum( pCur, fReadable? Cnf_Lit2Var2(*pLit) : Cnf_Lit2Var(*pLit) );
+            *pCur++ = ' ';
+        }
+        *pCur++ = '0';
+        *pCur++ = '\n';
     }
-    gzprintf( pFile, "\n" );
-    gzclose( pFile );
+    return pCur - pBuffer;
 }
-void Cnf_DataWriteIntoFileInvGz( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vExists1, Vec_Int_t * vForAlls, Vec_Int_t * vExists2 )
+void Cnf_OutWriteHeader( Cnf_Out_t * p, int nVars, int nClauses, int fBinary )
+{
+    Cnf_OutPrintf( p, "c Result of efficient AIG-to-CNF conversion using package CNF\n" );
+    Cnf_OutPrintf( p, "p %s %d %d\n", fBinary ? "bcnf" : "cnf", nVars, nClauses );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the segment procedure using several threads.]
+
+  Description [Segments are stored in the array (pSegs) with the given 
+  size of one entry (nSegSize). The first segment is processed by the
+  calling thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_OutRunSegments( void * (*pFunc)(void *), void * pSegs, int nSegSize, int nSegs )
 {
-    gzFile pFile;
-    int * pLit, * pStop, i, VarId;
-    pFile = gzopen( pFileName, "wb" );
-    if ( pFile == NULL )
+#ifdef ABC_USE_PTHREADS
+    if ( nSegs > 1 )
     {
-        printf( "Cnf_WriteIntoFile(): Output file cannot be opened.\n" );
+        pthread_t WorkerThread[CNF_OUT_THR_MAX];
+        int k, status;
+        assert( nSegs <= CNF_OUT_THR_MAX );
+        for ( k = 1; k < nSegs; k++ )
+        {
+            status = pthread_create( WorkerThread + k, NULL, pFunc, (void *)((char *)pSegs + k * nSegSize) );  
+            assert( status == 0 );
+        }
+        pFunc( pSegs );
+        for ( k = 1; k < nSegs; k++ )
+            pthread_join( WorkerThread[k], NULL );
         return;
     }
-    gzprintf( pFile, "c Result of efficient AIG-to-CNF conversion using package CNF\n" );
-    gzprintf( pFile, "p cnf %d %d\n", p->nVars, p->nClauses );
-    if ( vExists1 )
-    {
-        gzprintf( pFile, "e " );
-        Vec_IntForEachEntry( vExists1, VarId, i )
-            gzprintf( pFile, "%d ", fReadable? VarId : VarId+1 );
-        gzprintf( pFile, "0\n" );
-    }
-    if ( vForAlls )
-    {
-        gzprintf( pFile, "a " );
-        Vec_IntForEachEntry( vForAlls, VarId, i )
-            gzprintf( pFile, "%d ", fReadable? VarId : VarId+1 );
-        gzprintf( pFile, "0\n" );
-    }
-    if ( vExists2 )
+#endif
+    assert( nSegs == 1 );
+    pFunc( pSegs );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the clauses into the output stream.]
+
+  Description [The clauses are divided into segments of CNF_OUT_SEG_SIZE
+  clauses, which are formatted by nProcs threads and written in order.
+  Returns the peak memory used by the formatting buffers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cnf_OutSeg_t_ Cnf_OutSeg_t;
+struct Cnf_OutSeg_t_
+{
+    int **           pClauses;   // the clauses
+    int              iStart;     // the first clause
+    int              iStop;      // the last clause + 1
+    int              fReadable;  // the numbering
+    int              fBinary;    // the format
+    int              nBytes;     // the number of formatted bytes
+    int              nCap;       // the buffer size
+    char *           pBuffer;    // the formatted segment
+};
+static void * Cnf_OutFormatSegment( void * pArg )
+{
+    Cnf_OutSeg_t * pSeg = (Cnf_OutSeg_t *)pArg;
+    pSeg->nBytes = Cnf_OutFormatClauses( pSeg->pBuffer, pSeg->pClauses, pSeg->iStart, pSeg->iStop, pSeg->fReadable, pSeg->fBinary );
+    assert( pSeg->nBytes <= pSeg->nCap );
+    return NULL;
+}
+word Cnf_OutWriteClauses( Cnf_Out_t * pOut, Cnf_Dat_t * p, int fReadable, int fBinary, int nProcs )
+{
+    Cnf_OutSeg_t Segs[CNF_OUT_THR_MAX];
+    int i, k, nSegs, nCap;
+    word nMemory = 0;
+    nProcs = Abc_MinInt( Abc_MaxInt(nProcs, 1), CNF_OUT_THR_MAX );
+#ifndef ABC_USE_PTHREADS
+    nProcs = 1;
+#endif
+    memset( Segs, 0, sizeof(Cnf_OutSeg_t) * nProcs );
+    for ( i = 0; i < p->nClauses; i += nSegs * CNF_OUT_SEG_SIZE )
     {
-        gzprintf( pFile, "e " );
-        Vec_IntForEachEntry( vExists2, VarId, i )
-            gzprintf( pFile, "%d ", fReadable? VarId : VarId+1 );
-        gzprintf( pFile, "0\n" );
+        nSegs = Abc_MinInt( nProcs, (p->nClauses - i + CNF_OUT_SEG_SIZE - 1) / CNF_OUT_SEG_SIZE );
+        for ( k = 0; k < nSegs; k++ )
+        {
+            Segs[k].pClauses  = p->pClauses;
+            Segs[k].iStart    = i + k * CNF_OUT_SEG_SIZE;
+            Segs[k].iStop     = Abc_MinInt( Segs[k].iStart + CNF_OUT_SEG_SIZE, p->nClauses );
+            Segs[k].fReadable = fReadable;
+            Segs[k].fBinary   = fBinary;
+            nCap = CNF_OUT_LIT_MAX * (int)(p->pClauses[Segs[k].iStop] - p->pClauses[Segs[k].iStart]) + 2 * (Segs[k].iStop - Segs[k].iStart);
+            if ( Segs[k].nCap < nCap )
+            {
+                Segs[k].nCap    = Abc_MaxInt( nCap, 2 * Segs[k].nCap );
+                Segs[k].pBuffer = ABC_REALLOC( char, Segs[k].pBuffer, Segs[k].nCap );
+            }
+        }
+        Cnf_OutRunSegments( Cnf_OutFormatSegment, Segs, sizeof(Cnf_OutSeg_t), nSegs );
+        for ( k = 0; k < nSegs; k++ )
+            Cnf_OutWrite( pOut, Segs[k].pBuffer, Segs[k].nBytes );
     }
-    for ( i = 0; i < p->nClauses; i++ )
+    for ( k = 0; k < nProcs; k++ )
     {
-        for ( pLit = p->pClauses[i], pStop = p->pClauses[i+1]; pLit < pStop; pLit++ )
-            gzprintf( pFile, "%d ", fReadable? Cnf_Lit2Var2(*pLit) : Cnf_Lit2Var(*pLit) );
-        gzprintf( pFile, "0\n" );
+        nMemory += Segs[k].nCap;
+        ABC_FREE( Segs[k].pBuffer );
     }
-    gzprintf( pFile, "\n" );
-    gzclose( pFile );
+    return nMemory;
 }
 
 /**Function*************************************************************
 
   Synopsis    [Writes CNF into a file.]
 
-  Description []
+  Description [The quantifier lines are written in the given order. 
+  The type of each line ('a' or 'e') is given in pQuantTypes.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Cnf_DataWriteIntoFile( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vForAlls, Vec_Int_t * vExists )
+static void Cnf_DataWriteIntoFileInt( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t ** pvQuants, char * pQuantTypes, int nQuants )
 {
-    FILE * pFile;
-    int * pLit, * pStop, i, VarId;
-    if ( !strncmp(pFileName+strlen(pFileName)-3,".gz",3) ) 
-    {
-        Cnf_DataWriteIntoFileGz( p, pFileName, fReadable, vForAlls, vExists );
-        return;
-    }
-    pFile = fopen( pFileName, "w" );
-    if ( pFile == NULL )
+    Cnf_Out_t * pOut;
+    int i, k, VarId;
+    pOut = Cnf_OutStart( pFileName );
+    if ( pOut == NULL )
     {
         printf( "Cnf_WriteIntoFile(): Output file cannot be opened.\n" );
         return;
     }
-    fprintf( pFile, "c Result of efficient AIG-to-CNF conversion using package CNF\n" );
-    fprintf( pFile, "p cnf %d %d\n", p->nVars, p->nClauses );
-    if ( vForAlls )
-    {
-        fprintf( pFile, "a " );
-        Vec_IntForEachEntry( vForAlls, VarId, i )
-            fprintf( pFile, "%d ", fReadable? VarId : VarId+1 );
-        fprintf( pFile, "0\n" );
-    }
-    if ( vExists )
+    Cnf_OutWriteHeader( pOut, p->nVars, p->nClauses, 0 );
+    for ( k = 0; k < nQuants; k++ )
     {
-        fprintf( pFile, "e " );
-        Vec_IntForEachEntry( vExists, VarId, i )
-            fprintf( pFile, "%d ", fReadable? VarId : VarId+1 );
-        fprintf( pFile, "0\n" );
-    }
-    for ( i = 0; i < p->nClauses; i++ )
-    {
-        for ( pLit = p->pClauses[i], pStop = p->pClauses[i+1]; pLit < pStop; pLit++ )
-            fprintf( pFile, "%d ", fReadable? Cnf_Lit2Var2(*pLit) : Cnf_Lit2Var(*pLit) );
-        fprintf( pFile, "0\n" );
+        if ( pvQuants[k] == NULL )
+            continue;
+        Cnf_OutPrintf( pOut, "%c ", pQuantTypes[k] );
+        Vec_IntForEachEntry( pvQuants[k], VarId, i )
+            Cnf_OutPrintf( pOut, "%d ", fReadable? VarId : VarId+1 );
+        Cnf_OutPrintf( pOut, "0\n" );
     }
-    fprintf( pFile, "\n" );
-    fclose( pFile );
+    Cnf_OutWriteClauses( pOut, p, fReadable, 0, 1 );
+    Cnf_OutPrintf( pOut, "\n" );
+    Cnf_OutStop( pOut );
+}
+void Cnf_DataWriteIntoFile( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vForAlls, Vec_Int_t * vExists )
+{
+    Vec_Int_t * pvQuants[2] = { vForAlls, vExists };
+    Cnf_DataWriteIntoFileInt( p, pFileName, fReadable, pvQuants, "ae", 2 );
 }
 void Cnf_DataWriteIntoFileInv( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vExists1, Vec_Int_t * vForAlls, Vec_Int_t * vExists2 )
 {
-    FILE * pFile;
-    int * pLit, * pStop, i, VarId;
-    if ( !strncmp(pFileName+strlen(pFileName)-3,".gz",3) ) 
-    {
-        Cnf_DataWriteIntoFileInvGz( p, pFileName, fReadable, vExists1, vForAlls, vExists2 );
-        return;
-    }
-    pFile = fopen( pFileName, "w" );
-    if ( pFile == NULL )
+    Vec_Int_t * pvQuants[3] = { vExists1, vForAlls, vExists2 };
+    Cnf_DataWriteIntoFileInt( p, pFileName, fReadable, pvQuants, "eae", 3 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes CNF into a file using several threads.]
+
+  Description [Writes the text DIMACS format or, if fBinary is set, the
+  binary format (see Cnf_OutFormatClauses) with the header "p bcnf".
+  Returns the number of bytes written.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Cnf_DataWriteIntoFileFast( Cnf_Dat_t * p, char * pFileName, int fBinary, int nProcs, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    Cnf_Out_t * pOut;
+    word nBytes, nMemory;
+    pOut = Cnf_OutStart( pFileName );
+    if ( pOut == NULL )
     {
         printf( "Cnf_WriteIntoFile(): Output file cannot be opened.\n" );
-        return;
-    }
-    fprintf( pFile, "c Result of efficient AIG-to-CNF conversion using package CNF\n" );
-    fprintf( pFile, "p cnf %d %d\n", p->nVars, p->nClauses );
-    if ( vExists1 )
-    {
-        fprintf( pFile, "e " );
-        Vec_IntForEachEntry( vExists1, VarId, i )
-            fprintf( pFile, "%d ", fReadable? VarId : VarId+1 );
-        fprintf( pFile, "0\n" );
-    }
-    if ( vForAlls )
-    {
-        fprintf( pFile, "a " );
-        Vec_IntForEachEntry( vForAlls, VarId, i )
-            fprintf( pFile, "%d ", fReadable? VarId : VarId+1 );
-        fprintf( pFile, "0\n" );
-    }
-    if ( vExists2 )
-    {
-        fprintf( pFile, "e " );
-        Vec_IntForEachEntry( vExists2, VarId, i )
-            fprintf( pFile, "%d ", fReadable? VarId : VarId+1 );
-        fprintf( pFile, "0\n" );
-    }
-    for ( i = 0; i < p->nClauses; i++ )
-    {
-        for ( pLit = p->pClauses[i], pStop = p->pClauses[i+1]; pLit < pStop; pLit++ )
-            fprintf( pFile, "%d ", fReadable? Cnf_Lit2Var2(*pLit) : Cnf_Lit2Var(*pLit) );
-        fprintf( pFile, "0\n" );
+        return 0;
     }
-    fprintf( pFile, "\n" );
-    fclose( pFile );
+    Cnf_OutWriteHeader( pOut, p->nVars, p->nClauses, fBinary );
+    nMemory = Cnf_OutWriteClauses( pOut, p, 0, fBinary, nProcs );
+    if ( !fBinary )
+        Cnf_OutPrintf( pOut, "\n" );
+    nBytes = Cnf_OutStop( pOut );
+    if ( fVerbose )
+        Cnf_OutPrintStats( nBytes, nMemory + CNF_OUT_SIZE, 4 * (word)p->nLiterals + 8 * (word)(p->nClauses + 1), Abc_Clock() - clk );
+    return nBytes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the throughput and the memory usage of the writer.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_OutPrintStats( word nBytes, word nMemory, word nMemClauses, abctime Time )
+{
+    double Secs = Abc_MaxDouble( 1.0 * Time / CLOCKS_PER_SEC, 0.001 );
+    printf( "Written %.2f MB (%.2f MB/sec).  ", 1.0 * nBytes / (1 << 20), 1.0 * nBytes / (1 << 20) / Secs );
+    printf( "Peak buffer memory = %.2f MB.  Clause memory = %.2f MB.  ", 1.0 * nMemory / (1 << 20), 1.0 * nMemClauses / (1 << 20) );
+    Abc_PrintTime( 1, "Time", Time );
 }
 
 /**Function*************************************************************
@@ -20,6 +20,10 @@
 
 #include "cnf.h"
 #include "sat/bsat/satSolver.h"
+#include "sat/kissat/kissatSolver.h"
+#include "sat/kissat/kissat.h"
+#include "sat/cadical/cadicalSolver.h"
+#include "sat/cadical/ccadical.h"
 
 #ifdef _MSC_VER
 #define unlink _unlink
@@ -43,196 +47,267 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-extern Vec_Int_t *Exa4_ManParse(char *pFileName);
-
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
 /**Function*************************************************************
 
-  Synopsis    [Solving problems using one core.]
+  Synopsis    [Solves the CNF using the linked-in solver.]
 
-  Description []
+  Description [Uses Kissat (or CaDiCaL, if fCadical is set) with the given
+  random seed. The clauses are transferred in memory. The option table of
+  the linked-in Kissat is compiled out, so it cannot be seeded; instead, 
+  for a non-zero seed, the variables and the clauses are given to Kissat 
+  in a random order derived from the seed. The solver stops
+  when *pStop becomes non-zero or when the timeout (in seconds) expires.
+  Returns the satisfying assignment (the value of DIMACS variable v is in
+  entry v) or NULL. Sets *pStatus to 1 (SAT), 0 (UNSAT), or -1 (undecided).]
 
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Int_t *Cnf_RunSolverOnce(int Id, int Rand, int TimeOut, int fVerbose)
+typedef struct Cnf_SolveStop_t_
 {
-    int fVerboseSolver = 0;
-    Vec_Int_t *vRes = NULL;
-    abctime clkTotal = Abc_Clock();
-    char FileNameIn[100], FileNameOut[100];
-    sprintf(FileNameIn,  "%02d.cnf", Id);
-    sprintf(FileNameOut, "%02d.txt", Id);
-#ifdef _WIN32
-    char *pKissat = "kissat.exe";
-#else
-    char *pKissat = "kissat";
-#endif
-    char Command[1000], *pCommand = (char *)&Command;
-    if (TimeOut)
-        sprintf(pCommand, "%s --seed=%d --time=%d %s %s > %s", pKissat, Rand, TimeOut, fVerboseSolver ? "" : "-q", FileNameIn, FileNameOut);
-    else
-        sprintf(pCommand, "%s --seed=%d %s %s > %s", pKissat, Rand, fVerboseSolver ? "" : "-q", FileNameIn, FileNameOut);
-    //printf( "Thread command: %s\n", pCommand);
-    FILE * pFile = fopen(FileNameIn, "rb");
-    if ( pFile != NULL ) {
-        fclose( pFile );
-#if defined(__wasm)
-        if ( 1 ) {
-#else
-        if (system(pCommand) == -1) {
-#endif
-            fprintf(stdout, "Command \"%s\" did not succeed.\n", pCommand);
-            return 0;
-        }
-        vRes = Exa4_ManParse(FileNameOut); // FileNameOut is removed here
+    volatile int * pStop;
+    abctime        clkStop;
+} Cnf_SolveStop_t;
+static int Cnf_DataSolveCheckStop( void * pArg )
+{
+    Cnf_SolveStop_t * p = (Cnf_SolveStop_t *)pArg;
+    return (p->pStop && *p->pStop) || (p->clkStop && Abc_Clock() > p->clkStop);
+}
+static int * Cnf_DataSolvePerm( int nSize, unsigned * pState )
+{
+    // random permutation using a generator private to the caller
+    int i, k, * pPerm = ABC_ALLOC( int, nSize );
+    for ( i = 0; i < nSize; i++ )
+        pPerm[i] = i;
+    for ( i = nSize - 1; i > 0; i-- )
+    {
+        *pState ^= *pState << 13;
+        *pState ^= *pState >> 17;
+        *pState ^= *pState << 5;
+        k = (int)(*pState % (unsigned)(i + 1));
+        ABC_SWAP( int, pPerm[i], pPerm[k] );
     }
-    if (fVerbose) {
-        double SolvingTime = ((double)(Abc_Clock() - clkTotal))/((double)CLOCKS_PER_SEC);
-        if (vRes)
-            printf("Problem %2d has a solution. ", Id);
-        else if (vRes == NULL && (TimeOut == 0 || SolvingTime < (double)TimeOut))
-            printf("Problem %2d has no solution. ", Id);
-        else if (vRes == NULL)
-            printf("Problem %2d has no solution or timed out after %d sec. ", Id, TimeOut);
-        Abc_PrintTime(1, "Solving time", Abc_Clock() - clkTotal );
+    return pPerm;
+}
+Vec_Int_t * Cnf_DataSolve( Cnf_Dat_t * p, int fCadical, int Seed, int TimeOut, volatile int * pStop, int * pStatus )
+{
+    Cnf_SolveStop_t Stop;
+    Vec_Int_t * vRes = NULL;
+    int i, * pBeg, * pEnd, fOk = 1, RetValue;
+    Stop.pStop   = pStop;
+    Stop.clkStop = TimeOut ? Abc_Clock() + (abctime)TimeOut * CLOCKS_PER_SEC : 0;
+    if ( fCadical )
+    {
+        cadical_solver * pSat = cadical_solver_new();
+        ccadical_set_option( (CCaDiCaL *)pSat->p, "seed", Seed );
+        ccadical_set_terminate( (CCaDiCaL *)pSat->p, &Stop, Cnf_DataSolveCheckStop );
+        cadical_solver_setnvars( pSat, p->nVars );
+        Cnf_CnfForClause( p, pBeg, pEnd, i )
+            if ( !(fOk = cadical_solver_addclause(pSat, pBeg, pEnd)) )
+                break;
+        RetValue = fOk ? cadical_solver_solve( pSat, NULL, NULL, 0, 0, 0, 0 ) : -1;
+        if ( RetValue == 1 )
+        {
+            vRes = Vec_IntStartFull( p->nVars + 1 );
+            for ( i = 0; i < p->nVars; i++ )
+                Vec_IntWriteEntry( vRes, i + 1, cadical_solver_get_var_value(pSat, i) );
+        }
+        cadical_solver_delete( pSat );
     }
-    else if (vRes) {   
-        printf("Problem %2d has a solution. ", Id);
-        Abc_PrintTime(1, "Solving time", Abc_Clock() - clkTotal );
-        printf("(Currently waiting for %d sec for other threads to finish.)\n", TimeOut);
+    else
+    {
+        kissat_solver * pSat = kissat_solver_new();
+        unsigned State = 0x9E3779B9u ^ ((unsigned)Seed * 2654435761u);
+        int * pVarPerm = Seed ? Cnf_DataSolvePerm( p->nVars, &State ) : NULL;
+        int * pClaPerm = Seed ? Cnf_DataSolvePerm( p->nClauses, &State ) : NULL;
+        Vec_Int_t * vLits = Vec_IntAlloc( 100 );
+        int k, * pLit;
+        kissat_set_terminate( (kissat *)pSat->p, &Stop, Cnf_DataSolveCheckStop );
+        kissat_solver_setnvars( pSat, p->nVars );
+        for ( k = 0; k < p->nClauses; k++ )
+        {
+            i = pClaPerm ? pClaPerm[k] : k;
+            Vec_IntClear( vLits );
+            for ( pLit = p->pClauses[i]; pLit < p->pClauses[i+1]; pLit++ )
+                Vec_IntPush( vLits, pVarPerm ? Abc_Var2Lit(pVarPerm[Abc_Lit2Var(*pLit)], Abc_LitIsCompl(*pLit)) : *pLit );
+            if ( !(fOk = kissat_solver_addclause(pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits))) )
+                break;
+        }
+        RetValue = fOk ? kissat_solver_solve( pSat, NULL, NULL, 0, 0, 0, 0 ) : -1;
+        if ( RetValue == 1 )
+        {
+            vRes = Vec_IntStartFull( p->nVars + 1 );
+            for ( i = 0; i < p->nVars; i++ )
+                Vec_IntWriteEntry( vRes, i + 1, kissat_solver_get_var_value(pSat, pVarPerm ? pVarPerm[i] : i) );
+        }
+        kissat_solver_delete( pSat );
+        Vec_IntFree( vLits );
+        ABC_FREE( pVarPerm );
+        ABC_FREE( pClaPerm );
     }
+    *pStatus = RetValue == 1 ? 1 : (RetValue == -1 ? 0 : -1);
     return vRes;
 }
-Vec_Int_t * Cnf_RunSolverArray(int nProcs, int TimeOut, int fVerbose)
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one job of the concurrent run.]
+
+  Description [Job i solves the i-th CNF (or the only CNF, if there is
+  one) with random seed Seed+i. The first job, which finds a solution
+  (or proves UNSAT, unless fSatOnly is set), stops all other jobs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cnf_ParMan_t_
 {
-    Vec_Int_t *vRes = NULL; int i;
-    for ( i = 0; i < nProcs; i++ )
-        if ((vRes = Cnf_RunSolverOnce(i, 0, TimeOut, fVerbose))) 
-            break;
-    return vRes;
+    Vec_Ptr_t *     vCnfs;      // the CNFs to solve
+    int             nJobs;      // the number of jobs
+    int             Seed;       // the seed of the first job
+    int             fCadical;   // use CaDiCaL instead of Kissat
+    int             TimeOut;    // timeout of one job in seconds
+    int             fSatOnly;   // only the satisfying assignment is an answer
+    int             fVerbose;
+    volatile int    fStop;      // the answer is found
+    int             iNext;      // the next job to start
+    int             iWinner;    // the job giving the answer
+    int             Status;     // the answer
+    Vec_Int_t *     vRes;       // the satisfying assignment
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;
+#endif
+} Cnf_ParMan_t;
+
+static void Cnf_ParManSolveJob( Cnf_ParMan_t * p, int iJob )
+{
+    abctime clk = Abc_Clock();
+    Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Vec_PtrEntry( p->vCnfs, Vec_PtrSize(p->vCnfs) == 1 ? 0 : iJob );
+    int Status, fAnswer;
+    Vec_Int_t * vRes = Cnf_DataSolve( pCnf, p->fCadical, p->Seed + iJob, p->TimeOut, &p->fStop, &Status );
+    fAnswer = Status == 1 || (Status == 0 && !p->fSatOnly);
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    if ( p->fVerbose )
+    {
+        if ( Status == 1 )
+            printf( "Problem %2d has a solution. ", iJob );
+        else if ( Status == 0 )
+            printf( "Problem %2d has no solution. ", iJob );
+        else if ( p->fStop )
+            printf( "Problem %2d is cancelled. ", iJob );
+        else
+            printf( "Problem %2d has no solution or timed out after %d sec. ", iJob, p->TimeOut );
+        Abc_PrintTime( 1, "Solving time", Abc_Clock() - clk );
+        fflush( stdout );
+    }
+    if ( fAnswer && p->iWinner == -1 )
+    {
+        p->iWinner = iJob;
+        p->Status  = Status;
+        p->vRes    = vRes;  vRes = NULL;
+        p->fStop   = 1;
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+    Vec_IntFreeP( &vRes );
 }
 
 /**Function*************************************************************
 
   Synopsis    [Solving problems using many cores.]
 
-  Description []
+  Description [Runs nJobs jobs (see Cnf_ParManSolveJob) using nProcs
+  threads. Returns the satisfying assignment or NULL. Sets *pStatus
+  to 1 (SAT), 0 (UNSAT), or -1 (undecided) and *piWinner to the job
+  giving the answer (or -1).]
 
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
+static void Cnf_ParManStart( Cnf_ParMan_t * p, Vec_Ptr_t * vCnfs, int nJobs, int Seed, int fCadical, int TimeOut, int fSatOnly, int fVerbose )
+{
+    memset( p, 0, sizeof(Cnf_ParMan_t) );
+    p->vCnfs    = vCnfs;
+    p->nJobs    = nJobs;
+    p->Seed     = Seed;
+    p->fCadical = fCadical;
+    p->TimeOut  = TimeOut;
+    p->fSatOnly = fSatOnly;
+    p->fVerbose = fVerbose;
+    p->iWinner  = -1;
+    p->Status   = -1;
+    assert( Vec_PtrSize(vCnfs) == 1 || Vec_PtrSize(vCnfs) == nJobs );
+}
+
 #ifndef ABC_USE_PTHREADS
 
-Vec_Int_t *Cnf_RunSolver(int nProcs, int TimeOut, int fVerbose)
+Vec_Int_t * Cnf_RunSolver( Vec_Ptr_t * vCnfs, int nJobs, int Seed, int fCadical, int nProcs, int TimeOut, int fSatOnly, int fVerbose, int * pStatus, int * piWinner )
 {
-    return Cnf_RunSolverArray(nProcs, TimeOut, fVerbose);
+    Cnf_ParMan_t Par, * p = &Par;
+    int i;
+    Cnf_ParManStart( p, vCnfs, nJobs, Seed, fCadical, TimeOut, fSatOnly, fVerbose );
+    for ( i = 0; i < nJobs && !p->fStop; i++ )
+        Cnf_ParManSolveJob( p, i );
+    *pStatus  = p->Status;
+    *piWinner = p->iWinner;
+    return p->vRes;
 }
 
 #else // pthreads are used
 
 #define PAR_THR_MAX 100
-typedef struct Cnf_ThData_t_
-{
-    Vec_Int_t *vRes;
-    int Index;
-    int Rand;
-    int nTimeOut;
-    int fWorking;
-    int fVerbose;
-} Cnf_ThData_t;
-
-void *Cnf_WorkerThread(void *pArg)
+void * Cnf_WorkerThread( void * pArg )
 {
-    Cnf_ThData_t *pThData = (Cnf_ThData_t *)pArg;
-    volatile int *pPlace = &pThData->fWorking;
-    while (1)
+    Cnf_ParMan_t * p = (Cnf_ParMan_t *)pArg;
+    int iJob;
+    while ( 1 )
     {
-        while (*pPlace == 0)
-            ;
-        assert(pThData->fWorking);
-        if (pThData->Index == -1)
-        {
-            pthread_exit(NULL);
-            assert(0);
-            return NULL;
-        }
-        pThData->vRes = Cnf_RunSolverOnce(pThData->Index, pThData->Rand, pThData->nTimeOut, pThData->fVerbose);
-        pThData->fWorking = 0;
+        pthread_mutex_lock( &p->Mutex );
+        iJob = p->fStop ? p->nJobs : p->iNext++;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( iJob >= p->nJobs )
+            break;
+        Cnf_ParManSolveJob( p, iJob );
     }
-    assert(0);
+    pthread_exit( NULL );
+    assert( 0 );
     return NULL;
 }
-
-Vec_Int_t *Cnf_RunSolver(int nProcs, int TimeOut, int fVerbose)
+Vec_Int_t * Cnf_RunSolver( Vec_Ptr_t * vCnfs, int nJobs, int Seed, int fCadical, int nProcs, int TimeOut, int fSatOnly, int fVerbose, int * pStatus, int * piWinner )
 {
-    Vec_Int_t *vRes = NULL;
-    Cnf_ThData_t ThData[PAR_THR_MAX];
     pthread_t WorkerThread[PAR_THR_MAX];
-    int i, k, status;
-    if (fVerbose)
-        printf("Running concurrent solving with %d processes.\n", nProcs);
-    fflush(stdout);
-    if (nProcs < 2)
-        return Cnf_RunSolverArray(nProcs, TimeOut, fVerbose);
-    // subtract manager thread
-    // nProcs--;
-    assert(nProcs >= 1 && nProcs <= PAR_THR_MAX);
-    // start threads
-    for (i = 0; i < nProcs; i++)
-    {
-        ThData[i].vRes     = NULL;
-        ThData[i].Index    = -1;
-        ThData[i].Rand     = Abc_Random(0) % 0x1000000;
-        ThData[i].nTimeOut = TimeOut;
-        ThData[i].fWorking = 0;
-        ThData[i].fVerbose = fVerbose;
-        status = pthread_create(WorkerThread + i, NULL, Cnf_WorkerThread, (void *)(ThData + i));
-        assert(status == 0);
-    }
-    // look at the threads
-    for (k = 0; k < nProcs;)
-    {
-        for (i = 0; i < nProcs; i++)
-        {
-            if (ThData[i].fWorking)
-                continue;
-            if (ThData[i].vRes)
-            {
-                k = nProcs;
-                break;
-            }
-            ThData[i].Index = k++;
-            ThData[i].fWorking = 1;
-            break;
-        }
-    }
-    // wait till threads finish
-    for (i = 0; i < nProcs; i++)
-        if (ThData[i].fWorking)
-            i = -1;
-    // stop threads
-    for (i = 0; i < nProcs; i++)
+    Cnf_ParMan_t Par, * p = &Par;
+    int i, status;
+    Cnf_ParManStart( p, vCnfs, nJobs, Seed, fCadical, TimeOut, fSatOnly, fVerbose );
+    nProcs = Abc_MaxInt( 1, Abc_MinInt(Abc_MinInt(nProcs, nJobs), PAR_THR_MAX) );
+    if ( fVerbose )
+        printf( "Running concurrent solving of %d problems with %d threads.\n", nJobs, nProcs );
+    fflush( stdout );
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    for ( i = 0; i < nProcs; i++ )
     {
-        assert(!ThData[i].fWorking);
-        if (ThData[i].vRes && vRes == NULL)
-        {
-            vRes = ThData[i].vRes;
-            ThData[i].vRes = NULL;
-        }
-        Vec_IntFreeP(&ThData[i].vRes);
-        // stop
-        ThData[i].Index = -1;
-        ThData[i].fWorking = 1;
+        status = pthread_create( WorkerThread + i, NULL, Cnf_WorkerThread, (void *)p );
+        assert( status == 0 );
     }
-    return vRes;
+    for ( i = 0; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    pthread_mutex_destroy( &p->Mutex );
+    *pStatus  = p->Status;
+    *piWinner = p->iWinner;
+    return p->vRes;
 }
 
 #endif // pthreads are used
@@ -499,9 +574,55 @@ unsigned char *Cnf_DataDeriveLitPolarities(Cnf_Dat_t *p)
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Reads the clauses in the binary format.]
 
-  Description []
+  Description [See Cnf_DataWriteIntoFileFast() for the description of 
+  the format. Returns 0 if the clauses are incorrect.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_DataReadBinaryClauses(FILE *pFile, int nVars, int nClas, Vec_Int_t *vClas, Vec_Int_t *vLits)
+{
+    unsigned uCode;
+    int c, Shift, i;
+    for (i = 0; i < nClas; i++)
+    {
+        Vec_IntPush(vClas, Vec_IntSize(vLits));
+        while (1)
+        {
+            uCode = 0;
+            for (Shift = 0; (c = fgetc(pFile)) != EOF; Shift += 7)
+            {
+                uCode |= (unsigned)(c & 0x7f) << Shift;
+                if (!(c & 0x80))
+                    break;
+            }
+            if (c == EOF)
+            {
+                printf("Unexpected end of file in clause %d.\n", i);
+                return 0;
+            }
+            if (uCode == 0)
+                break;
+            if (uCode < 2 || uCode - 2 >= 2 * (unsigned)nVars)
+            {
+                printf("Literal %d is out-of-bound for %d variables.\n", (int)uCode - 2, nVars);
+                return 0;
+            }
+            Vec_IntPush(vLits, (int)uCode - 2);
+        }
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads CNF from the file in the DIMACS format.]
+
+  Description [Also reads the binary format with the header "p bcnf".]
 
   SideEffects []
 
@@ -511,7 +632,7 @@ unsigned char *Cnf_DataDeriveLitPolarities(Cnf_Dat_t *p)
 Cnf_Dat_t *Cnf_DataReadFromFile(char *pFileName)
 {
     int MaxLine = 1000000;
-    int Var, Lit, nVars = -1, nClas = -1, i, Entry, iLine = 0;
+    int Var, Lit, nVars = -1, nClas = -1, i, Entry, iLine = 0, fBinary;
     Cnf_Dat_t *pCnf = NULL;
     Vec_Int_t *vClas = NULL;
     Vec_Int_t *vLits = NULL;
@@ -531,7 +652,8 @@ Cnf_Dat_t *Cnf_DataReadFromFile(char *pFileName)
         if (pBuffer[0] == 'p')
         {
             pToken = strtok(pBuffer + 1, " \t");
-            if (strcmp(pToken, "cnf"))
+            fBinary = pToken && !strcmp(pToken, "bcnf");
+            if (pToken == NULL || (!fBinary && strcmp(pToken, "cnf")))
             {
                 printf("Incorrect input file.\n");
                 goto finish;
@@ -548,6 +670,12 @@ Cnf_Dat_t *Cnf_DataReadFromFile(char *pFileName)
             // temp storage
             vClas = Vec_IntAlloc(nClas + 1);
             vLits = Vec_IntAlloc(nClas * 8);
+            if (fBinary)
+            {
+                if (!Cnf_DataReadBinaryClauses(pFile, nVars, nClas, vClas, vLits))
+                    goto finish;
+                break;
+            }
             continue;
         }
         pToken = strtok(pBuffer, " \t\r\n");
@@ -754,18 +882,21 @@ Vec_Int_t *Cnf_GenRandLits(int iVarBeg, int iVarEnd, int nLits, int Value, int R
     fflush(stdout);
     return vLits;
 }
-void Cnf_SplitCnfFile(char * pFileName, int nParts, int iVarBeg, int iVarEnd, int nLits, int Value, int Rand, int fPrepro, int fVerbose)
+Vec_Ptr_t * Cnf_SplitCnf(Cnf_Dat_t * p, int nParts, int iVarBeg, int iVarEnd, int nLits, int Value, int Rand, int fPrepro, int fVerbose)
 {
-    Cnf_Dat_t *p = Cnf_DataReadFromFile(pFileName); int k;
+    Vec_Ptr_t *vCnfs = Vec_PtrAlloc(nParts); int k;
     if (iVarEnd == ABC_INFINITY)
         iVarEnd = p->nVars;
     for (k = 0; k < nParts; k++)
     {
         Vec_Int_t *vLits = Cnf_GenRandLits(iVarBeg, iVarEnd, nLits, Value, Rand, fVerbose);
         Cnf_Dat_t *pCnf = Cnf_DataDupCofArray(p, vLits);
-        char FileName[100];  sprintf(FileName, "%02d.cnf", k);
+        Vec_IntFree(vLits);
         if ( fPrepro ) {
-            char Command[1000];   
+            // the preprocessor is an external binary, so only this step goes through the files
+            char Command[1000], FileName[100];
+            Cnf_Dat_t *pCnfPre = NULL;
+            sprintf(FileName, "%02d.cnf", k);
             sprintf(Command, "satelite --verbosity=0 -pre temp.cnf %s", FileName);
             Cnf_DataWriteIntoFile(pCnf, "temp.cnf", 0, NULL, NULL);
 #if defined(__wasm)
@@ -774,30 +905,25 @@ void Cnf_SplitCnfFile(char * pFileName, int nParts, int iVarBeg, int iVarEnd, in
             if (system(Command) == -1) {
 #endif
                 fprintf(stdout, "Command \"%s\" did not succeed. Preprocessing skipped.\n", Command);
-                Cnf_DataWriteIntoFile(pCnf, FileName, 0, NULL, NULL);
             }
+            else if ((pCnfPre = Cnf_DataReadFromFile(FileName)))
+                Cnf_DataFree(pCnf), pCnf = pCnfPre;
             unlink("temp.cnf");
+            unlink(FileName);
         }
-        else 
-            Cnf_DataWriteIntoFile(pCnf, FileName, 0, NULL, NULL);
-        Cnf_DataFree(pCnf);
-        Vec_IntFree(vLits);
-    }    
-    Cnf_DataFree(p);
-}
-void Cnf_SplitCnfCleanup(int nParts)
-{
-    char FileName[100];  int k;
-    for (k = 0; k < nParts; k++) {
-        sprintf(FileName, "%02d.cnf", k);
-        unlink(FileName);
-    }   
+        Vec_PtrPush(vCnfs, pCnf);
+    }
+    return vCnfs;
 }
 void Cnf_SplitSat(char *pFileName, int iVarBeg, int iVarEnd, int nLits, int Value, int TimeOut, int nProcs, int nIters, int Seed, int fPrepro, int fVerbose)
 {
     abctime clk = Abc_Clock();
+    Cnf_Dat_t *p = Cnf_DataReadFromFile(pFileName);
+    Vec_Ptr_t *vCnfs;
     Vec_Int_t *vSol = NULL;
-    int i, Rand = 0;
+    int i, k, Rand = 0, Status, iWinner;
+    if ( p == NULL )
+        return;
     if ( nIters == 0 )
         nIters = ABC_INFINITY;
     Abc_Random(1);
@@ -807,9 +933,11 @@ void Cnf_SplitSat(char *pFileName, int iVarBeg, int iVarEnd, int nLits, int Valu
     for (i = 0; i < nIters && !vSol; i++)
     {
         abctime clk2 = Abc_Clock();
-        Cnf_SplitCnfFile(pFileName, nProcs, iVarBeg, iVarEnd, nLits, Value, Rand, fPrepro, fVerbose);
-        vSol = Cnf_RunSolver(nProcs, TimeOut, fVerbose);
-        Cnf_SplitCnfCleanup(nProcs);
+        vCnfs = Cnf_SplitCnf(p, nProcs, iVarBeg, iVarEnd, nLits, Value, Rand, fPrepro, fVerbose);
+        vSol = Cnf_RunSolver(vCnfs, nProcs, Abc_Random(0) % 0x1000000, 0, nProcs, TimeOut, 1, fVerbose, &Status, &iWinner);
+        for (k = 0; k < Vec_PtrSize(vCnfs); k++)
+            Cnf_DataFree((Cnf_Dat_t *)Vec_PtrEntry(vCnfs, k));
+        Vec_PtrFree(vCnfs);
         if (fVerbose) {
             printf( "Finished iteration %d.  ", i);    
             Abc_PrintTime(0, "Time", Abc_Clock() - clk2);
@@ -818,6 +946,7 @@ void Cnf_SplitSat(char *pFileName, int iVarBeg, int iVarEnd, int nLits, int Valu
     printf("%solution is found.  ", vSol ? "S" : "No s");
     Abc_PrintTime(0, "Total time", Abc_Clock() - clk);
     Vec_IntFreeP(&vSol);
+    Cnf_DataFree(p);
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define CNF_WRITE_SEG_SIZE  (1 << 12)  // the number of mapped nodes in one segment
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -185,65 +187,234 @@ int Cnf_IsopWriteCube( int Cube, int nVars, int * pVars, int * pLiterals )
 
 /**Function*************************************************************
 
-  Synopsis    [Derives CNF for the mapping.]
+  Synopsis    [Counts the clauses and the literals of the mapped node.]
 
-  Description [The last argument shows the number of last outputs
-  of the manager, which will not be converted into clauses but the
-  new variables for which will be introduced.]
+  Description [Returns the number of clauses and adds the number of 
+  literals to *pnLiterals.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
+static inline int Cnf_ManCountNode( Cnf_Man_t * p, Aig_Obj_t * pObj, int * pnLiterals )
 {
-    int fChangeVariableOrder = 0; // should be set to 0 to improve performance
-    Aig_Obj_t * pObj;
-    Cnf_Dat_t * pCnf;
-    Cnf_Cut_t * pCut;
-    Vec_Int_t * vCover, * vSopTemp;
-    int OutVar, PoVar, pVars[32], * pLits, ** pClas;
+    Cnf_Cut_t * pCut = Cnf_ObjBestCut( pObj );
     unsigned uTruth;
-    int i, k, nLiterals, nClauses, Cube, Number;
+    int nClauses = 0;
+    assert( Aig_ObjIsNode(pObj) );
+    // positive polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
+        *pnLiterals += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
+        assert( p->pSopSizes[uTruth] >= 0 );
+        nClauses += p->pSopSizes[uTruth];
+    }
+    else
+    {
+        *pnLiterals += Cnf_IsopCountLiterals( pCut->vIsop[1], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[1]);
+        nClauses += Vec_IntSize(pCut->vIsop[1]);
+    }
+    // negative polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
+        *pnLiterals += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
+        assert( p->pSopSizes[uTruth] >= 0 );
+        nClauses += p->pSopSizes[uTruth];
+    }
+    else
+    {
+        *pnLiterals += Cnf_IsopCountLiterals( pCut->vIsop[0], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[0]);
+        nClauses += Vec_IntSize(pCut->vIsop[0]);
+    }
+    return nClauses;
+}
 
-    // count the number of literals and clauses
-    nLiterals = 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
-    nClauses = 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
-    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+/**Function*************************************************************
+
+  Synopsis    [Writes the clauses of the mapped node.]
+
+  Description [Writes the literals starting at pLits and the beginnings
+  of the clauses starting at *ppClas. Returns the end of the literals.
+  The node's clauses depend only on the variable numbers, so that 
+  different nodes can be written by different threads, each of them
+  using its own temporary array (vSopTemp).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int * Cnf_ManWriteNode( Cnf_Man_t * p, Aig_Obj_t * pObj, int * pVarNums, Vec_Int_t * vSopTemp, int *** ppClas, int * pLits )
+{
+    Cnf_Cut_t * pCut = Cnf_ObjBestCut( pObj );
+    Vec_Int_t * vCover;
+    int OutVar, pVars[32], ** pClas = *ppClas;
+    unsigned uTruth;
+    int k, Cube;
+
+    // save variables of this cut
+    OutVar = pVarNums[ pObj->Id ];
+    for ( k = 0; k < (int)pCut->nFanins; k++ )
     {
-        assert( Aig_ObjIsNode(pObj) );
-        pCut = Cnf_ObjBestCut( pObj );
+        pVars[k] = pVarNums[ pCut->pFanins[k] ];
+        assert( pVars[k] <= Aig_ManObjNumMax(p->pManAig) );
+    }
 
-        // positive polarity of the cut
-        if ( pCut->nFanins < 5 )
+    // positive polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
+        Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
+        vCover = vSopTemp;
+    }
+    else
+        vCover = pCut->vIsop[1];
+    Vec_IntForEachEntry( vCover, Cube, k )
+    {
+        *pClas++ = pLits;
+        *pLits++ = 2 * OutVar; 
+        pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
+    }
+
+    // negative polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
+        Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
+        vCover = vSopTemp;
+    }
+    else
+        vCover = pCut->vIsop[0];
+    Vec_IntForEachEntry( vCover, Cube, k )
+    {
+        *pClas++ = pLits;
+        *pLits++ = 2 * OutVar + 1; 
+        pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
+    }
+    *ppClas = pClas;
+    return pLits;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Assigns the CNF variables.]
+
+  Description [Assigns variables to the last (nOutputs) POs, followed by 
+  the internal nodes, the PIs, and the constant node. Returns the number 
+  of variables.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_ManAssignVarNums( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int * pVarNums )
+{
+    Aig_Obj_t * pObj;
+    int i, Number = 1;
+    for ( i = 0; i < Aig_ManObjNumMax(p->pManAig); i++ )
+        pVarNums[i] = -1;
+    // assign variables to the last (nOutputs) POs
+    if ( nOutputs )
+    {
+        if ( Aig_ManRegNum(p->pManAig) == 0 )
         {
-            uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
-            nLiterals += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
-            assert( p->pSopSizes[uTruth] >= 0 );
-            nClauses += p->pSopSizes[uTruth];
+            assert( nOutputs == Aig_ManCoNum(p->pManAig) );
+            Aig_ManForEachCo( p->pManAig, pObj, i )
+                pVarNums[pObj->Id] = Number++;
         }
         else
         {
-            nLiterals += Cnf_IsopCountLiterals( pCut->vIsop[1], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[1]);
-            nClauses += Vec_IntSize(pCut->vIsop[1]);
+            assert( nOutputs == Aig_ManRegNum(p->pManAig) );
+            Aig_ManForEachLiSeq( p->pManAig, pObj, i )
+                pVarNums[pObj->Id] = Number++;
         }
-        // negative polarity of the cut
-        if ( pCut->nFanins < 5 )
+    }
+    // assign variables to the internal nodes
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+        pVarNums[pObj->Id] = Number++;
+    // assign variables to the PIs and constant node
+    Aig_ManForEachCi( p->pManAig, pObj, i )
+        pVarNums[pObj->Id] = Number++;
+    pVarNums[Aig_ManConst1(p->pManAig)->Id] = Number++;
+    return Number;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the constant clause and the output clauses.]
+
+  Description [Returns the end of the literals.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int * Cnf_ManWriteOutputs( Cnf_Man_t * p, int nOutputs, int * pVarNums, int *** ppClas, int * pLits )
+{
+    Aig_Obj_t * pObj;
+    int i, OutVar, PoVar, ** pClas = *ppClas;
+    // write the constant literal
+    OutVar = pVarNums[ Aig_ManConst1(p->pManAig)->Id ];
+    assert( OutVar <= Aig_ManObjNumMax(p->pManAig) );
+    *pClas++ = pLits;
+    *pLits++ = 2 * OutVar; 
+
+    // write the output literals
+    Aig_ManForEachCo( p->pManAig, pObj, i )
+    {
+        OutVar = pVarNums[ Aig_ObjFanin0(pObj)->Id ];
+        if ( i < Aig_ManCoNum(p->pManAig) - nOutputs )
         {
-            uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
-            nLiterals += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
-            assert( p->pSopSizes[uTruth] >= 0 );
-            nClauses += p->pSopSizes[uTruth];
+            *pClas++ = pLits;
+            *pLits++ = 2 * OutVar + Aig_ObjFaninC0(pObj); 
         }
         else
         {
-            nLiterals += Cnf_IsopCountLiterals( pCut->vIsop[0], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[0]);
-            nClauses += Vec_IntSize(pCut->vIsop[0]);
+            PoVar = pVarNums[ pObj->Id ];
+            // first clause
+            *pClas++ = pLits;
+            *pLits++ = 2 * PoVar; 
+            *pLits++ = 2 * OutVar + !Aig_ObjFaninC0(pObj); 
+            // second clause
+            *pClas++ = pLits;
+            *pLits++ = 2 * PoVar + 1; 
+            *pLits++ = 2 * OutVar + Aig_ObjFaninC0(pObj); 
         }
-//printf( "%d ", nClauses-(1 + Aig_ManCoNum( p->pManAig )) );
     }
-//printf( "\n" );
+    *ppClas = pClas;
+    return pLits;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF for the mapping.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
+{
+    int fChangeVariableOrder = 0; // should be set to 0 to improve performance
+    Aig_Obj_t * pObj;
+    Cnf_Dat_t * pCnf;
+    Vec_Int_t * vSopTemp;
+    int * pLits, ** pClas;
+    int i, nLiterals, nClauses, Number;
+
+    // count the number of literals and clauses
+    nLiterals = 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
+    nClauses = 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+        nClauses += Cnf_ManCountNode( p, pObj, &nLiterals );
 
     // allocate CNF
     pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
@@ -255,40 +426,13 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
     pCnf->pClauses[nClauses] = pCnf->pClauses[0] + nLiterals;
     // create room for variable numbers
     pCnf->pVarNums = ABC_ALLOC( int, Aig_ManObjNumMax(p->pManAig) );
-//    memset( pCnf->pVarNums, 0xff, sizeof(int) * Aig_ManObjNumMax(p->pManAig) );
-    for ( i = 0; i < Aig_ManObjNumMax(p->pManAig); i++ )
-        pCnf->pVarNums[i] = -1;
 
     if ( !fChangeVariableOrder )
-    {
-        // assign variables to the last (nOutputs) POs
-        Number = 1;
-        if ( nOutputs )
-        {
-            if ( Aig_ManRegNum(p->pManAig) == 0 )
-            {
-                assert( nOutputs == Aig_ManCoNum(p->pManAig) );
-                Aig_ManForEachCo( p->pManAig, pObj, i )
-                    pCnf->pVarNums[pObj->Id] = Number++;
-            }
-            else
-            {
-                assert( nOutputs == Aig_ManRegNum(p->pManAig) );
-                Aig_ManForEachLiSeq( p->pManAig, pObj, i )
-                    pCnf->pVarNums[pObj->Id] = Number++;
-            }
-        }
-        // assign variables to the internal nodes
-        Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
-            pCnf->pVarNums[pObj->Id] = Number++;
-        // assign variables to the PIs and constant node
-        Aig_ManForEachCi( p->pManAig, pObj, i )
-            pCnf->pVarNums[pObj->Id] = Number++;
-        pCnf->pVarNums[Aig_ManConst1(p->pManAig)->Id] = Number++;
-        pCnf->nVars = Number;
-    }
+        pCnf->nVars = Cnf_ManAssignVarNums( p, vMapped, nOutputs, pCnf->pVarNums );
     else
     {
+        for ( i = 0; i < Aig_ManObjNumMax(p->pManAig); i++ )
+            pCnf->pVarNums[i] = -1;
         // assign variables to the last (nOutputs) POs
         Number = Aig_ManObjNumMax(p->pManAig) + 1;
         pCnf->nVars = Number + 1;
@@ -322,79 +466,9 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
     pLits = pCnf->pClauses[0];
     pClas = pCnf->pClauses;
     Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
-    {
-        pCut = Cnf_ObjBestCut( pObj );
-
-        // save variables of this cut
-        OutVar = pCnf->pVarNums[ pObj->Id ];
-        for ( k = 0; k < (int)pCut->nFanins; k++ )
-        {
-            pVars[k] = pCnf->pVarNums[ pCut->pFanins[k] ];
-            assert( pVars[k] <= Aig_ManObjNumMax(p->pManAig) );
-        }
-
-        // positive polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
-            Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
-            vCover = vSopTemp;
-        }
-        else
-            vCover = pCut->vIsop[1];
-        Vec_IntForEachEntry( vCover, Cube, k )
-        {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar; 
-            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
-        }
-
-        // negative polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
-            Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
-            vCover = vSopTemp;
-        }
-        else
-            vCover = pCut->vIsop[0];
-        Vec_IntForEachEntry( vCover, Cube, k )
-        {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar + 1; 
-            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
-        }
-    }
+        pLits = Cnf_ManWriteNode( p, pObj, pCnf->pVarNums, vSopTemp, &pClas, pLits );
     Vec_IntFree( vSopTemp );
- 
-    // write the constant literal
-    OutVar = pCnf->pVarNums[ Aig_ManConst1(p->pManAig)->Id ];
-    assert( OutVar <= Aig_ManObjNumMax(p->pManAig) );
-    *pClas++ = pLits;
-    *pLits++ = 2 * OutVar; 
-
-    // write the output literals
-    Aig_ManForEachCo( p->pManAig, pObj, i )
-    {
-        OutVar = pCnf->pVarNums[ Aig_ObjFanin0(pObj)->Id ];
-        if ( i < Aig_ManCoNum(p->pManAig) - nOutputs )
-        {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar + Aig_ObjFaninC0(pObj); 
-        }
-        else
-        {
-            PoVar = pCnf->pVarNums[ pObj->Id ];
-            // first clause
-            *pClas++ = pLits;
-            *pLits++ = 2 * PoVar; 
-            *pLits++ = 2 * OutVar + !Aig_ObjFaninC0(pObj); 
-            // second clause
-            *pClas++ = pLits;
-            *pLits++ = 2 * PoVar + 1; 
-            *pLits++ = 2 * OutVar + Aig_ObjFaninC0(pObj); 
-        }
-    }
+    pLits = Cnf_ManWriteOutputs( p, nOutputs, pCnf->pVarNums, &pClas, pLits );
 
     // verify that the correct number of literals and clauses was written
     assert( pLits - pCnf->pClauses[0] == nLiterals );
@@ -403,6 +477,166 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
     return pCnf;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes CNF for the mapping directly into the stream.]
+
+  Description [Produces the same clauses as Cnf_ManWriteCnf() followed
+  by Cnf_DataTranformPolarity(pCnf, 0), if fChangePol is set, without 
+  building the complete clause array. The mapped nodes are divided into 
+  segments of consecutive nodes in the topological order. The segments 
+  are converted into clauses and formatted by nProcs threads and written 
+  in order. Returns the number of variables, clauses, and literals
+  in pStats[0], pStats[1], and pStats[2]. Returns the peak memory used
+  by the clause buffers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cnf_WriteSeg_t_ Cnf_WriteSeg_t;
+struct Cnf_WriteSeg_t_
+{
+    Cnf_Man_t *      p;          // the CNF manager
+    Vec_Ptr_t *      vMapped;    // the mapped nodes
+    int *            pVarNums;   // the variable numbers
+    char *           pPolar;     // the variables to complement (or NULL)
+    int              iStart;     // the first mapped node
+    int              iStop;      // the last mapped node + 1
+    int              fBinary;    // the format
+    Vec_Int_t *      vSopTemp;   // the temporary cover
+    Vec_Int_t *      vLits;      // the literals of the segment
+    Vec_Ptr_t *      vClas;      // the clauses of the segment
+    int              nBytes;     // the number of formatted bytes
+    int              nCap;       // the buffer size
+    char *           pBuffer;    // the formatted segment
+};
+static void Cnf_ManWriteFlipLits( int * pLits, int nLits, char * pPolar )
+{
+    int i;
+    if ( pPolar )
+        for ( i = 0; i < nLits; i++ )
+            if ( pPolar[Abc_Lit2Var(pLits[i])] )
+                pLits[i] = Abc_LitNot( pLits[i] );
+}
+static void * Cnf_ManWriteSegment( void * pArg )
+{
+    Cnf_WriteSeg_t * pSeg = (Cnf_WriteSeg_t *)pArg;
+    Aig_Obj_t * pObj;
+    int i, nClauses = 0, nLiterals = 0, nCap, * pLits, ** pClas;
+    // derive the clauses
+    Vec_PtrForEachEntryStartStop( Aig_Obj_t *, pSeg->vMapped, pObj, i, pSeg->iStart, pSeg->iStop )
+        nClauses += Cnf_ManCountNode( pSeg->p, pObj, &nLiterals );
+    Vec_IntGrow( pSeg->vLits, nLiterals );
+    Vec_PtrGrow( pSeg->vClas, nClauses + 1 );
+    pLits = Vec_IntArray( pSeg->vLits );
+    pClas = (int **)Vec_PtrArray( pSeg->vClas );
+    Vec_PtrForEachEntryStartStop( Aig_Obj_t *, pSeg->vMapped, pObj, i, pSeg->iStart, pSeg->iStop )
+        pLits = Cnf_ManWriteNode( pSeg->p, pObj, pSeg->pVarNums, pSeg->vSopTemp, &pClas, pLits );
+    *pClas = pLits;
+    assert( pLits - Vec_IntArray(pSeg->vLits) == nLiterals );
+    assert( pClas - (int **)Vec_PtrArray(pSeg->vClas) == nClauses );
+    Cnf_ManWriteFlipLits( Vec_IntArray(pSeg->vLits), nLiterals, pSeg->pPolar );
+    // format the clauses
+    nCap = CNF_OUT_LIT_MAX * nLiterals + 2 * nClauses;
+    if ( pSeg->nCap < nCap )
+    {
+        pSeg->nCap    = Abc_MaxInt( nCap, 2 * pSeg->nCap );
+        pSeg->pBuffer = ABC_REALLOC( char, pSeg->pBuffer, pSeg->nCap );
+    }
+    pSeg->nBytes = Cnf_OutFormatClauses( pSeg->pBuffer, (int **)Vec_PtrArray(pSeg->vClas), 0, nClauses, 0, pSeg->fBinary );
+    return NULL;
+}
+word Cnf_ManWriteCnfStream( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int fChangePol, Cnf_Out_t * pOut, int fBinary, int nProcs, int * pStats )
+{
+    Cnf_WriteSeg_t Segs[CNF_OUT_THR_MAX];
+    Aig_Obj_t * pObj;
+    char * pPolar = NULL, * pBuffer;
+    int * pVarNums, * pLits, * pLitsOut, ** pClas, ** pClasOut;
+    int i, k, nSegs, nBytes, nVars, nLiterals, nClauses, nOutLits, nOutClas;
+    word nMemory = 0;
+    nProcs = Abc_MinInt( Abc_MaxInt(nProcs, 1), CNF_OUT_THR_MAX );
+#ifndef ABC_USE_PTHREADS
+    nProcs = 1;
+#endif
+    // count the number of literals and clauses
+    nOutLits  = 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
+    nOutClas  = 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
+    nLiterals = nOutLits;
+    nClauses  = nOutClas;
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+        nClauses += Cnf_ManCountNode( p, pObj, &nLiterals );
+    // assign variables
+    pVarNums = ABC_ALLOC( int, Aig_ManObjNumMax(p->pManAig) );
+    nVars = Cnf_ManAssignVarNums( p, vMapped, nOutputs, pVarNums );
+    if ( fChangePol )
+    {
+        pPolar = ABC_CALLOC( char, nVars );
+        Aig_ManForEachObj( p->pManAig, pObj, i )
+            if ( !Aig_ObjIsCo(pObj) && pVarNums[pObj->Id] >= 0 )
+                pPolar[ pVarNums[pObj->Id] ] = pObj->fPhase;
+    }
+    Cnf_OutWriteHeader( pOut, nVars, nClauses, fBinary );
+    // write the clauses of the mapped nodes
+    memset( Segs, 0, sizeof(Cnf_WriteSeg_t) * nProcs );
+    for ( k = 0; k < nProcs; k++ )
+    {
+        Segs[k].p        = p;
+        Segs[k].vMapped  = vMapped;
+        Segs[k].pVarNums = pVarNums;
+        Segs[k].pPolar   = pPolar;
+        Segs[k].fBinary  = fBinary;
+        Segs[k].vSopTemp = Vec_IntAlloc( 16 );
+        Segs[k].vLits    = Vec_IntAlloc( 0 );
+        Segs[k].vClas    = Vec_PtrAlloc( 0 );
+    }
+    for ( i = 0; i < Vec_PtrSize(vMapped); i += nSegs * CNF_WRITE_SEG_SIZE )
+    {
+        nSegs = Abc_MinInt( nProcs, (Vec_PtrSize(vMapped) - i + CNF_WRITE_SEG_SIZE - 1) / CNF_WRITE_SEG_SIZE );
+        for ( k = 0; k < nSegs; k++ )
+        {
+            Segs[k].iStart = i + k * CNF_WRITE_SEG_SIZE;
+            Segs[k].iStop  = Abc_MinInt( Segs[k].iStart + CNF_WRITE_SEG_SIZE, Vec_PtrSize(vMapped) );
+        }
+        Cnf_OutRunSegments( Cnf_ManWriteSegment, Segs, sizeof(Cnf_WriteSeg_t), nSegs );
+        for ( k = 0; k < nSegs; k++ )
+            Cnf_OutWrite( pOut, Segs[k].pBuffer, Segs[k].nBytes );
+    }
+    for ( k = 0; k < nProcs; k++ )
+    {
+        nMemory += Segs[k].nCap + 4 * Vec_IntCap(Segs[k].vLits) + 8 * Vec_PtrCap(Segs[k].vClas) + 4 * Vec_IntCap(Segs[k].vSopTemp);
+        Vec_IntFree( Segs[k].vSopTemp );
+        Vec_IntFree( Segs[k].vLits );
+        Vec_PtrFree( Segs[k].vClas );
+        ABC_FREE( Segs[k].pBuffer );
+    }
+    // write the constant clause and the output clauses
+    pLitsOut = ABC_ALLOC( int, nOutLits );
+    pClasOut = ABC_ALLOC( int *, nOutClas + 1 );
+    pLits = pLitsOut;
+    pClas = pClasOut;
+    pLits = Cnf_ManWriteOutputs( p, nOutputs, pVarNums, &pClas, pLits );
+    *pClas = pLits;
+    assert( pLits - pLitsOut == nOutLits );
+    assert( pClas - pClasOut == nOutClas );
+    Cnf_ManWriteFlipLits( pLitsOut, nOutLits, pPolar );
+    pBuffer = ABC_ALLOC( char, CNF_OUT_LIT_MAX * nOutLits + 2 * nOutClas );
+    nBytes  = Cnf_OutFormatClauses( pBuffer, pClasOut, 0, nOutClas, 0, fBinary );
+    Cnf_OutWrite( pOut, pBuffer, nBytes );
+    ABC_FREE( pBuffer );
+    if ( !fBinary )
+        Cnf_OutPrintf( pOut, "\n" );
+    nMemory += 16 * (word)nOutLits + 10 * (word)nOutClas;
+    ABC_FREE( pLitsOut );
+    ABC_FREE( pClasOut );
+    ABC_FREE( pVarNums );
+    ABC_FREE( pPolar );
+    pStats[0] = nVars;
+    pStats[1] = nClauses;
+    pStats[2] = nLiterals;
+    return nMemory;
+}
 
 /**Function*************************************************************
 
@@ -1,6 +1,18 @@
 #include "gtest/gtest.h"
 
+#include <dirent.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <map>
+#include <string>
+
 #include "aig/gia/gia.h"
+#include "base/main/main.h"
+#include "base/cmd/cmd.h"
+#include "misc/util/utilSimd.h"
+#include "proof/cec/cec.h"
+#include "sat/glucose2/AbcGlucose2.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -51,4 +63,317 @@ TEST(GiaTest, CanAddAnAndGate) {
   Gia_ManStop(aig_manager);
 }
 
+TEST(GiaTest, CanGrowObjectStorage) {
+  Gia_Man_t* aig_manager =  Gia_ManStart(1);
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  int and_output = Gia_ManAppendAnd(aig_manager, input1, input2);
+  for (int i = 0; i < 1000; i++)
+    and_output = Gia_ManAppendAnd(aig_manager, and_output, Abc_LitNot(input1 + 2 * (i % 2)));
+  Gia_ManAppendCo(aig_manager, and_output);
+
+  EXPECT_EQ(Gia_ManAndNum(aig_manager), 1001);
+  EXPECT_GE(aig_manager->nObjsAlloc, Gia_ManObjNum(aig_manager));
+  EXPECT_LE(aig_manager->nObjsAlloc, GIA_OBJ_MAX);
+  Gia_Obj_t* pObj = Gia_ManObj(aig_manager, Abc_Lit2Var(and_output));
+  EXPECT_EQ(Gia_ObjFaninId1p(aig_manager, pObj), Abc_Lit2Var(and_output) - 1);
+  EXPECT_TRUE(Gia_ObjIsCi(Gia_ManCi(aig_manager, 1)));
+  EXPECT_TRUE(Gia_ObjIsConst0(Gia_ManConst0(aig_manager)));
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, ParallelRehashMatchesSequential) {
+  Gia_Man_t* aig_manager =  Gia_ManStart(100);
+  Vec_Int_t* literals = Vec_IntAlloc(100);
+  for (int i = 0; i < 500; i++)
+    Vec_IntPush(literals, Gia_ManAppendCi(aig_manager));
+  // random unhashed AND gates with many structural duplicates
+  Abc_Random(1);
+  for (int i = 0; i < 20000; i++) {
+    int lit0 = Vec_IntEntry(literals, Abc_Random(0) % Vec_IntSize(literals));
+    int lit1 = Vec_IntEntry(literals, Abc_Random(0) % Vec_IntSize(literals));
+    if (Abc_Lit2Var(lit0) == Abc_Lit2Var(lit1))
+      continue;
+    Vec_IntPush(literals, Gia_ManAppendAnd(aig_manager, Abc_LitNotCond(lit0, i & 1), Abc_LitNotCond(lit1, i & 2)));
+    if (i % 3 == 0)
+      Vec_IntPush(literals, Gia_ManAppendAnd(aig_manager, Abc_LitNotCond(lit1, i & 2), Abc_LitNotCond(lit0, i & 1)));
+  }
+  for (int i = Vec_IntSize(literals) - 100; i < Vec_IntSize(literals); i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(literals, i));
+
+  Gia_Man_t* sequential = Gia_ManRehash(aig_manager, 0);
+  Gia_Man_t* parallel = Gia_ManRehashMt(aig_manager, 4, 0);
+  EXPECT_LT(Gia_ManAndNum(sequential), Gia_ManAndNum(aig_manager));
+  ASSERT_EQ(Gia_ManObjNum(sequential), Gia_ManObjNum(parallel));
+  EXPECT_EQ(memcmp(sequential->pObjs, parallel->pObjs, sizeof(Gia_Obj_t) * Gia_ManObjNum(sequential)), 0);
+  Gia_ManStop(sequential);
+  Gia_ManStop(parallel);
+  Vec_IntFree(literals);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, SimdKernelsMatchScalar) {
+  const int nWordsMax = 37; // not a multiple of the vector width
+  const int pWidths[] = {1, 3, 4, 5, 8, 12, nWordsMax}; // the tails and the short vectors
+  word* in0 = Abc_SimdAlloc(nWordsMax);
+  word* in1 = Abc_SimdAlloc(nWordsMax);
+  word* ctrl = Abc_SimdAlloc(nWordsMax);
+  word* out = Abc_SimdAlloc(nWordsMax);
+  EXPECT_EQ((size_t)out % 64, 0u);
+  Abc_RandomW(1);
+  for (int w = 0; w < nWordsMax; w++) {
+    in0[w] = Abc_RandomW(0);
+    in1[w] = Abc_RandomW(0);
+    ctrl[w] = Abc_RandomW(0);
+  }
+  int levelOld = Abc_SimdLevel();
+  for (int level = ABC_SIMD_SCALAR; level <= Abc_SimdLevelSupported(); level++) {
+    Abc_SimdSetLevel(level);
+    for (int nWords : pWidths) {
+      for (int c = 0; c < 8; c++) {
+        word m0 = (c & 1) ? ~(word)0 : 0, m1 = (c & 2) ? ~(word)0 : 0, mc = (c & 4) ? ~(word)0 : 0;
+        if (nWords < nWordsMax)
+          out[nWords] = 0;
+        Abc_SimdAnd(out, in0, in1, c & 1, (c >> 1) & 1, nWords);
+        for (int w = 0; w < nWords; w++)
+          ASSERT_EQ(out[w], (in0[w] ^ m0) & (in1[w] ^ m1));
+        Abc_SimdXor(out, in0, in1, c & 1, nWords);
+        for (int w = 0; w < nWords; w++)
+          ASSERT_EQ(out[w], in0[w] ^ in1[w] ^ m0);
+        Abc_SimdMux(out, ctrl, in1, in0, (c >> 2) & 1, (c >> 1) & 1, c & 1, nWords);
+        for (int w = 0; w < nWords; w++)
+          ASSERT_EQ(out[w], ((ctrl[w] ^ mc) & (in1[w] ^ m1)) | (~(ctrl[w] ^ mc) & (in0[w] ^ m0)));
+        Abc_SimdCopy(out, in0, c & 1, nWords);
+        for (int w = 0; w < nWords; w++)
+          ASSERT_EQ(out[w], in0[w] ^ m0);
+        if (nWords < nWordsMax) { // the words past the end are not written
+          ASSERT_EQ(out[nWords], (word)0);
+        }
+      }
+    }
+  }
+  Abc_SimdSetLevel(levelOld);
+  Abc_SimdFree(in0);
+  Abc_SimdFree(in1);
+  Abc_SimdFree(ctrl);
+  Abc_SimdFree(out);
+}
+
+TEST(GiaTest, ParallelMfsWithDontCaresIsEquivalent) {
+  Abc_Start();
+  Abc_Frame_t* frame = Abc_FrameGetGlobalFrame();
+  Gia_Man_t* original = Gia_AigerRead((char*)"../../i10.aig", 0, 0, 0);
+  ASSERT_TRUE(original != nullptr);
+  // -l simplifies the local functions, which the main thread also does when it retries a node
+  ASSERT_EQ(Cmd_CommandExecute(frame, "read ../../i10.aig; if -K 6; mfs2 -P 4 -l; strash; &get"), 0);
+  Gia_Man_t* optimized = Abc_FrameReadGia(frame);
+  ASSERT_TRUE(optimized != nullptr);
+  EXPECT_EQ(Cec_ManVerifyTwo(original, optimized, 0), 1);
+  Gia_ManStop(original);
+  Abc_Stop();
+}
+
+// a 6-bit counter incremented when the input is 1, whose output is 1 when the count is 37
+static Gia_Man_t* MakeEnableCounter() {
+  Gia_Man_t* p = Gia_ManStart(100);
+  int enable = Gia_ManAppendCi(p), regs[6], next[6], carry, out = 1, i;
+  for (i = 0; i < 6; i++)
+    regs[i] = Gia_ManAppendCi(p);
+  Gia_ManHashAlloc(p);
+  carry = enable;
+  for (i = 0; i < 6; i++) {
+    next[i] = Gia_ManHashXor(p, regs[i], carry);
+    carry = Gia_ManHashAnd(p, regs[i], carry);
+    out = Gia_ManHashAnd(p, out, Abc_LitNotCond(regs[i], !((37 >> i) & 1)));
+  }
+  Gia_ManHashStop(p);
+  Gia_ManAppendCo(p, out);
+  for (i = 0; i < 6; i++)
+    Gia_ManAppendCo(p, next[i]);
+  Gia_ManSetRegNum(p, 6);
+  return p;
+}
+
+TEST(GiaTest, BmcsFindsTheSameFrameWithEachSolver) {
+  Abc_Start();
+  Abc_Frame_t* frame = Abc_FrameGetGlobalFrame();
+  Gia_Man_t* counter = MakeEnableCounter();
+  const char* solvers[] = { "bsat", "satoko", "glucose", "cadical", "kissat" };
+  const char* options[] = { "-A 1", "-A 2", "-A 3", "-A 5", "-P 2 -d -A 5" };
+  char command[100];
+  for (const char* solver : solvers) {
+    for (const char* option : options) {
+      Abc_FrameUpdateGia(frame, Gia_ManDup(counter));
+      snprintf(command, sizeof(command), "&bmcs -S %s %s", solver, option);
+      ASSERT_EQ(Cmd_CommandExecute(frame, command), 0);
+      Abc_Cex_t* cex = (Abc_Cex_t*)Abc_FrameReadCex(frame);
+      ASSERT_TRUE(cex != nullptr) << command;
+      EXPECT_EQ(cex->iFrame, 37) << command;
+    }
+  }
+  Gia_ManStop(counter);
+  Abc_Stop();
+}
+
+TEST(GiaTest, ConcurrentStochSynIsEquivalent) {
+  Abc_Start();
+  Abc_Frame_t* frame = Abc_FrameGetGlobalFrame();
+  Gia_Man_t* original = Gia_AigerRead((char*)"../../i10.aig", 0, 0, 0);
+  ASSERT_TRUE(original != nullptr);
+  // these scripts are made of reentrant commands, so the partitions are processed on threads
+  const char* scripts[] = {
+    "&r ../../i10.aig; &stochsyn -P 8 -I 4 \"&st; &synch2; &st\"",
+    "&r ../../i10.aig; &stochsyn -P 8 -I 4 \"&st; &synch2; &if -m; &st\""
+  };
+  for (const char* script : scripts) {
+    ASSERT_EQ(Cmd_CommandExecute(frame, script), 0);
+    Gia_Man_t* optimized = Abc_FrameReadGia(frame);
+    ASSERT_TRUE(optimized != nullptr);
+    EXPECT_EQ(Cec_ManVerifyTwo(original, optimized, 0), 1) << script;
+  }
+  Gia_ManStop(original);
+  Abc_Stop();
+}
+
+TEST(GiaTest, ParallelSweepingIsReproducible) {
+  Abc_Start();
+  Abc_Frame_t* frame = Abc_FrameGetGlobalFrame();
+  Gia_Man_t* original = Gia_AigerRead((char*)"../../i10.aig", 0, 0, 0);
+  ASSERT_TRUE(original != nullptr);
+  Gia_Man_t* results[2];
+  for (int run = 0; run < 2; run++) {
+    ASSERT_EQ(Cmd_CommandExecute(frame, "&r ../../i10.aig; &st; &fraig -x -T 4"), 0);
+    results[run] = Gia_ManDup(Abc_FrameReadGia(frame));
+    EXPECT_EQ(Cec_ManVerifyTwo(original, results[run], 0), 1);
+  }
+  ASSERT_EQ(Gia_ManObjNum(results[0]), Gia_ManObjNum(results[1]));
+  EXPECT_EQ(memcmp(results[0]->pObjs, results[1]->pObjs, sizeof(Gia_Obj_t) * Gia_ManObjNum(results[0])), 0);
+  Gia_ManStop(results[0]);
+  Gia_ManStop(results[1]);
+  Gia_ManStop(original);
+  Abc_Stop();
+}
+
+// evaluates the literal of a combinational AIG under the given CI values
+static int EvalLit(Gia_Man_t* p, int iLit, const int* pValues) {
+  Gia_Obj_t* pObj = Gia_ManObj(p, Abc_Lit2Var(iLit));
+  int Value = 0;
+  if (Gia_ObjIsCi(pObj))
+    Value = pValues[Gia_ObjCioId(pObj)];
+  else if (Gia_ObjIsAnd(pObj))
+    Value = EvalLit(p, Gia_ObjFaninLit0p(p, pObj), pValues) & EvalLit(p, Gia_ObjFaninLit1p(p, pObj), pValues);
+  return Value ^ Abc_LitIsCompl(iLit);
+}
+
+TEST(GiaTest, BatchedSolverReturnsStatusesAndCexes) {
+  Gia_Man_t* p = Gia_ManStart(100);
+  int a = Gia_ManAppendCi(p), b = Gia_ManAppendCi(p), c = Gia_ManAppendCi(p);
+  // structurally different nodes, which are not merged by hashing
+  int ab = Gia_ManAppendAnd(p, a, b);
+  int abc = Gia_ManAppendAnd(p, a, Gia_ManAppendAnd(p, b, c));
+  int abnc = Gia_ManAppendAnd(p, Gia_ManAppendAnd(p, a, Abc_LitNot(c)), b);
+  int ab2 = Abc_LitNot(Gia_ManAppendAnd(p, Abc_LitNot(abc), Abc_LitNot(abnc)));
+  int ac = Gia_ManAppendAnd(p, a, c);
+  Gia_ManAppendCo(p, ab2);
+  // pairs: equal, different, complemented, the same, and a node compared with constant 0
+  int pairs[] = { ab, ab2, ab, ac, ab, Abc_LitNot(ab), ac, ac, 0, ac };
+  const int nPairs = 5;
+  int expected[nPairs] = { GLUCOSE_UNSAT, GLUCOSE_SAT, GLUCOSE_SAT, GLUCOSE_UNSAT, GLUCOSE_SAT };
+  for (int jType = 0; jType <= 2; jType++) {
+    Cec4_Bat_t* pBat = Cec4_BatStart(p, jType, 1000, 1000, 500, 1000);
+    int status[nPairs], cexPos[nPairs];
+    for (int k = 0; k < nPairs; k++)
+      cexPos[k] = -1;
+    Cec4_BatSolve(pBat, pairs, nPairs, nullptr, status, cexPos);
+    Vec_Int_t* vCexes = Cec4_BatReadCexes(pBat);
+    for (int k = 0; k < nPairs; k++) {
+      ASSERT_EQ(status[k], expected[k]) << "jType " << jType << " pair " << k;
+      if (status[k] != GLUCOSE_SAT)
+        continue;
+      // the counter-example (CIs not listed are 0) distinguishes the literals
+      int values[3] = { 0, 0, 0 }, nLits = Vec_IntEntry(vCexes, cexPos[k]);
+      for (int i = 1; i <= nLits; i++) {
+        int iLit = Vec_IntEntry(vCexes, cexPos[k] + i);
+        values[Abc_Lit2Var(iLit)] = Abc_LitIsCompl(iLit);
+      }
+      EXPECT_NE(EvalLit(p, pairs[2*k], values), EvalLit(p, pairs[2*k+1], values)) << "jType " << jType << " pair " << k;
+    }
+    Cec4_BatStop(pBat);
+  }
+  Gia_ManStop(p);
+}
+
+// maps the names of the cache entries to their inodes, which change when an entry is stored again
+static std::map<std::string, ino_t> ReadCacheEntries(const char* dir) {
+  std::map<std::string, ino_t> entries;
+  DIR* pDir = opendir(dir);
+  struct dirent* pEntry;
+  struct stat info;
+  while ((pEntry = readdir(pDir)) != nullptr) {
+    std::string path = std::string(dir) + "/" + pEntry->d_name;
+    if (pEntry->d_name[0] != '.' && stat(path.c_str(), &info) == 0)
+      entries[pEntry->d_name] = info.st_ino;
+  }
+  closedir(pDir);
+  return entries;
+}
+
+TEST(GiaTest, CommandCacheHitsMissesAndInvalidates) {
+  char dir[] = "/tmp/abc_cache_XXXXXX";
+  ASSERT_TRUE(mkdtemp(dir) != nullptr);
+  Abc_Start();
+  Abc_Frame_t* frame = Abc_FrameGetGlobalFrame();
+  Gia_Man_t* original = Gia_AigerRead((char*)"../../i10.aig", 0, 0, 0);
+  ASSERT_TRUE(original != nullptr && original->vNamesIn && original->vNamesOut);
+  std::string setCache = std::string("set gia_cache ") + dir;
+  ASSERT_EQ(Cmd_CommandExecute(frame, setCache.c_str()), 0);
+
+  // miss: the results of &st and &if are stored
+  ASSERT_EQ(Cmd_CommandExecute(frame, "&r ../../i10.aig; &st; &if -K 6"), 0);
+  std::map<std::string, ino_t> entries = ReadCacheEntries(dir);
+  EXPECT_EQ(entries.size(), 2u);
+  int nLuts = Gia_ManLutNum(Abc_FrameReadGia(frame));
+
+  // hit: the entries are not stored again, and the names saved in them are restored
+  ASSERT_EQ(Cmd_CommandExecute(frame, "&r ../../i10.aig"), 0);
+  Gia_Man_t* unnamed = Abc_FrameReadGia(frame);
+  Vec_PtrFreeFree(unnamed->vNamesIn);
+  Vec_PtrFreeFree(unnamed->vNamesOut);
+  unnamed->vNamesIn = unnamed->vNamesOut = nullptr;
+  ASSERT_EQ(Cmd_CommandExecute(frame, "&st; &if -K 6"), 0);
+  EXPECT_EQ(ReadCacheEntries(dir), entries);
+  Gia_Man_t* cached = Abc_FrameReadGia(frame);
+  EXPECT_EQ(Gia_ManLutNum(cached), nLuts);
+  EXPECT_EQ(Cec_ManVerifyTwo(original, cached, 0), 1);
+  ASSERT_TRUE(cached->vNamesIn != nullptr && cached->vNamesOut != nullptr);
+  EXPECT_STREQ((char*)Vec_PtrEntry(cached->vNamesIn, 5), (char*)Vec_PtrEntry(original->vNamesIn, 5));
+  EXPECT_STREQ((char*)Vec_PtrEntry(cached->vNamesOut, 7), (char*)Vec_PtrEntry(original->vNamesOut, 7));
+
+  // miss: another command line adds one entry for &if
+  ASSERT_EQ(Cmd_CommandExecute(frame, "&r ../../i10.aig; &st; &if -K 4"), 0);
+  EXPECT_EQ(ReadCacheEntries(dir).size(), 3u);
+
+  // invalidation: the arrival times are part of the key and are kept on a hit
+  for (int round = 0; round < 2; round++) {
+    ASSERT_EQ(Cmd_CommandExecute(frame, "&r ../../i10.aig; &st"), 0);
+    Gia_Man_t* timed = Abc_FrameReadGia(frame);
+    timed->vInArrs = Vec_FltStart(Gia_ManCiNum(timed));
+    Vec_FltWriteEntry(timed->vInArrs, 0, 10.0);
+    ASSERT_EQ(Cmd_CommandExecute(frame, "&if -K 6"), 0);
+    EXPECT_EQ(ReadCacheEntries(dir).size(), 4u);
+    ASSERT_TRUE(Abc_FrameReadGia(frame)->vInArrs != nullptr);
+    EXPECT_EQ(Vec_FltEntry(Abc_FrameReadGia(frame)->vInArrs, 0), 10.0);
+  }
+
+  // invalidation: another AIG misses for every command
+  ASSERT_EQ(Cmd_CommandExecute(frame, "&r ../../i10.aig; &st; &dc2; &if -K 6"), 0);
+  EXPECT_EQ(ReadCacheEntries(dir).size(), 6u);
+
+  for (auto& entry : ReadCacheEntries(dir))
+    remove((std::string(dir) + "/" + entry.first).c_str());
+  rmdir(dir);
+  Gia_ManStop(original);
+  Abc_Stop();
+}
+
 ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,138 @@
+#include "gtest/gtest.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "aig/gia/gia.h"
+#include "base/main/main.h"
+#include "base/cmd/cmd.h"
+#include "proof/cec/cec.h"
+
+// This test is built only when libabc is compiled with the wide object layout
+// (see test/gia/CMakeLists.txt), so the managers can be passed to libabc.
+#ifndef ABC_USE_GIA_WIDE
+#error "gia_wide_test requires ABC_USE_GIA_WIDE"
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+TEST(GiaWideTest, UsesWideLayout) {
+  EXPECT_EQ(sizeof(Gia_Obj_t), 16u);
+  EXPECT_EQ(GIA_OBJ_MAX, 0x3FFFFFFF);
+  // the literals of all objects fit into a signed integer
+  EXPECT_GT(Abc_Var2Lit(GIA_OBJ_MAX - 1, 1), 0);
+
+  Gia_Obj_t obj;
+  memset(&obj, 0, sizeof(Gia_Obj_t));
+  obj.iDiff0 = GIA_NONE;
+  obj.fTerm = 1;
+  EXPECT_EQ((unsigned)obj.iDiff0, (unsigned)GIA_NONE);
+  EXPECT_TRUE(Gia_ObjIsCi(&obj));
+
+  Gia_Rpr_t repr;
+  memset(&repr, 0, sizeof(Gia_Rpr_t));
+  repr.iRepr = GIA_VOID;
+  EXPECT_EQ((unsigned)repr.iRepr, (unsigned)GIA_VOID);
+  repr.iRepr = (1 << 29) + 3;
+  EXPECT_EQ((unsigned)repr.iRepr, (unsigned)((1 << 29) + 3));
+}
+
+TEST(GiaWideTest, StoresFaninDiffsBeyondNarrowLimit) {
+  const int iObj = GIA_OBJ_MAX - 1;
+  const int nDiff0 = (1 << 29) + 7, nDiff1 = GIA_OBJ_MAX - 2;
+  Gia_Obj_t obj;
+  memset(&obj, 0, sizeof(Gia_Obj_t));
+  obj.iDiff0 = nDiff0;
+  obj.fCompl0 = 1;
+  obj.iDiff1 = nDiff1;
+  EXPECT_EQ(Gia_ObjFaninId0(&obj, iObj), iObj - nDiff0);
+  EXPECT_EQ(Gia_ObjFaninId1(&obj, iObj), 1);
+  EXPECT_EQ(Gia_ObjFaninLit0(&obj, iObj), Abc_Var2Lit(iObj - nDiff0, 1));
+  EXPECT_EQ(Gia_ObjFaninLit1(&obj, iObj), Abc_Var2Lit(1, 0));
+  EXPECT_TRUE(Gia_ObjIsAnd(&obj));
+}
+
+TEST(GiaWideTest, GrowsStorageByQuarterBeyond2To26) {
+  EXPECT_EQ(Gia_ManObjAllocNext(1000), 2000);
+  EXPECT_EQ(Gia_ManObjAllocNext((1 << 26) - 1), 2 * ((1 << 26) - 1));
+  EXPECT_EQ(Gia_ManObjAllocNext(1 << 26), (1 << 26) + (1 << 24));
+  EXPECT_EQ(Gia_ManObjAllocNext(1 << 29), (1 << 29) + (1 << 27));
+  EXPECT_EQ(Gia_ManObjAllocNext(GIA_OBJ_MAX - 10), GIA_OBJ_MAX);
+  EXPECT_EQ(Gia_ManObjAllocNext(GIA_OBJ_MAX), GIA_OBJ_MAX);
+}
+
+TEST(GiaWideTest, CanGrowObjectStorage) {
+  Gia_Man_t* aig_manager = Gia_ManStart(1);
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  int and_output = Gia_ManAppendAnd(aig_manager, input1, input2);
+  for (int i = 0; i < 1000; i++)
+    and_output = Gia_ManAppendAnd(aig_manager, and_output, Abc_LitNot(input1 + 2 * (i % 2)));
+  Gia_ManAppendCo(aig_manager, and_output);
+
+  EXPECT_EQ(Gia_ManAndNum(aig_manager), 1001);
+  EXPECT_GE(aig_manager->nObjsAlloc, Gia_ManObjNum(aig_manager));
+  Gia_Obj_t* pObj = Gia_ManObj(aig_manager, Abc_Lit2Var(and_output));
+  EXPECT_EQ(Gia_ObjFaninId1p(aig_manager, pObj), Abc_Lit2Var(and_output) - 1);
+  EXPECT_EQ(Gia_ObjFaninId0p(aig_manager, pObj), Abc_Lit2Var(input1 + 2 * (999 % 2)));
+  EXPECT_TRUE(Gia_ObjIsCi(Gia_ManCi(aig_manager, 1)));
+  EXPECT_TRUE(Gia_ObjIsCo(Gia_ManCo(aig_manager, 0)));
+  EXPECT_TRUE(Gia_ObjIsConst0(Gia_ManConst0(aig_manager)));
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaWideTest, HashesAndGates) {
+  Gia_Man_t* p = Gia_ManStart(100);
+  int a = Gia_ManAppendCi(p), b = Gia_ManAppendCi(p), c = Gia_ManAppendCi(p);
+  Gia_ManHashAlloc(p);
+  int ab = Gia_ManHashAnd(p, a, b);
+  EXPECT_EQ(Gia_ManHashAnd(p, b, a), ab);
+  EXPECT_EQ(Gia_ManHashAnd(p, a, Abc_LitNot(a)), 0);
+  EXPECT_EQ(Gia_ManHashAnd(p, a, 1), a);
+  int mux = Gia_ManHashMux(p, c, ab, Abc_LitNot(a));
+  EXPECT_EQ(Gia_ManHashMux(p, c, ab, Abc_LitNot(a)), mux);
+  Gia_ManHashStop(p);
+  Gia_ManAppendCo(p, mux);
+  EXPECT_EQ(Gia_ManAndNum(p), 4);
+
+  // all eight input combinations are simulated in parallel
+  Vec_Wrd_t* stimulus = Vec_WrdAlloc(3);
+  Vec_WrdPush(stimulus, 0xAA);
+  Vec_WrdPush(stimulus, 0xCC);
+  Vec_WrdPush(stimulus, 0xF0);
+  Vec_Wrd_t* output = Gia_ManSimPatSimOut(p, stimulus, 1);
+  EXPECT_EQ(Vec_WrdEntry(output, 0) & 0xFF, (word)((0xF0 & 0xAA & 0xCC) | (~0xF0 & ~0xAA & 0xFF)));
+  Vec_WrdFree(output);
+  Vec_WrdFree(stimulus);
+  Gia_ManStop(p);
+}
+
+TEST(GiaWideTest, ReadsAndWritesAiger) {
+  Gia_Man_t* original = Gia_AigerRead((char*)"../../i10.aig", 0, 0, 0);
+  ASSERT_TRUE(original != nullptr);
+  char fileName[] = "/tmp/abc_wide_XXXXXX";
+  int fd = mkstemp(fileName);
+  ASSERT_NE(fd, -1);
+  close(fd);
+  Gia_AigerWrite(original, fileName, 0, 0, 0);
+  Gia_Man_t* copy = Gia_AigerRead(fileName, 0, 0, 0);
+  remove(fileName);
+  ASSERT_TRUE(copy != nullptr);
+  EXPECT_EQ(Gia_ManObjNum(copy), Gia_ManObjNum(original));
+  EXPECT_EQ(Cec_ManVerifyTwo(original, copy, 0), 1);
+  // a complemented output makes the copy differ
+  Gia_ObjFlipFaninC0(Gia_ManCo(copy, 0));
+  EXPECT_EQ(Cec_ManVerifyTwo(original, copy, 0), 0);
+  Gia_ManStop(copy);
+  Gia_ManStop(original);
+}
+
+TEST(GiaWideTest, SynthesisPassesCec) {
+  Abc_Start();
+  Abc_Frame_t* frame = Abc_FrameGetGlobalFrame();
+  ASSERT_EQ(Cmd_CommandExecute(frame, "&r ../../i10.aig; &st; &syn2; &dc2; &if -K 6; &mfs; &st; &cec"), 0);
+  EXPECT_EQ(Abc_FrameReadProbStatus(frame), 1);
+  Abc_Stop();
+}
+
+ABC_NAMESPACE_IMPL_END